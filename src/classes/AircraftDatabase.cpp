@@ -0,0 +1,99 @@
+#include "AircraftDatabase.h"
+
+namespace {
+    unsigned int minutesPerThousandFeet(const unsigned int feetPerMinute) {
+        return (1000 + feetPerMinute - 1) / feetPerMinute;
+    }
+}
+
+AircraftSpec::AircraftSpec() : fuelConsumption(0), climbRate(0), descentRate(0), boardingRate(0), pushbackTime(0) {}
+
+bool AircraftDatabase::properlyInitialized() const {
+    return this == init;
+}
+
+AircraftDatabase::AircraftDatabase() : specs(), types(), baseTable(NULL), init(this) {
+    ENSURE(properlyInitialized(), "AircraftDatabase was not properly initialized.");
+}
+
+AircraftDatabase::~AircraftDatabase() {
+    for (std::map<TypeKey, AircraftType*>::iterator it_type = types.begin(); it_type != types.end(); it_type++) {
+        delete it_type->second;
+    }
+    types.clear();
+}
+
+void AircraftDatabase::setSpec(const std::string& model, const AircraftSpec& spec) {
+    REQUIRE(properlyInitialized(), "AircraftDatabase was not properly initialized.");
+    REQUIRE(!model.empty(), "Aircraft model is empty.");
+    REQUIRE(!isResolved(model), "Aircraft model was already resolved.");
+    specs[model] = spec;
+    ENSURE(hasModel(model), "Aircraft model was not properly added.");
+}
+
+bool AircraftDatabase::hasModel(const std::string& model) const {
+    REQUIRE(properlyInitialized(), "AircraftDatabase was not properly initialized.");
+    return specs.find(model) != specs.end();
+}
+
+const AircraftSpec& AircraftDatabase::getSpec(const std::string& model) const {
+    REQUIRE(properlyInitialized(), "AircraftDatabase was not properly initialized.");
+    REQUIRE(hasModel(model), "Aircraft model is unknown.");
+    return specs.find(model)->second;
+}
+
+bool AircraftDatabase::isResolved(const std::string& model) const {
+    REQUIRE(properlyInitialized(), "AircraftDatabase was not properly initialized.");
+    std::map<TypeKey, AircraftType*>::const_iterator it_type = types.lower_bound(TypeKey(model, 0));
+    return it_type != types.end() && it_type->first.first == model;
+}
+
+unsigned long AircraftDatabase::size() const {
+    REQUIRE(properlyInitialized(), "AircraftDatabase was not properly initialized.");
+    return specs.size();
+}
+
+const AircraftType* AircraftDatabase::resolve(const std::string& model, const AirplaneEnums::ESize size, const AirplaneEnums::EEngine engine, const PerformanceTable& table) {
+    REQUIRE(properlyInitialized(), "AircraftDatabase was not properly initialized.");
+    REQUIRE(baseTable == NULL || baseTable == &table, "AircraftDatabase can only resolve against one PerformanceTable.");
+    baseTable = &table;
+
+    std::map<std::string, AircraftSpec>::const_iterator it_spec = specs.find(model);
+    if (it_spec == specs.end()) return table.getAircraftType(size, engine);
+
+    const TypeKey key(model, size * AirplaneEnums::kEngineCount + engine);
+    std::map<TypeKey, AircraftType*>::const_iterator it_type = types.find(key);
+    if (it_type != types.end()) return it_type->second;
+
+    const AircraftSpec& spec = it_spec->second;
+    AircraftType* type = new AircraftType(*table.getAircraftType(size, engine));
+
+    if (spec.fuelConsumption != 0) {
+        type->fuelConsumption = spec.fuelConsumption;
+    }
+
+    if (spec.climbRate != 0) {
+        type->actionTimes[AirplaneEnums::kStatus_Ascending] = minutesPerThousandFeet(spec.climbRate);
+    }
+
+    if (spec.descentRate != 0) {
+        const unsigned int descentTime = minutesPerThousandFeet(spec.descentRate);
+        type->actionTimes[AirplaneEnums::kStatus_DescendingTo5000ft] = descentTime;
+        type->actionTimes[AirplaneEnums::kStatus_DescendingTo3000ft] = descentTime;
+        type->actionTimes[AirplaneEnums::kStatus_FinalApproach] = descentTime;
+        type->actionTimes[AirplaneEnums::kStatus_EmergencyFinalApproach] = descentTime;
+    }
+
+    if (spec.boardingRate != 0) {
+        type->boardingRate = spec.boardingRate;
+    }
+
+    if (spec.pushbackTime != 0) {
+        type->actionTimes[AirplaneEnums::kStatus_PushingBack] = spec.pushbackTime;
+    }
+
+    types[key] = type;
+
+    ENSURE(type != NULL, "Aircraft type was not properly resolved.");
+    return type;
+}
@@ -0,0 +1,122 @@
+#ifndef INC_AIRCRAFTDATABASE_H
+#define INC_AIRCRAFTDATABASE_H
+
+#include "../lib/DesignByContract.h"
+#include "Airplane.h"
+#include "PerformanceTable.h"
+
+#include <string>
+#include <map>
+
+/**
+ * Performance figures of an aircraft model, a value of 0 leaves the size/engine class default in place
+ */
+struct AircraftSpec {
+    /**
+     * Fuel burned per minute while airborne
+     */
+    unsigned int fuelConsumption;
+
+    /**
+     * Feet climbed per minute
+     */
+    unsigned int climbRate;
+
+    /**
+     * Feet descended per minute
+     */
+    unsigned int descentRate;
+
+    /**
+     * Passengers (un)boarded per minute
+     */
+    unsigned int boardingRate;
+
+    /**
+     * Minutes needed to push back from the gate
+     */
+    unsigned int pushbackTime;
+
+    AircraftSpec();
+};
+
+/**
+ * Aircraft type database keyed by Airplane model. \n
+ * Models are resolved once per Airplane into an AircraftType record owned by the database,
+ * the record starts from the size/engine class of a PerformanceTable and applies the model's figures on top.
+ */
+class AircraftDatabase {
+private:
+    typedef std::pair<std::string, unsigned int> TypeKey;
+
+    std::map<std::string, AircraftSpec> specs;
+    std::map<TypeKey, AircraftType*> types;
+
+    const PerformanceTable* baseTable;
+
+    const AircraftDatabase* init;
+
+    bool properlyInitialized() const;
+
+    AircraftDatabase(const AircraftDatabase&);
+
+    AircraftDatabase& operator=(const AircraftDatabase&);
+
+public:
+    /**
+     * POST: \n
+     * ENSURE(properlyInitialized(), "AircraftDatabase was not properly initialized.");
+     */
+    AircraftDatabase();
+
+    ~AircraftDatabase();
+
+    /**
+     * The figures of a model can not change once an Airplane resolved it, the Airplanes keep the record \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AircraftDatabase was not properly initialized."); \n
+     * REQUIRE(!model.empty(), "Aircraft model is empty."); \n
+     * REQUIRE(!isResolved(model), "Aircraft model was already resolved."); \n
+     * POST: \n
+     * ENSURE(hasModel(model), "Aircraft model was not properly added.");
+     */
+    void setSpec(const std::string& model, const AircraftSpec& spec);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AircraftDatabase was not properly initialized.");
+     * @return true if the database holds figures for the model
+     */
+    bool hasModel(const std::string& model) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AircraftDatabase was not properly initialized."); \n
+     * REQUIRE(hasModel(model), "Aircraft model is unknown.");
+     * @return the figures of the model
+     */
+    const AircraftSpec& getSpec(const std::string& model) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AircraftDatabase was not properly initialized.");
+     * @return true if a record was resolved for the model in any class
+     */
+    bool isResolved(const std::string& model) const;
+
+    unsigned long size() const;
+
+    /**
+     * Resolves the record an Airplane of the given model and class reads its performance from. \n
+     * Unknown models resolve to the class record of the table. \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AircraftDatabase was not properly initialized."); \n
+     * REQUIRE(baseTable == NULL || baseTable == &table, "AircraftDatabase can only resolve against one PerformanceTable."); \n
+     * POST: \n
+     * ENSURE(result != NULL, "Aircraft type was not properly resolved.");
+     * @return a record that stays valid for the lifetime of the database and the table
+     */
+    const AircraftType* resolve(const std::string& model, const AirplaneEnums::ESize size, const AirplaneEnums::EEngine engine, const PerformanceTable& table);
+};
+
+#endif
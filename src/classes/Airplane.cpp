@@ -1,4 +1,5 @@
 #include "Airplane.h"
+#include "PerformanceTable.h"
 
 namespace AirplaneEnums {
     #define estatus(x) #x
@@ -105,6 +106,7 @@ Airplane::Airplane(const std::string& _number,
           callsign(_callsign),
           model(_model),
           squawk(_squawk),
+          assignedSquawk(_squawk),
           altitude(_altitude),
           fuel(_fuel),
           fuelCapacity(_fuelCapacity),
@@ -117,11 +119,13 @@ Airplane::Airplane(const std::string& _number,
           permission(false),
           actionTimer(0),
           communicationTimer(0),
+          departureTime(0),
           airport(NULL),
           gate(-1),
           runway(NULL),
           currentLocation(NULL),
           taxiRoute(std::queue<Location*>()),
+          aircraftType(PerformanceTable::getDefault().getAircraftType(_size, _engine)),
           init(this) {
     ENSURE(properlyInitialized(), "Airplane was not properly initialized");
 }
@@ -131,6 +135,7 @@ Airplane::Airplane(const Airplane* _airplane)
           callsign(_airplane->getCallsign()),
           model(_airplane->getModel()),
           squawk(_airplane->getSquawk()),
+          assignedSquawk(_airplane->getAssignedSquawk()),
           altitude(_airplane->getAltitude()),
           fuel(_airplane->getFuel()),
           fuelCapacity(_airplane->getFuelCapacity()),
@@ -143,11 +148,13 @@ Airplane::Airplane(const Airplane* _airplane)
           permission(_airplane->hasPermission()),
           actionTimer(_airplane->getActionTimer()),
           communicationTimer(_airplane->getCommunicationTimer()),
+          departureTime(_airplane->getDepartureTime()),
           airport(_airplane->getAirport()),
           gate(_airplane->getGate()),
           runway(_airplane->getRunway()),
           currentLocation(_airplane->getCurrentLocation()),
           taxiRoute(std::queue<Location*>()),
+          aircraftType(_airplane->getAircraftType()),
           init(this) {
     REQUIRE(_airplane->properlyInitialized(), "References Airplane was not properly initialized");
     ENSURE(properlyInitialized(), "Airplane was not properly initialized");
@@ -177,9 +184,48 @@ void Airplane::setSquawk(const unsigned int p_squawk) {
     REQUIRE(properlyInitialized(), "Airplane was not properly initialized.");
     REQUIRE((p_squawk >= 001 && p_squawk <= 06777) || p_squawk == 07500 || p_squawk == 07600 || p_squawk == 07700, "Property 'squawk' has to lie between 0001-6777 (7500, 7600, 7700 included) in base 8.");
     squawk = p_squawk;
+    if (p_squawk != 07500 && p_squawk != 07600 && p_squawk != 07700) assignedSquawk = p_squawk;
     ENSURE(squawk == p_squawk, "Property 'squawk' was not correctly set in Airplane.");
 }
 
+unsigned int Airplane::getAssignedSquawk() const {
+    REQUIRE(properlyInitialized(), "Airplane was not properly initialized.");
+    return assignedSquawk;
+}
+
+unsigned int Airplane::getSquawkBlock() const {
+    REQUIRE(properlyInitialized(), "Airplane was not properly initialized.");
+
+    unsigned int offset = 00;
+
+    if (type == AirplaneEnums::kType_Private) {
+        if (size == AirplaneEnums::kSize_Small) {
+            offset = 01;
+        } else if (size == AirplaneEnums::kSize_Medium) {
+            if (engine == AirplaneEnums::kEngine_Jet) { offset = 01000; }
+        }
+    } else if (type == AirplaneEnums::kType_Airline) {
+        if (size == AirplaneEnums::kSize_Medium) {
+            if (engine == AirplaneEnums::kEngine_Propeller) { offset = 02000; }
+            else if (engine == AirplaneEnums::kEngine_Jet) { offset = 03000; }
+        } else if (size == AirplaneEnums::kSize_Large) {
+            if (engine == AirplaneEnums::kEngine_Jet) { offset = 04000; }
+        }
+    } else if (type == AirplaneEnums::kType_Military) {
+        if (size == AirplaneEnums::kSize_Small) {
+            if (engine == AirplaneEnums::kEngine_Jet) { offset = 05000; }
+        } else if (size == AirplaneEnums::kSize_Large) {
+            if (engine == AirplaneEnums::kEngine_Propeller) { offset = 05000; }
+        }
+    } else if (type == AirplaneEnums::kType_Emergency) {
+        if (size == AirplaneEnums::kSize_Small) {
+            if (engine == AirplaneEnums::kEngine_Propeller) { offset = 06000; }
+        }
+    }
+
+    return offset;
+}
+
 AirplaneEnums::EStatus Airplane::getStatus() const {
     REQUIRE(properlyInitialized(), "Airplane was not properly initialized.");
     return status;
@@ -236,21 +282,19 @@ unsigned int Airplane::getFuelCapacity() const {
 
 unsigned int Airplane::getFuelConsumption() const {
     REQUIRE(properlyInitialized(), "Airplane was not properly initialized.");
-    if (size == AirplaneEnums::kSize_Small) {
-        if (engine == AirplaneEnums::kEngine_Propeller) { return 10; }
-        else if (engine == AirplaneEnums::kEngine_Jet) { return 25; }
-        else { return 0; }
-    } else if (size == AirplaneEnums::kSize_Medium) {
-        if (engine == AirplaneEnums::kEngine_Propeller) { return 50; }
-        else if (engine == AirplaneEnums::kEngine_Jet) { return 175; }
-        else { return 0; }
-    } else if (size == AirplaneEnums::kSize_Large) {
-        if (engine == AirplaneEnums::kEngine_Propeller) { return 100; }
-        else if (engine == AirplaneEnums::kEngine_Jet) { return 250; }
-        else { return 0; }
-    } else {
-        return 0;
-    }
+    return aircraftType->fuelConsumption;
+}
+
+const AircraftType* Airplane::getAircraftType() const {
+    REQUIRE(properlyInitialized(), "Airplane was not properly initialized.");
+    return aircraftType;
+}
+
+void Airplane::setAircraftType(const AircraftType* _aircraftType) {
+    REQUIRE(properlyInitialized(), "Airplane was not properly initialized.");
+    REQUIRE(_aircraftType != NULL, "Referenced AircraftType is a nullpointer.");
+    aircraftType = _aircraftType;
+    ENSURE(aircraftType == _aircraftType, "Property 'aircraftType' was not correctly set in Airplane.");
 }
 
 unsigned int Airplane::getPassengers() const {
@@ -313,6 +357,17 @@ void Airplane::increaseCommunicationTimer(const unsigned int addition) {
     communicationTimer += addition;
 };
 
+unsigned int Airplane::getDepartureTime() const {
+    REQUIRE(properlyInitialized(), "Airplane was not properly initialized.");
+    return departureTime;
+}
+
+void Airplane::setDepartureTime(const unsigned int _departureTime) {
+    REQUIRE(properlyInitialized(), "Airplane was not properly initialized.");
+    departureTime = _departureTime;
+    ENSURE(departureTime == _departureTime, "Property 'departureTime' was not correctly set in Airplane.");
+}
+
 Airport* Airplane::getAirport() const {
     REQUIRE(properlyInitialized(), "Airplane was not properly initialized.");
     return airport;
@@ -393,10 +448,14 @@ bool Airplane::isFlying() const {
 }
 
 bool Airplane::fly() {
+    return fly(getFuelConsumption());
+}
+
+bool Airplane::fly(const unsigned int consumption) {
     REQUIRE(properlyInitialized(), "Airplane was not properly initialized.");
     REQUIRE(isFlying(), "Airplane is currently not in the air");
-    if (getFuel() > getFuelConsumption()) {
-        setFuel(getFuel() - getFuelConsumption());
+    if (getFuel() > consumption) {
+        setFuel(getFuel() - consumption);
         return true;
     } else {
         setSquawk(07700);
@@ -444,3 +503,53 @@ void Airplane::printInfo(std::ostream& stream) const
     stream << " -> engine: " << AirplaneEnums::EnumToString(engine) << std::endl;
     stream << std::endl;
 }
+
+bool SquawkAllocator::properlyInitialized() const {
+    return this == init;
+}
+
+SquawkAllocator::SquawkAllocator() : nextSquawks(), usedSquawks(), init(this) {
+    ENSURE(properlyInitialized(), "SquawkAllocator was not properly initialized.");
+}
+
+void SquawkAllocator::clear() {
+    REQUIRE(properlyInitialized(), "SquawkAllocator was not properly initialized.");
+    nextSquawks.clear();
+    usedSquawks.clear();
+}
+
+void SquawkAllocator::hold(const unsigned int squawk) {
+    REQUIRE(properlyInitialized(), "SquawkAllocator was not properly initialized.");
+    usedSquawks.insert(squawk);
+}
+
+bool SquawkAllocator::isHeld(const unsigned int squawk) const {
+    REQUIRE(properlyInitialized(), "SquawkAllocator was not properly initialized.");
+    return usedSquawks.find(squawk) != usedSquawks.end();
+}
+
+unsigned int SquawkAllocator::take(const unsigned int block) {
+    REQUIRE(properlyInitialized(), "SquawkAllocator was not properly initialized.");
+    REQUIRE(block != 0, "Squawk block does not exist.");
+
+    // the block of small private airplanes starts at 01, no block runs into the next one
+    const unsigned int blockSize = 01000 - block % 01000;
+    unsigned int& next = nextSquawks[block];
+    unsigned int squawk = block + next;
+    for (unsigned int tried = 0; tried < blockSize; tried++) {
+        if (!isHeld(block + (next + tried) % blockSize)) {
+            squawk = block + (next + tried) % blockSize;
+            break;
+        }
+    }
+
+    next = (squawk - block + 1) % blockSize;
+    usedSquawks.insert(squawk);
+    return squawk;
+}
+
+void SquawkAllocator::release(const unsigned int squawk) {
+    REQUIRE(properlyInitialized(), "SquawkAllocator was not properly initialized.");
+    std::multiset<unsigned int>::iterator it_squawk = usedSquawks.find(squawk);
+    if (it_squawk != usedSquawks.end()) usedSquawks.erase(it_squawk);
+}
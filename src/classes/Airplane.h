@@ -8,6 +8,7 @@
 #include <string>
 #include <string.h>
 #include <map>
+#include <set>
 
 namespace AirplaneEnums {
     #define ESTATUS \
@@ -48,6 +49,8 @@ namespace AirplaneEnums {
         enum EStatus { ESTATUS };
     #undef estatus
 
+    const unsigned int kStatusCount = kStatus_Crashed + 1;
+
     const char* EnumToString(EStatus f);
 
     EStatus StringToStatusEnum(const char *f);
@@ -81,6 +84,8 @@ namespace AirplaneEnums {
         enum ESize { ESIZES };
     #undef esize
 
+    const unsigned int kSizeCount = kSize_Large + 1;
+
     const char* EnumToString(ESize f);
 
     ESize StringToSizeEnum(const char *f);
@@ -96,6 +101,8 @@ namespace AirplaneEnums {
         enum EEngine { EENGINES };
     #undef eengine
 
+    const unsigned int kEngineCount = kEngine_Jet + 1;
+
     const char* EnumToString(EEngine f);
 
     EEngine StringToEngineEnum(const char *f);
@@ -105,6 +112,7 @@ namespace AirplaneEnums {
 class Airport;
 class Location;
 class Runway;
+struct AircraftType;
 
 class Airplane {
 private:
@@ -113,6 +121,7 @@ private:
     const std::string model;
 
     unsigned int squawk;
+    unsigned int assignedSquawk;
     unsigned int altitude;
     unsigned int fuel;
     const unsigned int fuelCapacity;
@@ -127,6 +136,7 @@ private:
     bool permission;
     unsigned int actionTimer;
     unsigned int communicationTimer;
+    unsigned int departureTime;
 
     Airport* airport;
     unsigned long gate;
@@ -135,6 +145,8 @@ private:
     Location* currentLocation;
     std::queue<Location*> taxiRoute;
 
+    const AircraftType* aircraftType;
+
     const Airplane* init;
 
     bool properlyInitialized() const;
@@ -218,6 +230,21 @@ public:
      */
     void setSquawk(const unsigned int _squawk);
 
+    /**
+     * Pre: \n
+     * Airplane must be properly initialized \n
+     * @return the last squawk that is not an emergency code (7500, 7600, 7700), the code to return to after an emergency
+     */
+    unsigned int getAssignedSquawk() const;
+
+    /**
+     * Every combination of type, size and engine owns a block of 01000 squawk codes \n
+     * Pre: \n
+     * Airplane must be properly initialized \n
+     * @return the first code of the block of the Airplane's combination, 0 if the combination does not exist
+     */
+    unsigned int getSquawkBlock() const;
+
     /**
      * Pre: \n
      * Airplane must be properly initialized \n
@@ -290,13 +317,30 @@ public:
     void setFuel(const unsigned int _fuel);
 
     /**
-     * Calculates the fuel consumption based on engine and size \n
+     * Reads the fuel consumption from the Airplane's aircraft type record \n
      * Pre: \n
      * Airplane must be properly initialized \n
      * @return the Airplane's consumption rate
      */
     unsigned int getFuelConsumption() const;
 
+    /**
+     * Pre: \n
+     * Airplane must be properly initialized \n
+     * @return the record the Airplane's action times and fuel consumption are read from
+     */
+    const AircraftType* getAircraftType() const;
+
+    /**
+     * Pre: \n
+     * Airplane must be properly initialized \n
+     * The new record must not be a nullpointer \n
+     * Post: \n
+     * The Airplane's aircraft type must match the new record
+     * @param _aircraftType The new aircraft type, must outlive the Airplane
+     */
+    void setAircraftType(const AircraftType* _aircraftType);
+
     /**
      * Pre: \n
      * Airplane must be properly initialized \n
@@ -392,6 +436,22 @@ public:
      */
     void increaseCommunicationTimer(const unsigned int addition = 1);
 
+    /**
+     * Pre: \n
+     * Airplane must be properly initialized \n
+     * @return the first tick the Airplane may request its IFR clearance at the gate, 0 when it leaves as soon as possible
+     */
+    unsigned int getDepartureTime() const;
+
+    /**
+     * Pre: \n
+     * Airplane must be properly initialized \n
+     * Post: \n
+     * The Airplane's departure time must match the new departure time \n
+     * @param _departureTime The new departure time
+     */
+    void setDepartureTime(const unsigned int _departureTime);
+
     /**
      * Pre: \n
      * Airplane must be properly initialized \n
@@ -487,6 +547,14 @@ public:
      */
     bool fly();
 
+    /**
+     * Flies one tick burning the given fuel instead of the fuel consumption \n
+     * Pre: \n
+     * Airplane must be properly initialized \n
+     * @return false if the fuel ran out
+     */
+    bool fly(const unsigned int consumption);
+
     /**
      * Pre: \n
      * Airplane must be properly initialized \n
@@ -519,5 +587,67 @@ struct CompareSquawk {
     }
 };
 
+/**
+ * Hands out the codes of the squawk blocks of Airplane::getSquawkBlock, every block keeps its own position. \n
+ * A code is not handed out again while it is held, a block whose codes are all held repeats them.
+ */
+class SquawkAllocator {
+private:
+    std::map<unsigned int, unsigned int> nextSquawks;
+    std::multiset<unsigned int> usedSquawks;
+
+    const SquawkAllocator* init;
+
+    bool properlyInitialized() const;
+
+    SquawkAllocator(const SquawkAllocator&);
+
+    SquawkAllocator& operator=(const SquawkAllocator&);
+
+public:
+    /**
+     * POST: \n
+     * ENSURE(properlyInitialized(), "SquawkAllocator was not properly initialized.");
+     */
+    SquawkAllocator();
+
+    /**
+     * Forgets every held code and block position \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SquawkAllocator was not properly initialized.");
+     */
+    void clear();
+
+    /**
+     * Marks a code that was not handed out by the allocator as held, codes can be held more than once \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SquawkAllocator was not properly initialized.");
+     */
+    void hold(const unsigned int squawk);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SquawkAllocator was not properly initialized.");
+     * @return true if the code is held
+     */
+    bool isHeld(const unsigned int squawk) const;
+
+    /**
+     * Hands out and holds the next code of the block that is not held \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SquawkAllocator was not properly initialized."); \n
+     * REQUIRE(block != 0, "Squawk block does not exist.");
+     * @param block The first code of the block, as given by Airplane::getSquawkBlock
+     */
+    unsigned int take(const unsigned int block);
+
+    /**
+     * Releases one hold of the code, codes that are not held are ignored \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SquawkAllocator was not properly initialized.");
+     */
+    void release(const unsigned int squawk);
+};
+
 #endif
 
@@ -0,0 +1,131 @@
+#include "AirplaneInfoFile.h"
+
+#include <iomanip>
+#include <sstream>
+
+bool AirplaneInfoWriter::properlyInitialized() const {
+    return this == init;
+}
+
+AirplaneInfoWriter::AirplaneInfoWriter(std::ostream& _stream)
+        : stream(_stream),
+          offset(0),
+          numbers(),
+          offsets(),
+          lengths(),
+          closed(false),
+          init(this) {
+    ENSURE(properlyInitialized(), "AirplaneInfoWriter was not properly initialized.");
+}
+
+AirplaneInfoWriter::~AirplaneInfoWriter() {
+    if (!closed) close();
+}
+
+void AirplaneInfoWriter::add(const Airplane* airplane) {
+    REQUIRE(properlyInitialized(), "AirplaneInfoWriter was not properly initialized.");
+    REQUIRE(airplane != NULL, "Airplane can not be NULL.");
+    REQUIRE(!isClosed(), "AirplaneInfoWriter is already closed.");
+
+    std::ostringstream record;
+    airplane->printInfo(record);
+    const std::string text = record.str();
+
+    stream.write(text.data(), text.size());
+    numbers.push_back(airplane->getNumber());
+    offsets.push_back(offset);
+    lengths.push_back(text.size());
+    offset += text.size();
+}
+
+void AirplaneInfoWriter::close() {
+    REQUIRE(properlyInitialized(), "AirplaneInfoWriter was not properly initialized.");
+    if (closed) return;
+
+    stream << "airplanes " << numbers.size() << '\n';
+    for (unsigned long i = 0; i < numbers.size(); i++) {
+        stream << offsets[i] << ' ' << lengths[i] << ' ' << numbers[i] << '\n';
+    }
+    stream << "index " << std::setw(20) << std::setfill('0') << offset << std::setfill(' ') << '\n';
+    stream.flush();
+    closed = true;
+
+    ENSURE(isClosed(), "AirplaneInfoWriter was not closed.");
+}
+
+bool AirplaneInfoWriter::isClosed() const {
+    return closed;
+}
+
+bool AirplaneInfoReader::properlyInitialized() const {
+    return this == init;
+}
+
+AirplaneInfoReader::AirplaneInfoReader(std::istream& _stream) : stream(_stream), index(), valid(false), init(this) {
+    stream.seekg(0, std::ios::end);
+    const std::streamoff size = stream.tellg();
+
+    if (size >= static_cast<std::streamoff>(AirplaneInfoWriter::kTrailerLength)) {
+        std::string trailer(AirplaneInfoWriter::kTrailerLength, '\0');
+        stream.seekg(size - AirplaneInfoWriter::kTrailerLength);
+        stream.read(&trailer[0], AirplaneInfoWriter::kTrailerLength);
+
+        std::istringstream trailerFields(trailer);
+        std::string keyword;
+        unsigned long long tableOffset = 0;
+
+        if (trailerFields >> keyword >> tableOffset && keyword == "index" && tableOffset < static_cast<unsigned long long>(size)) {
+            stream.seekg(tableOffset);
+
+            unsigned long count = 0;
+            if (stream >> keyword >> count && keyword == "airplanes") {
+                valid = true;
+                for (unsigned long i = 0; i < count && valid; i++) {
+                    std::string number;
+                    unsigned long long recordOffset = 0;
+                    unsigned long long recordLength = 0;
+                    valid = (stream >> recordOffset >> recordLength) && stream.ignore(1) && std::getline(stream, number) && recordOffset + recordLength <= tableOffset;
+                    index[number] = std::make_pair(recordOffset, recordLength);
+                }
+            }
+        }
+    }
+
+    if (!valid) index.clear();
+    stream.clear();
+
+    ENSURE(properlyInitialized(), "AirplaneInfoReader was not properly initialized.");
+}
+
+bool AirplaneInfoReader::isValid() const {
+    REQUIRE(properlyInitialized(), "AirplaneInfoReader was not properly initialized.");
+    return valid;
+}
+
+unsigned long AirplaneInfoReader::getCount() const {
+    REQUIRE(properlyInitialized(), "AirplaneInfoReader was not properly initialized.");
+    return index.size();
+}
+
+std::vector<std::string> AirplaneInfoReader::getNumbers() const {
+    REQUIRE(properlyInitialized(), "AirplaneInfoReader was not properly initialized.");
+
+    std::vector<std::string> numbers;
+    for (std::map<std::string, std::pair<unsigned long long, unsigned long long> >::const_iterator it_record = index.begin(); it_record != index.end(); it_record++) {
+        numbers.push_back(it_record->first);
+    }
+    return numbers;
+}
+
+bool AirplaneInfoReader::read(const std::string& number, std::string& record) {
+    REQUIRE(properlyInitialized(), "AirplaneInfoReader was not properly initialized.");
+
+    std::map<std::string, std::pair<unsigned long long, unsigned long long> >::const_iterator it_record = index.find(number);
+    if (it_record == index.end()) return false;
+
+    record.assign(it_record->second.second, '\0');
+    stream.clear();
+    stream.seekg(it_record->second.first);
+    if (!record.empty()) stream.read(&record[0], record.size());
+    return !stream.fail();
+}
@@ -0,0 +1,127 @@
+#ifndef INC_AIRPLANEINFOFILE_H
+#define INC_AIRPLANEINFOFILE_H
+
+#include "../lib/DesignByContract.h"
+#include "Airplane.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+
+/**
+ * Writes the printInfo records of all airplanes of an airport into one file. \n
+ * The records are written back to back, followed by an offset table and a fixed length trailer: \n
+ * airplanes COUNT \n
+ * OFFSET LENGTH NUMBER (one line per record, the number is the rest of the line and may contain spaces) \n
+ * index TABLEOFFSET (20 digits) \n
+ * The records read exactly like the separate airplanes/NUMBER.txt files, the table gives random access to them.
+ */
+class AirplaneInfoWriter {
+private:
+    std::ostream& stream;
+    unsigned long long offset;
+    std::vector<std::string> numbers;
+    std::vector<unsigned long long> offsets;
+    std::vector<unsigned long long> lengths;
+    bool closed;
+
+    const AirplaneInfoWriter* init;
+
+    bool properlyInitialized() const;
+
+    AirplaneInfoWriter(const AirplaneInfoWriter&);
+
+    AirplaneInfoWriter& operator=(const AirplaneInfoWriter&);
+
+public:
+    /**
+     * The length of the trailer line, it is the last line of the file
+     */
+    static const unsigned int kTrailerLength = 27;
+
+    /**
+     * POST: \n
+     * ENSURE(properlyInitialized(), "AirplaneInfoWriter was not properly initialized.");
+     * @param _stream The stream has to be empty, offsets are counted from its start
+     */
+    AirplaneInfoWriter(std::ostream& _stream);
+
+    /**
+     * Closes the writer when that was not done yet
+     */
+    ~AirplaneInfoWriter();
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AirplaneInfoWriter was not properly initialized."); \n
+     * REQUIRE(airplane != NULL, "Airplane can not be NULL."); \n
+     * REQUIRE(!isClosed(), "AirplaneInfoWriter is already closed.");
+     */
+    void add(const Airplane* airplane);
+
+    /**
+     * Writes the offset table and the trailer \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AirplaneInfoWriter was not properly initialized."); \n
+     * POST: \n
+     * ENSURE(isClosed(), "AirplaneInfoWriter was not closed.");
+     */
+    void close();
+
+    bool isClosed() const;
+};
+
+/**
+ * Reads single records from a file written by AirplaneInfoWriter, only the offset table is read up front
+ */
+class AirplaneInfoReader {
+private:
+    std::istream& stream;
+    std::map<std::string, std::pair<unsigned long long, unsigned long long> > index;
+    bool valid;
+
+    const AirplaneInfoReader* init;
+
+    bool properlyInitialized() const;
+
+    AirplaneInfoReader(const AirplaneInfoReader&);
+
+    AirplaneInfoReader& operator=(const AirplaneInfoReader&);
+
+public:
+    /**
+     * Reads the trailer and the offset table, a stream without them is not valid \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "AirplaneInfoReader was not properly initialized.");
+     */
+    AirplaneInfoReader(std::istream& _stream);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AirplaneInfoReader was not properly initialized.");
+     */
+    bool isValid() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AirplaneInfoReader was not properly initialized.");
+     */
+    unsigned long getCount() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AirplaneInfoReader was not properly initialized.");
+     * @return the numbers of all airplanes in the file, sorted
+     */
+    std::vector<std::string> getNumbers() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AirplaneInfoReader was not properly initialized.");
+     * @return false if the airplane is not in the file
+     */
+    bool read(const std::string& number, std::string& record);
+};
+
+#endif
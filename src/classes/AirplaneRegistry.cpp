@@ -0,0 +1,223 @@
+#include "AirplaneRegistry.h"
+
+const AirplaneRegistry::Handle AirplaneRegistry::kInvalidHandle = static_cast<AirplaneRegistry::Handle>(-1);
+
+bool AirplaneRegistry::properlyInitialized() const {
+    return this == init;
+}
+
+AirplaneRegistry::AirplaneRegistry()
+        : slots(std::vector<Slot>()),
+          usedSlots(0),
+          removedSlots(0),
+          handles(AirplaneVector()),
+          freeHandles(std::vector<Handle>()),
+          count(0),
+          ordered(AirplaneMap()),
+          orderedStale(false),
+          init(this) {
+    pthread_mutex_init(&orderedLock, NULL);
+    rehash(16);
+    ENSURE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+}
+
+AirplaneRegistry::AirplaneRegistry(const AirplaneRegistry& registry)
+        : slots(registry.slots),
+          usedSlots(registry.usedSlots),
+          removedSlots(registry.removedSlots),
+          handles(registry.handles),
+          freeHandles(registry.freeHandles),
+          count(registry.count),
+          ordered(registry.getOrdered()),
+          orderedStale(false),
+          init(this) {
+    pthread_mutex_init(&orderedLock, NULL);
+    ENSURE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+}
+
+AirplaneRegistry& AirplaneRegistry::operator=(const AirplaneRegistry& registry) {
+    if (this != &registry) {
+        slots = registry.slots;
+        usedSlots = registry.usedSlots;
+        removedSlots = registry.removedSlots;
+        handles = registry.handles;
+        freeHandles = registry.freeHandles;
+        count = registry.count;
+        ordered = registry.getOrdered();
+        orderedStale = false;
+    }
+    return *this;
+}
+
+AirplaneRegistry::~AirplaneRegistry() {
+    pthread_mutex_destroy(&orderedLock);
+}
+
+unsigned int AirplaneRegistry::hashNumber(const std::string& number) {
+    // 32-bit FNV-1a
+    unsigned int hash = 2166136261u;
+    for (std::string::const_iterator it_char = number.begin(); it_char != number.end(); it_char++) {
+        hash ^= static_cast<unsigned char>(*it_char);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+unsigned long AirplaneRegistry::findSlot(const std::string& number, const unsigned int hash) const {
+    const unsigned long mask = slots.size() - 1;
+
+    for (unsigned long i = hash & mask; ; i = (i + 1) & mask) {
+        const Slot& slot = slots[i];
+        if (slot.state == kSlot_Empty) return i;
+        if (slot.state == kSlot_Used && slot.hash == hash && handles[slot.handle]->getNumber() == number) return i;
+    }
+}
+
+void AirplaneRegistry::rehash(const unsigned long capacity) {
+    Slot emptySlot;
+    emptySlot.state = kSlot_Empty;
+    emptySlot.hash = 0;
+    emptySlot.handle = kInvalidHandle;
+
+    slots.assign(capacity, emptySlot);
+    usedSlots = 0;
+    removedSlots = 0;
+
+    const unsigned long mask = capacity - 1;
+
+    for (Handle handle = 0; handle < handles.size(); handle++) {
+        if (handles[handle] == NULL) continue;
+
+        const unsigned int hash = hashNumber(handles[handle]->getNumber());
+        unsigned long i = hash & mask;
+        while (slots[i].state != kSlot_Empty) i = (i + 1) & mask;
+
+        slots[i].state = kSlot_Used;
+        slots[i].hash = hash;
+        slots[i].handle = handle;
+        usedSlots++;
+    }
+}
+
+AirplaneRegistry::Handle AirplaneRegistry::insert(Airplane* airplane) {
+    REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+    REQUIRE(airplane != NULL, "Referenced Airplane is a nullpointer.");
+    REQUIRE(find(airplane->getNumber()) == kInvalidHandle, "Found Airplanes with duplicate registration.");
+
+    // keep the load factor (including removed markers) at or below one half
+    if ((usedSlots + removedSlots + 1) * 2 > slots.size()) {
+        unsigned long capacity = slots.size();
+        while ((usedSlots + 1) * 2 > capacity) capacity *= 2;
+        rehash(capacity);
+    }
+
+    Handle handle = handles.size();
+    if (freeHandles.empty()) {
+        handles.push_back(airplane);
+    } else {
+        handle = freeHandles.back();
+        freeHandles.pop_back();
+        handles[handle] = airplane;
+    }
+    count++;
+    orderedStale = true;
+
+    const unsigned int hash = hashNumber(airplane->getNumber());
+    const unsigned long mask = slots.size() - 1;
+    unsigned long i = hash & mask;
+    while (slots[i].state == kSlot_Used) i = (i + 1) & mask;
+
+    if (slots[i].state == kSlot_Removed) removedSlots--;
+    slots[i].state = kSlot_Used;
+    slots[i].hash = hash;
+    slots[i].handle = handle;
+    usedSlots++;
+
+    ENSURE(get(handle) == airplane, "Referenced Airplane was not properly added.");
+    return handle;
+}
+
+bool AirplaneRegistry::remove(const std::string& number) {
+    REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+
+    const unsigned long i = findSlot(number, hashNumber(number));
+    if (slots[i].state != kSlot_Used) return false;
+
+    handles[slots[i].handle] = NULL;
+    freeHandles.push_back(slots[i].handle);
+    count--;
+    orderedStale = true;
+
+    slots[i].state = kSlot_Removed;
+    slots[i].handle = kInvalidHandle;
+    usedSlots--;
+    removedSlots++;
+
+    return true;
+}
+
+AirplaneRegistry::Handle AirplaneRegistry::find(const std::string& number) const {
+    REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+    const Slot& slot = slots[findSlot(number, hashNumber(number))];
+    return slot.state == kSlot_Used ? slot.handle : kInvalidHandle;
+}
+
+Airplane* AirplaneRegistry::get(const Handle handle) const {
+    REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+    return handle < handles.size() ? handles[handle] : NULL;
+}
+
+Airplane* AirplaneRegistry::lookup(const std::string& number) const {
+    REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+    return get(find(number));
+}
+
+bool AirplaneRegistry::contains(const Airplane* airplane) const {
+    REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+    return airplane != NULL && lookup(airplane->getNumber()) == airplane;
+}
+
+const AirplaneMap& AirplaneRegistry::getOrdered() const {
+    REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+
+    // an Airport shared between threads is only read, the first reader builds the view and the others wait for it
+    if (__atomic_load_n(&orderedStale, __ATOMIC_ACQUIRE)) {
+        pthread_mutex_lock(&orderedLock);
+        if (orderedStale) {
+            ordered.clear();
+            for (AirplaneVector::const_iterator it_airplane = handles.begin(); it_airplane != handles.end(); it_airplane++) {
+                if (*it_airplane != NULL) ordered[(*it_airplane)->getNumber()] = *it_airplane;
+            }
+            __atomic_store_n(&orderedStale, false, __ATOMIC_RELEASE);
+        }
+        pthread_mutex_unlock(&orderedLock);
+    }
+
+    return ordered;
+}
+
+unsigned long AirplaneRegistry::getHandleCount() const {
+    REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+    return handles.size();
+}
+
+unsigned long AirplaneRegistry::size() const {
+    REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+    return count;
+}
+
+bool AirplaneRegistry::empty() const {
+    REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+    return count == 0;
+}
+
+void AirplaneRegistry::clear() {
+    REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+    handles.clear();
+    freeHandles.clear();
+    count = 0;
+    ordered.clear();
+    orderedStale = false;
+    rehash(16);
+    ENSURE(empty(), "AirplaneRegistry was not properly cleared.");
+}
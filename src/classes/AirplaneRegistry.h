@@ -0,0 +1,159 @@
+#ifndef INC_AIRPLANEREGISTRY_H
+#define INC_AIRPLANEREGISTRY_H
+
+#include "../lib/DesignByContract.h"
+#include "../utils/Utils.h"
+#include "Airplane.h"
+
+#include <pthread.h>
+#include <string>
+#include <vector>
+
+/**
+ * Registration number -> Airplane index of an Airport. \n
+ * Lookups go through an open-addressing (linear probing) hash table that resolves to a handle,
+ * the handle being the position of the Airplane in a dense vector whose freed entries are reused. \n
+ * The AirplaneMap ordered by registration number is only built when it is asked for after a change,
+ * inserting and removing never touch it.
+ */
+class AirplaneRegistry {
+public:
+    typedef unsigned long Handle;
+
+    static const Handle kInvalidHandle;
+
+private:
+    enum ESlotState {
+        kSlot_Empty,
+        kSlot_Used,
+        kSlot_Removed
+    };
+
+    struct Slot {
+        ESlotState state;
+        unsigned int hash;
+        Handle handle;
+    };
+
+    std::vector<Slot> slots;
+    unsigned long usedSlots;
+    unsigned long removedSlots;
+
+    AirplaneVector handles;
+    std::vector<Handle> freeHandles;
+    unsigned long count;
+
+    /**
+     * Rebuilt by getOrdered when stale, the lock keeps readers of a shared const registry from building it together
+     */
+    mutable AirplaneMap ordered;
+    mutable bool orderedStale;
+    mutable pthread_mutex_t orderedLock;
+
+    const AirplaneRegistry* init;
+
+    bool properlyInitialized() const;
+
+    static unsigned int hashNumber(const std::string& number);
+
+    unsigned long findSlot(const std::string& number, unsigned int hash) const;
+
+    void rehash(unsigned long capacity);
+
+public:
+    /**
+     * POST: \n
+     * ENSURE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+     */
+    AirplaneRegistry();
+
+    /**
+     * Copies the index, the Airplanes themselves are shared \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+     */
+    AirplaneRegistry(const AirplaneRegistry& registry);
+
+    AirplaneRegistry& operator=(const AirplaneRegistry& registry);
+
+    ~AirplaneRegistry();
+
+    /**
+     * Adds an Airplane to the registry, reusing the handle of a removed Airplane when there is one \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized."); \n
+     * REQUIRE(airplane != NULL, "Referenced Airplane is a nullpointer."); \n
+     * REQUIRE(find(airplane->getNumber()) == kInvalidHandle, "Found Airplanes with duplicate registration."); \n
+     * POST: \n
+     * ENSURE(get(handle) == airplane, "Referenced Airplane was not properly added.");
+     * @return the handle of the added Airplane
+     */
+    Handle insert(Airplane* airplane);
+
+    /**
+     * Removes an Airplane from the registry, its handle resolves to NULL until a later insert reuses it \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+     * @return true if an Airplane with the given registration was removed
+     */
+    bool remove(const std::string& number);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+     * @return the handle of the Airplane with the given registration, kInvalidHandle if unknown
+     */
+    Handle find(const std::string& number) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+     * @return the Airplane behind the handle, NULL if the handle is invalid or the Airplane was removed
+     */
+    Airplane* get(Handle handle) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+     * @return the Airplane with the given registration, NULL if unknown
+     */
+    Airplane* lookup(const std::string& number) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+     * @return true if this exact Airplane is registered under its registration number
+     */
+    bool contains(const Airplane* airplane) const;
+
+    /**
+     * Builds the view again if Airplanes were inserted or removed since it was last asked for, iterators of an
+     * earlier view are invalidated by that \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+     * @return the Airplanes ordered by registration number
+     */
+    const AirplaneMap& getOrdered() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized.");
+     * @return one past the largest handle handed out so far
+     */
+    unsigned long getHandleCount() const;
+
+    unsigned long size() const;
+
+    bool empty() const;
+
+    /**
+     * Forgets every Airplane, does not delete them \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AirplaneRegistry was not properly initialized."); \n
+     * POST: \n
+     * ENSURE(empty(), "AirplaneRegistry was not properly cleared.");
+     */
+    void clear();
+};
+
+#endif
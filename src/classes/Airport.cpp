@@ -11,7 +11,7 @@ Airport::Airport(const std::string& _airportName,
         : airportName(_airportName),
           iata(_iata),
           callsign(_callsign),
-          airplanes(AirplaneMap()),
+          airplanes(),
           runways(RunwayMap()),
           locations(LocationMap()),
           gates(AirplaneVector(_gates)),
@@ -25,7 +25,7 @@ Airport::Airport(const Airport* _airport)
         : airportName(_airport->getAirportName()),
           iata(_airport->getIata()),
           callsign(_airport->getCallsign()),
-          airplanes(AirplaneMap()),
+          airplanes(),
           runways(RunwayMap()),
           locations(LocationMap()),
           gates(_airport->getGateCount()),
@@ -77,13 +77,16 @@ Airport::Airport(const Airport* _airport)
             originalQueue.pop();
         }
 
-        airplanes[newAirplane->getNumber()] = newAirplane;
+        airplanes.insert(newAirplane);
+    }
 
-        const AirplaneVector& _gates = _airport->getGates();
-        for (unsigned int i = 0; i < gates.size() && i < _gates.size(); i++) {
-            if (_gates[i] != NULL && _gates[i]->getNumber() == newAirplane->getNumber()) {
-                gates[i] = newAirplane;
-            }
+    // setAirport resets the gate of the copies, a copied Airplane standing at a gate has to know it again
+    const AirplaneVector& _gates = _airport->getGates();
+    for (unsigned int i = 0; i < gates.size() && i < _gates.size(); i++) {
+        if (_gates[i] != NULL) {
+            Airplane* newAirplane = airplanes.lookup(_gates[i]->getNumber());
+            gates[i] = newAirplane;
+            if (newAirplane != NULL) newAirplane->setGate(i);
         }
     }
 
@@ -119,7 +122,7 @@ Airport::Airport(const Airport* _airport)
 }
 
 Airport::~Airport() {
-    for (AirplaneMap::iterator it = airplanes.begin(); it != airplanes.end(); it++) {
+    for (AirplaneMap::const_iterator it = airplanes.getOrdered().begin(); it != airplanes.getOrdered().end(); it++) {
         delete (*it).second;
     }
     airplanes.clear();
@@ -150,39 +153,43 @@ const std::string& Airport::getCallsign() const {
 
 const AirplaneMap& Airport::getAirplanes() const {
     REQUIRE(properlyInitialized(), "Airport was not properly initialized.");
-    return airplanes;
+    return airplanes.getOrdered();
 }
 
-AirplaneMap& Airport::getAirplanes() {
+const AirplaneRegistry& Airport::getAirplaneRegistry() const {
     REQUIRE(properlyInitialized(), "Airport was not properly initialized.");
     return airplanes;
 }
 
 const Airplane* Airport::getAirplanesByRegistrationNumber(const std::string& number) const {
     REQUIRE(properlyInitialized(), "Airport was not properly initialized.");
-    if (airplanes.find(number) == airplanes.end()) {
-        return NULL;
-    } else {
-        return airplanes.at(number);
-    }
+    return airplanes.lookup(number);
 }
 
 Airplane* Airport::getAirplanesByRegistrationNumber(const std::string& number) {
     REQUIRE(properlyInitialized(), "Airport was not properly initialized.");
-    if (airplanes.find(number) == airplanes.end()) {
-        return NULL;
-    } else {
-        return airplanes.at(number);
-    }
+    return airplanes.lookup(number);
 }
 
 void Airport::addAirplane(Airplane* airplane) {
     REQUIRE(properlyInitialized(), "Airport was not properly initialized.");
     REQUIRE(airplane != NULL, "Referenced Airplane is a nullpointer.");
     REQUIRE(airplane->getAirport() == this, "Referenced Airplane does not have a link to the current airport.");
-    REQUIRE(airplanes[airplane->getNumber()] == NULL, "Found Airplanes with duplicate registration.");
-    airplanes[airplane->getNumber()] = airplane;
-    ENSURE(airplanes[airplane->getNumber()] == airplane, "Referenced Airplane was not properly added.");
+    REQUIRE(airplanes.lookup(airplane->getNumber()) == NULL, "Found Airplanes with duplicate registration.");
+    airplanes.insert(airplane);
+    ENSURE(airplanes.lookup(airplane->getNumber()) == airplane, "Referenced Airplane was not properly added.");
+}
+
+void Airport::removeAirplane(Airplane* airplane) {
+    REQUIRE(properlyInitialized(), "Airport was not properly initialized.");
+    REQUIRE(airplanes.contains(airplane), "Referenced airplane is not linked to Airport.");
+    airplanes.remove(airplane->getNumber());
+    ENSURE(!airplanes.contains(airplane), "Referenced Airplane was not properly removed.");
+}
+
+bool Airport::hasAirplane(const Airplane* airplane) const {
+    REQUIRE(properlyInitialized(), "Airport was not properly initialized.");
+    return airplanes.contains(airplane);
 }
 
 const RunwayMap& Airport::getRunways() const {
@@ -353,10 +360,20 @@ const unsigned long Airport::getGateCount() const {
     return gates.size();
 }
 
+void Airport::setGateCount(const unsigned long _gateCount) {
+    REQUIRE(properlyInitialized(), "Airport was not properly initialized.");
+    for (unsigned long i = _gateCount; i < gates.size(); i++) {
+        REQUIRE(gates[i] == NULL, "Gates that are in use can not be removed.");
+    }
+
+    gates.resize(_gateCount, NULL);
+    ENSURE(getGateCount() == _gateCount, "Gate count was not properly set.");
+}
+
 bool Airport::reserveGate(Airplane* _airplane) {
     REQUIRE(properlyInitialized(), "Airport was not properly initialized.");
     REQUIRE(_airplane != NULL, "Referenced Airplane is a nullpointer.");
-    REQUIRE(mapContains(airplanes, _airplane->getNumber(), _airplane), "Referenced airplane is not linked to Airport.");
+    REQUIRE(airplanes.contains(_airplane), "Referenced airplane is not linked to Airport.");
     REQUIRE(_airplane->getAirport() == this, "Referenced Airplane is not linked to Airport.");
     REQUIRE(_airplane->getStatus() == AirplaneEnums::kStatus_TaxiingToApron, "Referenced Airplane is not waiting for a gate.");
     REQUIRE(_airplane->getGate() == -1, "Referenced Airplane already has a gate assigned.");
@@ -377,7 +394,7 @@ bool Airport::reserveGate(Airplane* _airplane) {
 void Airport::exitGate(Airplane* _airplane) {
     REQUIRE(properlyInitialized(), "Airport was not properly initialized.");
     REQUIRE(_airplane != NULL, "Referenced Airplane is a nullpointer.");
-    REQUIRE(mapContains(airplanes, _airplane->getNumber(), _airplane), "Referenced airplane is not linked to Airport.");
+    REQUIRE(airplanes.contains(_airplane), "Referenced airplane is not linked to Airport.");
     REQUIRE(_airplane->getAirport() == this, "Airplane is not linked to Airport.");
     REQUIRE(_airplane->getGate() != -1, "Airplane is not properly linked to gate.");
     REQUIRE(gates[_airplane->getGate()] == _airplane, "Airplane is not properly linked to gate.");
@@ -400,7 +417,7 @@ const Airplane* Airport::get3000ft() const {
 
 void Airport::set3000ft(Airplane* _airplane) {
     REQUIRE(properlyInitialized(), "Airport was not properly initialized.");
-    REQUIRE(_airplane == NULL || mapContains(airplanes, _airplane->getNumber(), _airplane), "Referenced Airplane is not recognized by this airport and not a nullpointer.");
+    REQUIRE(_airplane == NULL || airplanes.contains(_airplane), "Referenced Airplane is not recognized by this airport and not a nullpointer.");
     ft3000 = _airplane;
 }
 
@@ -416,7 +433,7 @@ const Airplane* Airport::get5000ft() const {
 
 void Airport::set5000ft(Airplane* _airplane) {
     REQUIRE(properlyInitialized(), "Airport was not properly initialized.");
-    REQUIRE(_airplane == NULL || mapContains(airplanes, _airplane->getNumber(), _airplane), "Referenced Airplane is not recognized by this airport and not a nullpointer.");
+    REQUIRE(_airplane == NULL || airplanes.contains(_airplane), "Referenced Airplane is not recognized by this airport and not a nullpointer.");
     ft5000 = _airplane;
 }
 
@@ -513,7 +530,7 @@ void Airport::printGraphicalImpression(std::ostream& stream) const {
             unsigned int holdingShortAirplanes = 0;
             unsigned int taxiingAirplanes = 0;
 
-            for (AirplaneMap::const_iterator it_airplane = airplanes.begin(); it_airplane != airplanes.end(); it_airplane++) {
+            for (AirplaneMap::const_iterator it_airplane = airplanes.getOrdered().begin(); it_airplane != airplanes.getOrdered().end(); it_airplane++) {
                 if (currentLocation == it_airplane->second->getCurrentLocation()) {
                     switch (it_airplane->second->getStatus()) {
                         case AirplaneEnums::kStatus_HoldingShort:
@@ -6,6 +6,7 @@
 #include "Location.h"
 #include "Runway.h"
 #include "Airplane.h"
+#include "AirplaneRegistry.h"
 
 #include <string>
 #include <vector>
@@ -17,7 +18,7 @@ private:
     const std::string iata;
     const std::string callsign;
 
-    AirplaneMap airplanes;
+    AirplaneRegistry airplanes;
     RunwayMap runways;
     LocationMap locations;
     AirplaneVector gates;
@@ -56,16 +57,52 @@ public:
     const std::string& getCallsign() const;
 
 
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Airport was not properly initialized.");
+     * @return the Airplanes of this Airport, ordered by registration number
+     */
     const AirplaneMap& getAirplanes() const;
 
-    AirplaneMap& getAirplanes();
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Airport was not properly initialized.");
+     * @return the registration index of this Airport
+     */
+    const AirplaneRegistry& getAirplaneRegistry() const;
 
     const Airplane* getAirplanesByRegistrationNumber(const std::string& number) const;
 
     Airplane* getAirplanesByRegistrationNumber(const std::string& number);
 
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Airport was not properly initialized."); \n
+     * REQUIRE(airplane != NULL, "Referenced Airplane is a nullpointer."); \n
+     * REQUIRE(airplane->getAirport() == this, "Referenced Airplane does not have a link to the current airport."); \n
+     * REQUIRE(getAirplanesByRegistrationNumber(airplane->getNumber()) == NULL, "Found Airplanes with duplicate registration."); \n
+     * POST: \n
+     * ENSURE(getAirplanesByRegistrationNumber(airplane->getNumber()) == airplane, "Referenced Airplane was not properly added.");
+     */
     void addAirplane(Airplane* _airplane);
 
+    /**
+     * Unlinks the Airplane from this Airport, the caller becomes responsible for deleting it \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Airport was not properly initialized."); \n
+     * REQUIRE(hasAirplane(airplane), "Referenced airplane is not linked to Airport."); \n
+     * POST: \n
+     * ENSURE(!hasAirplane(airplane), "Referenced Airplane was not properly removed.");
+     */
+    void removeAirplane(Airplane* _airplane);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Airport was not properly initialized.");
+     * @return true if this exact Airplane is registered at this Airport
+     */
+    bool hasAirplane(const Airplane* _airplane) const;
+
 
     const RunwayMap& getRunways() const;
 
@@ -103,6 +140,16 @@ public:
 
     const unsigned long getGateCount() const;
 
+    /**
+     * Adds or removes gates at the end \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Airport was not properly initialized."); \n
+     * REQUIRE(gates beyond _gateCount are free, "Gates that are in use can not be removed."); \n
+     * POST: \n
+     * ENSURE(getGateCount() == _gateCount, "Gate count was not properly set.");
+     */
+    void setGateCount(const unsigned long _gateCount);
+
     bool reserveGate(Airplane* _airplane);
 
     void exitGate(Airplane* _airplane);
@@ -0,0 +1,300 @@
+#include "AllocationTracker.h"
+
+#include <iomanip>
+#include <algorithm>
+#include <string>
+#include <map>
+#include <new>
+#include <cstdlib>
+#include <cstring>
+#include <cxxabi.h>
+#include <execinfo.h>
+
+namespace {
+    __thread AllocationTracker* activeTracker = NULL;
+
+    // set while the tracker itself allocates, those allocations are not counted
+    __thread bool insideTracker = false;
+
+    /**
+     * Returns the demangled function of a backtrace_symbols line without its arguments, or the raw line when it has no symbol
+     */
+    std::string frameName(const std::string& line) {
+        std::string::size_type open = line.find('(');
+        std::string::size_type plus = line.find('+', open);
+        if (open == std::string::npos || plus == std::string::npos || plus == open + 1) return line;
+
+        std::string mangled = line.substr(open + 1, plus - open - 1);
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(mangled.c_str(), NULL, NULL, &status);
+        std::string name = (status == 0 && demangled != NULL ? demangled : mangled);
+        std::free(demangled);
+
+        return name.substr(0, name.find('('));
+    }
+
+    bool isLibraryFrame(const std::string& line, const std::string& name) {
+        return line.find("libstdc++") != std::string::npos
+            || line.find("libc.so") != std::string::npos
+            || name.find("std::") != std::string::npos
+            || name.find("__gnu_cxx") != std::string::npos
+            || name.find("operator new") == 0
+            || name.find("AllocationTracker") == 0;
+    }
+
+    bool compareSites(const std::pair<std::string, std::pair<unsigned long, unsigned long long> >& left,
+                      const std::pair<std::string, std::pair<unsigned long, unsigned long long> >& right) {
+        return left.second.first > right.second.first;
+    }
+}
+
+bool AllocationTracker::properlyInitialized() const {
+    return this == init;
+}
+
+AllocationTracker::AllocationTracker(const bool _recordCallSites)
+        : phase(kOtherPhase),
+          frees(0),
+          tickAllocations(0),
+          tickBytes(0),
+          perTickAllocations(),
+          perTickBytes(),
+          recordCallSites(_recordCallSites),
+          callSites(new CallSite[kCallSiteSlots]),
+          droppedCallSites(0),
+          previous(activeTracker),
+          init(this) {
+    REQUIRE(getActive() == NULL, "Only one AllocationTracker can be active per thread.");
+
+    for (unsigned int bucket = 0; bucket <= kOtherPhase; bucket++) {
+        allocations[bucket] = 0;
+        bytes[bucket] = 0;
+    }
+    std::memset(callSites, 0, sizeof(CallSite) * kCallSiteSlots);
+
+    // the first backtrace loads the unwinder, which allocates
+    void* warmup[2];
+    backtrace(warmup, 2);
+
+    activeTracker = this;
+
+    ENSURE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+    ENSURE(getActive() == this, "AllocationTracker was not activated.");
+}
+
+AllocationTracker::~AllocationTracker() {
+    activeTracker = previous;
+    delete[] callSites;
+}
+
+AllocationTracker* AllocationTracker::getActive() {
+    return activeTracker;
+}
+
+void AllocationTracker::onAllocate(const std::size_t size) {
+    AllocationTracker* tracker = activeTracker;
+    if (tracker == NULL || insideTracker) return;
+
+    insideTracker = true;
+    tracker->allocations[tracker->phase]++;
+    tracker->bytes[tracker->phase] += size;
+    tracker->tickAllocations++;
+    tracker->tickBytes += size;
+    if (tracker->recordCallSites) tracker->recordCallSite(size);
+    insideTracker = false;
+}
+
+void AllocationTracker::onFree() {
+    AllocationTracker* tracker = activeTracker;
+    if (tracker == NULL || insideTracker) return;
+    tracker->frees++;
+}
+
+void AllocationTracker::recordCallSite(const std::size_t size) {
+    void* frames[kMaxFrames];
+    const int depth = backtrace(frames, kMaxFrames);
+    if (depth <= 0) return;
+
+    unsigned long hash = 2166136261UL;
+    for (int frame = 0; frame < depth; frame++) {
+        hash = (hash ^ reinterpret_cast<unsigned long>(frames[frame])) * 16777619UL;
+    }
+
+    // open addressing in a fixed table, recording must not allocate
+    for (unsigned int probe = 0; probe < 32; probe++) {
+        CallSite& site = callSites[(hash + probe) % kCallSiteSlots];
+
+        if (site.depth == 0) {
+            std::memcpy(site.frames, frames, sizeof(void*) * depth);
+            site.depth = depth;
+        } else if (site.depth != depth || std::memcmp(site.frames, frames, sizeof(void*) * depth) != 0) {
+            continue;
+        }
+
+        site.allocations++;
+        site.bytes += size;
+        return;
+    }
+
+    droppedCallSites++;
+}
+
+void AllocationTracker::setPhase(const ProfileEnums::EPhase _phase) {
+    REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+    phase = _phase;
+}
+
+void AllocationTracker::clearPhase() {
+    REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+    phase = kOtherPhase;
+}
+
+void AllocationTracker::endTick() {
+    REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+
+    const bool wasInside = insideTracker;
+    insideTracker = true;
+    perTickAllocations.push_back(tickAllocations);
+    perTickBytes.push_back(tickBytes);
+    insideTracker = wasInside;
+
+    tickAllocations = 0;
+    tickBytes = 0;
+}
+
+unsigned long AllocationTracker::getAllocations(const ProfileEnums::EPhase _phase) const {
+    REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+    return allocations[_phase];
+}
+
+unsigned long long AllocationTracker::getBytes(const ProfileEnums::EPhase _phase) const {
+    REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+    return bytes[_phase];
+}
+
+unsigned long AllocationTracker::getOtherAllocations() const {
+    REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+    return allocations[kOtherPhase];
+}
+
+unsigned long AllocationTracker::getFrees() const {
+    REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+    return frees;
+}
+
+const std::vector<unsigned long>& AllocationTracker::getTickAllocations() const {
+    REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+    return perTickAllocations;
+}
+
+void AllocationTracker::report(std::ostream& stream, const unsigned int topCallSites) const {
+    REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+
+    const bool wasInside = insideTracker;
+    insideTracker = true;
+
+    const unsigned long ticks = perTickAllocations.size();
+
+    stream << "Allocations over " << ticks << " ticks, " << frees << " frees" << std::endl << std::endl;
+
+    stream << std::left << std::setw(26) << "Phase" << std::right << std::setw(14) << "allocations" << std::setw(14) << "bytes" << std::setw(14) << "per tick" << std::endl;
+    for (unsigned int bucket = 0; bucket <= kOtherPhase; bucket++) {
+        stream << std::left << std::setw(26) << (bucket == kOtherPhase ? "Other" : ProfileEnums::EnumToString(static_cast<ProfileEnums::EPhase>(bucket))) << std::right
+               << std::setw(14) << allocations[bucket]
+               << std::setw(14) << bytes[bucket]
+               << std::setw(14) << (bucket == kOtherPhase || ticks == 0 ? 0 : allocations[bucket] / ticks) << std::endl;
+    }
+    stream << std::endl;
+
+    if (ticks > 0) {
+        std::vector<unsigned long> sorted(perTickAllocations);
+        std::sort(sorted.begin(), sorted.end());
+        const unsigned long zeroTicks = std::count(sorted.begin(), sorted.end(), 0UL);
+
+        stream << "Ticks without allocations: " << zeroTicks << " of " << ticks << std::endl;
+        stream << "Allocations per tick: min " << sorted.front() << ", median " << sorted[(ticks - 1) / 2] << ", max " << sorted.back() << std::endl;
+        stream << std::endl;
+    }
+
+    if (recordCallSites) {
+        std::map<std::string, std::pair<unsigned long, unsigned long long> > labels;
+
+        for (unsigned int slot = 0; slot < kCallSiteSlots; slot++) {
+            const CallSite& site = callSites[slot];
+            if (site.depth == 0) continue;
+
+            char** symbols = backtrace_symbols(const_cast<void* const*>(site.frames), site.depth);
+            std::string label = "unknown";
+            for (int frame = 0; symbols != NULL && frame < site.depth; frame++) {
+                const std::string name = frameName(symbols[frame]);
+                if (!isLibraryFrame(symbols[frame], name)) {
+                    label = name;
+                    break;
+                }
+            }
+            std::free(symbols);
+
+            labels[label].first += site.allocations;
+            labels[label].second += site.bytes;
+        }
+
+        std::vector<std::pair<std::string, std::pair<unsigned long, unsigned long long> > > sites(labels.begin(), labels.end());
+        std::sort(sites.begin(), sites.end(), compareSites);
+
+        stream << std::setw(14) << "allocations" << std::setw(14) << "bytes" << "  call site" << std::endl;
+        for (unsigned int i = 0; i < sites.size() && i < topCallSites; i++) {
+            stream << std::setw(14) << sites[i].second.first << std::setw(14) << sites[i].second.second << "  " << sites[i].first << std::endl;
+        }
+        if (droppedCallSites > 0) stream << droppedCallSites << " allocations did not fit in the call site table" << std::endl;
+    }
+
+    insideTracker = wasInside;
+}
+
+void* operator new(std::size_t size) throw(std::bad_alloc) {
+    AllocationTracker::onAllocate(size);
+    void* pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == NULL) throw std::bad_alloc();
+    return pointer;
+}
+
+void* operator new[](std::size_t size) throw(std::bad_alloc) {
+    AllocationTracker::onAllocate(size);
+    void* pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == NULL) throw std::bad_alloc();
+    return pointer;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) throw() {
+    AllocationTracker::onAllocate(size);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) throw() {
+    AllocationTracker::onAllocate(size);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* pointer) throw() {
+    if (pointer == NULL) return;
+    AllocationTracker::onFree();
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) throw() {
+    if (pointer == NULL) return;
+    AllocationTracker::onFree();
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) throw() {
+    if (pointer == NULL) return;
+    AllocationTracker::onFree();
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) throw() {
+    if (pointer == NULL) return;
+    AllocationTracker::onFree();
+    std::free(pointer);
+}
@@ -0,0 +1,149 @@
+#ifndef INC_ALLOCATIONTRACKER_H
+#define INC_ALLOCATIONTRACKER_H
+
+#include "../lib/DesignByContract.h"
+#include "SimulationProfile.h"
+
+#include <iostream>
+#include <vector>
+#include <cstddef>
+
+/**
+ * Counts the allocations made through the global operator new of the thread that created the tracker. \n
+ * The replaced operator new and delete only pass through to malloc and free while no tracker is active on the thread. \n
+ * Allocations are assigned to the phase set by the Simulator, allocations outside Simulate count as Other. \n
+ * Every allocation also records the call stack, the report groups them by the first frame outside the standard library.
+ */
+class AllocationTracker {
+private:
+    static const unsigned int kMaxFrames = 16;
+    static const unsigned int kCallSiteSlots = 4096;
+    static const unsigned int kOtherPhase = ProfileEnums::kPhaseCount;
+
+    struct CallSite {
+        void* frames[kMaxFrames];
+        int depth;
+        unsigned long allocations;
+        unsigned long long bytes;
+    };
+
+    unsigned int phase;
+
+    unsigned long allocations[kOtherPhase + 1];
+    unsigned long long bytes[kOtherPhase + 1];
+    unsigned long frees;
+
+    unsigned long tickAllocations;
+    unsigned long long tickBytes;
+    std::vector<unsigned long> perTickAllocations;
+    std::vector<unsigned long long> perTickBytes;
+
+    bool recordCallSites;
+    CallSite* callSites;
+    unsigned long droppedCallSites;
+
+    AllocationTracker* previous;
+
+    const AllocationTracker* init;
+
+    bool properlyInitialized() const;
+
+    void recordCallSite(const std::size_t size);
+
+    AllocationTracker(const AllocationTracker&);
+
+    AllocationTracker& operator=(const AllocationTracker&);
+
+public:
+    /**
+     * Starts tracking the allocations of the calling thread \n
+     * PRE: \n
+     * REQUIRE(getActive() == NULL, "Only one AllocationTracker can be active per thread."); \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "AllocationTracker was not properly initialized."); \n
+     * ENSURE(getActive() == this, "AllocationTracker was not activated.");
+     * @param _recordCallSites Capturing call stacks is the expensive part, disable it to only count
+     */
+    AllocationTracker(const bool _recordCallSites = true);
+
+    /**
+     * Stops tracking
+     */
+    ~AllocationTracker();
+
+    /**
+     * @return the tracker of the calling thread, NULL if there is none
+     */
+    static AllocationTracker* getActive();
+
+    /**
+     * Called by the replaced operator new
+     */
+    static void onAllocate(const std::size_t size);
+
+    /**
+     * Called by the replaced operator delete
+     */
+    static void onFree();
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+     */
+    void setPhase(const ProfileEnums::EPhase _phase);
+
+    /**
+     * Assigns the following allocations to Other \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+     */
+    void clearPhase();
+
+    /**
+     * Stores the allocations since the previous tick \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+     */
+    void endTick();
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+     */
+    unsigned long getAllocations(const ProfileEnums::EPhase _phase) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+     */
+    unsigned long long getBytes(const ProfileEnums::EPhase _phase) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+     * @return the allocations made outside of any phase
+     */
+    unsigned long getOtherAllocations() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+     */
+    unsigned long getFrees() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+     * @return the number of allocations of every ended tick
+     */
+    const std::vector<unsigned long>& getTickAllocations() const;
+
+    /**
+     * Writes the allocations per phase, the distribution per tick and the top allocating call sites \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "AllocationTracker was not properly initialized.");
+     */
+    void report(std::ostream& stream, const unsigned int topCallSites = 10) const;
+};
+
+#endif
@@ -0,0 +1,113 @@
+#include "AsyncRenderer.h"
+
+EventRenderer* AsyncRenderer::checkTarget(EventRenderer* target) {
+    REQUIRE(target != NULL, "Referenced EventRenderer is a nullpointer.");
+    return target;
+}
+
+AsyncRenderer::AsyncRenderer(EventRenderer* _target, const unsigned long _capacity)
+        : EventRenderer(checkTarget(_target)->getAirport(), checkTarget(_target)->getStream()),
+          target(_target),
+          ring(new SimulationEvent[_capacity]),
+          capacity(_capacity),
+          head(0),
+          tail(0),
+          stopping(false),
+          running(false) {
+    REQUIRE(_capacity > 0 && (_capacity & (_capacity - 1)) == 0, "Ring capacity must be a power of two.");
+
+    pthread_mutex_init(&lock, NULL);
+    pthread_cond_init(&notEmpty, NULL);
+    pthread_cond_init(&notFull, NULL);
+
+    running = pthread_create(&thread, NULL, &AsyncRenderer::run, this) == 0;
+
+    ENSURE(properlyInitialized(), "EventRenderer was not properly initialized.");
+}
+
+AsyncRenderer::~AsyncRenderer() {
+    if (running) {
+        pthread_mutex_lock(&lock);
+        stopping = true;
+        pthread_cond_signal(&notEmpty);
+        pthread_mutex_unlock(&lock);
+
+        pthread_join(thread, NULL);
+        running = false;
+    }
+    target->flush();
+
+    pthread_cond_destroy(&notFull);
+    pthread_cond_destroy(&notEmpty);
+    pthread_mutex_destroy(&lock);
+    delete[] ring;
+}
+
+void* AsyncRenderer::run(void* self) {
+    AsyncRenderer* renderer = static_cast<AsyncRenderer*>(self);
+
+    pthread_mutex_lock(&renderer->lock);
+    while (true) {
+        while (renderer->tail == renderer->head && !renderer->stopping) {
+            pthread_cond_wait(&renderer->notEmpty, &renderer->lock);
+        }
+        if (renderer->tail == renderer->head) break;
+
+        // the events up to the head are not touched by the Simulator thread until the tail has passed them
+        const unsigned long end = renderer->head;
+        pthread_mutex_unlock(&renderer->lock);
+
+        for (unsigned long position = renderer->tail; position != end; position++) {
+            renderer->target->render(renderer->ring[position & (renderer->capacity - 1)]);
+        }
+
+        pthread_mutex_lock(&renderer->lock);
+        renderer->tail = end;
+        pthread_cond_broadcast(&renderer->notFull);
+    }
+    pthread_mutex_unlock(&renderer->lock);
+
+    return NULL;
+}
+
+void AsyncRenderer::render(const SimulationEvent& event) {
+    REQUIRE(properlyInitialized(), "EventRenderer was not properly initialized.");
+
+    if (!running) {
+        target->render(event);
+        return;
+    }
+
+    pthread_mutex_lock(&lock);
+    while (head - tail == capacity) {
+        pthread_cond_wait(&notFull, &lock);
+    }
+
+    ring[head & (capacity - 1)] = event;
+    head++;
+    // a writer that still has events to render looks at the head again before it waits
+    if (head - tail == 1) pthread_cond_signal(&notEmpty);
+    pthread_mutex_unlock(&lock);
+}
+
+void AsyncRenderer::flush() {
+    REQUIRE(properlyInitialized(), "EventRenderer was not properly initialized.");
+
+    if (running) {
+        pthread_mutex_lock(&lock);
+        while (tail != head) {
+            pthread_cond_wait(&notFull, &lock);
+        }
+        pthread_mutex_unlock(&lock);
+    }
+
+    target->flush();
+}
+
+std::string AsyncRenderer::getName() const {
+    return target->getName();
+}
+
+bool AsyncRenderer::isRunning() const {
+    return running;
+}
@@ -0,0 +1,102 @@
+#ifndef INC_ASYNCRENDERER_H
+#define INC_ASYNCRENDERER_H
+
+#include "../lib/DesignByContract.h"
+#include "EventRenderer.h"
+#include "SimulationEvent.h"
+
+#include <pthread.h>
+
+/**
+ * Runs another renderer on a background thread. \n
+ * The Simulator thread only copies events into a bounded single-producer/single-consumer ring,
+ * formatting and writing happen on the writer thread so disk latency no longer stalls the simulation. \n
+ * An idle writer thread and a Simulator thread facing a full ring sleep on a condition variable, so neither burns
+ * the CPU that other simulations in the same pool need. \n
+ * Only renderers that read nothing but the event and the names of the Airport can be wrapped, the FloorplanRenderer
+ * draws the live Airport and must stay synchronous.
+ */
+class AsyncRenderer: public EventRenderer {
+private:
+    EventRenderer* target;
+
+    SimulationEvent* ring;
+    unsigned long capacity;
+
+    /**
+     * Events pushed by the producer and rendered by the consumer, both guarded by the lock
+     */
+    unsigned long head;
+    unsigned long tail;
+
+    bool stopping;
+    bool running;
+    pthread_t thread;
+
+    pthread_mutex_t lock;
+
+    /**
+     * Signalled by the Simulator thread when it pushed an event into an empty ring or stops the writer thread
+     */
+    pthread_cond_t notEmpty;
+
+    /**
+     * Broadcast by the writer thread when it rendered events, wakes a waiting render or flush
+     */
+    pthread_cond_t notFull;
+
+    static void* run(void* self);
+
+    /**
+     * Checks the target before the init list reads its Airport and stream
+     */
+    static EventRenderer* checkTarget(EventRenderer* target);
+
+    AsyncRenderer(const AsyncRenderer&);
+
+    AsyncRenderer& operator=(const AsyncRenderer&);
+
+public:
+    /**
+     * Starts the writer thread, when the thread cannot be started the target is rendered synchronously \n
+     * PRE: \n
+     * REQUIRE(_target != NULL, "Referenced EventRenderer is a nullpointer."); \n
+     * REQUIRE(_capacity > 0 && (_capacity & (_capacity - 1)) == 0, "Ring capacity must be a power of two."); \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "EventRenderer was not properly initialized.");
+     * @param _target The renderer run on the writer thread, must outlive the AsyncRenderer
+     * @param _capacity The number of events the ring can hold before the Simulator thread has to wait
+     */
+    AsyncRenderer(EventRenderer* _target, const unsigned long _capacity = 4096);
+
+    /**
+     * Renders the remaining events and stops the writer thread
+     */
+    ~AsyncRenderer();
+
+    /**
+     * Queues the event for the writer thread, waits while the ring is full \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "EventRenderer was not properly initialized.");
+     */
+    void render(const SimulationEvent& event);
+
+    /**
+     * Waits until the writer thread has rendered every queued event and flushes the target \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "EventRenderer was not properly initialized.");
+     */
+    void flush();
+
+    /**
+     * @return the name of the wrapped renderer
+     */
+    std::string getName() const;
+
+    /**
+     * @return true if the events are rendered on the writer thread
+     */
+    bool isRunning() const;
+};
+
+#endif
@@ -0,0 +1,356 @@
+#include "EventRenderer.h"
+
+namespace {
+    bool isSpokenByTower(const EventEnums::EEvent type) {
+        switch (type) {
+            case EventEnums::kEvent_TowerDescendTo5000ft:
+            case EventEnums::kEvent_TowerDescendTo3000ft:
+            case EventEnums::kEvent_TowerHoldSouth:
+            case EventEnums::kEvent_TowerClearedILSApproach:
+            case EventEnums::kEvent_TowerClearedToCross:
+            case EventEnums::kEvent_TowerHoldPosition:
+            case EventEnums::kEvent_TowerTaxiToApron:
+            case EventEnums::kEvent_TowerTaxiToHoldingPoint:
+            case EventEnums::kEvent_TowerTaxiToGate:
+            case EventEnums::kEvent_TowerTaxiToRunway:
+            case EventEnums::kEvent_TowerIFRClearance:
+            case EventEnums::kEvent_TowerPushbackApproved:
+            case EventEnums::kEvent_TowerLineUp:
+            case EventEnums::kEvent_TowerClearedForTakeoff:
+            case EventEnums::kEvent_TowerMaydayClearedILSLanding:
+            case EventEnums::kEvent_TowerMaydayGlide:
+            case EventEnums::kEvent_TowerClearedILSLanding:
+            case EventEnums::kEvent_TowerEmergencyStandby:
+                return true;
+            default:
+                return false;
+        }
+    }
+}
+
+bool EventRenderer::properlyInitialized() const {
+    return this == init;
+}
+
+EventRenderer::EventRenderer(const Airport* _airport, std::ostream& _stream) : airport(_airport), stream(_stream), init(this) {
+    REQUIRE(_airport != NULL, "Referenced Airport is a nullpointer.");
+    ENSURE(properlyInitialized(), "EventRenderer was not properly initialized.");
+}
+
+EventRenderer::~EventRenderer() {}
+
+const Airport* EventRenderer::getAirport() const {
+    REQUIRE(properlyInitialized(), "EventRenderer was not properly initialized.");
+    return airport;
+}
+
+std::ostream& EventRenderer::getStream() const {
+    REQUIRE(properlyInitialized(), "EventRenderer was not properly initialized.");
+    return stream;
+}
+
+void EventRenderer::flush() {
+    stream.flush();
+}
+
+std::string EventRenderer::getName() const {
+    return "renderer";
+}
+
+void EventRenderer::renderLog(const EventLog& log) {
+    REQUIRE(properlyInitialized(), "EventRenderer was not properly initialized.");
+    for (unsigned long i = 0; i < log.size(); i++) {
+        render(log.at(i));
+    }
+}
+
+OutputRenderer::OutputRenderer(const Airport* _airport, std::ostream& _stream) : EventRenderer(_airport, _stream) {}
+
+std::string OutputRenderer::getName() const {
+    return "output";
+}
+
+void OutputRenderer::render(const SimulationEvent& event) {
+    REQUIRE(properlyInitialized(), "EventRenderer was not properly initialized.");
+
+    if (event.type == EventEnums::kEvent_TickEnd) {
+        stream << std::endl;
+        return;
+    }
+
+    const std::string& callsign = event.airplane->getCallsign();
+    const unsigned long gate = event.gate + 1;
+
+    switch (event.type) {
+        case EventEnums::kEvent_Approaching:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " is approaching" << std::endl;
+            break;
+        case EventEnums::kEvent_StandingAtGate:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " is standing at gate " << gate << std::endl;
+            break;
+        case EventEnums::kEvent_DescentTo5000ftBegun:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " has begun its descent to 5000 ft." << std::endl;
+            break;
+        case EventEnums::kEvent_Descended:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " descended to " << event.value << " ft." << std::endl;
+            break;
+        case EventEnums::kEvent_DescentTo3000ftBegun:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " has begun its descent to 3000 ft." << std::endl;
+            break;
+        case EventEnums::kEvent_WaitPatternDescentTo3000ftBegun:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " has begun its descent to 3000 ft" << std::endl;
+            break;
+        case EventEnums::kEvent_FlyingWaitPattern:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " is flying in a waiting pattern at " << event.value << " ft." << std::endl;
+            break;
+        case EventEnums::kEvent_FinalApproachBegun:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " has begun its final approach to runway " << event.location->getName() << " at " << airport->getAirportName() << "." << std::endl;
+            break;
+        case EventEnums::kEvent_FinalApproachDescended:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " has descended to " << event.value << " ft" << std::endl;
+            break;
+        case EventEnums::kEvent_Landed:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " has landed on runway " << event.location->getName() << std::endl;
+            break;
+        case EventEnums::kEvent_Vacated:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " has vacated runway " << event.location->getName() << std::endl;
+            break;
+        case EventEnums::kEvent_OnTaxipoint:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " is now on taxipoint " << event.location->getName() << std::endl;
+            break;
+        case EventEnums::kEvent_EnteredGate:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " has entered gate " << gate << std::endl;
+            break;
+        case EventEnums::kEvent_EmergencyEnteredGate:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " has entered gate " << gate << " after an emergency landing" << std::endl;
+            break;
+        case EventEnums::kEvent_HoldingShortAtRunway:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " is holding short at runway " << event.location->getName() << std::endl;
+            break;
+        case EventEnums::kEvent_PassengersExited:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << event.value << " passengers exited " << callsign << " at gate " << gate << " of " << airport->getAirportName() << std::endl;
+            break;
+        case EventEnums::kEvent_TechnicalCheckupDone:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " has been checked for technical malfunctions" << std::endl;
+            break;
+        case EventEnums::kEvent_Refueled:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " has been refueled (" << event.value << " units)" << std::endl;
+            break;
+        case EventEnums::kEvent_PassengersBoarded:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << event.value << " passengers boarded " << callsign << " at gate " << gate << " of " << airport->getAirportName() << std::endl;
+            break;
+        case EventEnums::kEvent_PushbackBegun:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " is pushing back from gate " << gate << std::endl;
+            break;
+        case EventEnums::kEvent_PushbackDone:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " succesfully pushed back from gate " << gate << std::endl;
+            break;
+        case EventEnums::kEvent_LiningUp:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " is now lining up on runway " << event.location->getName() << std::endl;
+            break;
+        case EventEnums::kEvent_LinedUp:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " has lined up on runway " << event.location->getName() << std::endl;
+            break;
+        case EventEnums::kEvent_TakingOff:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " is taking off" << std::endl;
+            break;
+        case EventEnums::kEvent_TookOff:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " has taken off from runway " << event.location->getName() << std::endl;
+            break;
+        case EventEnums::kEvent_Ascended:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " ascended to " << event.value << " ft." << std::endl;
+            break;
+        case EventEnums::kEvent_LeftAirport:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " ascended to " << event.value << " ft. and has left " << airport->getAirportName() << std::endl;
+            break;
+        case EventEnums::kEvent_Crashed:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " crashed with " << event.value << " passengers aboard." << std::endl;
+            break;
+        case EventEnums::kEvent_EmergencyLandingBegun:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " is making an emergency landing on " << event.location->getName() << std::endl;
+            break;
+        case EventEnums::kEvent_EmergencyLanded:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " has successfully performed an emergency landed on runway " << event.location->getName() << std::endl;
+            break;
+        case EventEnums::kEvent_PassengersEvacuated:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << event.value << " passengers evacuated " << callsign << " after an emergency landing on runway " << event.location->getName() << std::endl;
+            break;
+        case EventEnums::kEvent_EmergencyCheckupDone:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " has been checked for technical malfunctions after an emergency landing on runway " << event.location->getName() << std::endl;
+            break;
+        case EventEnums::kEvent_EmergencyRefueled:
+            stream << getRealisticTimeStamp(event.timer) << ' ' << callsign << " has been refueled (" << event.value << " units) after an emergency landing on runway " << event.location->getName() << std::endl;
+            break;
+        default:
+            break;
+    }
+}
+
+TowerRenderer::TowerRenderer(const Airport* _airport, std::ostream& _stream) : EventRenderer(_airport, _stream) {}
+
+std::string TowerRenderer::getName() const {
+    return "tower";
+}
+
+void TowerRenderer::render(const SimulationEvent& event) {
+    REQUIRE(properlyInitialized(), "EventRenderer was not properly initialized.");
+
+    if (event.type == EventEnums::kEvent_TickEnd) {
+        stream << std::endl;
+        return;
+    }
+
+    if (event.type < EventEnums::kEvent_PilotArriving) return;
+
+    const Airplane* airplane = event.airplane;
+    const std::string callsign = convertPartialNumbersToNATOAlphabet(airplane->getCallsign());
+    const unsigned long gate = event.gate + 1;
+
+    stream << getRealisticTimeStamp(event.timer) << '[' << (isSpokenByTower(event.type) ? airport->getIata() : airplane->getNumber()) << ']' << std::endl;
+
+    switch (event.type) {
+        case EventEnums::kEvent_PilotArriving:
+            stream << "$ " << airport->getCallsign() << ", " << callsign << ", arriving at " << airport->getAirportName() << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_TowerDescendTo5000ft:
+            stream << "$ " << callsign << ", radar contact, descend and maintain five thousand feet, squawk " << std::oct << event.value << std::dec << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_PilotDescendTo5000ft:
+            stream << "$ Descend and maintain five thousand feet, squawking " << std::oct << event.value << std::dec << ", " << callsign << "." << std::endl;
+            break;
+        case EventEnums::kEvent_TowerDescendTo3000ft:
+            stream << "$ " << callsign << ", descend and maintain three thousand feet." << std::endl;
+            break;
+        case EventEnums::kEvent_PilotDescendTo3000ft:
+            stream << "$ Descend and maintain three thousand feet, " << callsign << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_TowerHoldSouth:
+            stream << "$ " << callsign << ", hold south on the one eighty radial, expect further clearance in " << event.value << " minutes." << std::endl;
+            break;
+        case EventEnums::kEvent_PilotHoldSouth:
+            stream << "$ Holding south on the one eighty radial, " << callsign << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_TowerClearedILSApproach:
+            stream << "$ " << callsign << ", cleared ILS approach runway " << event.location->getName() << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_PilotClearedILSApproach:
+            stream << "$ Cleared ILS approach runway " << event.location->getName() << ", " << callsign << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_PilotVacated:
+            stream << "$ " << airport->getCallsign() << ", " << callsign << " runway " << event.location->getName() << " vacated." << std::endl;
+            break;
+        case EventEnums::kEvent_PilotTaxiToHoldingPoint:
+            stream << "$ Taxi to holding point " << event.location->getName() << " via " << event.via->getName() << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_PilotHoldingShort:
+            stream << "$ " << airport->getCallsign() << ", " << callsign << ", holding short at " << event.location->getName() << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_TowerClearedToCross:
+            stream << "$ " << callsign << ", cleared to cross " << event.location->getName() << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_PilotClearedToCross:
+            stream << "$ Cleared to cross " << event.location->getName() << ", " << callsign << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_TowerHoldPosition:
+            stream << "$ " << callsign << ", hold position." << std::endl;
+            break;
+        case EventEnums::kEvent_PilotHoldPosition:
+            stream << "$ Holding position, " << callsign << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_TowerTaxiToApron:
+            stream << "$ " << callsign << ", taxi to apron via " << event.via->getName() << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_PilotTaxiToApron:
+            stream << "$ Taxi to apron via " << event.via->getName() << ", " << callsign << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_TowerTaxiToHoldingPoint:
+            stream << "$ " << callsign << ", taxi to holding point " << event.location->getName() << " via " << event.via->getName() << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_TowerTaxiToGate:
+            stream << "$ " << callsign << ", taxi to gate " << gate << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_PilotTaxiToGate:
+            stream << "$ Taxi to gate " << gate << ", " << callsign << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_TowerTaxiToRunway:
+            stream << "$ " << callsign << ", taxi to runway " << event.location->getName() << " via " << event.via->getName() << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_PilotTaxiToRunway:
+            stream << "$ Taxi to runway " << event.location->getName() << " via " << event.via->getName() << ", " << callsign << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_PilotRequestIFRClearance:
+            stream << "$ " << airport->getCallsign() << ", " << callsign << ", requesting IFR clearancy to <my destination - no flightplan implemented>." << std::endl;
+            break;
+        case EventEnums::kEvent_TowerIFRClearance:
+            stream << "$ " << callsign << ", " << airport->getCallsign()
+                   << ", cleared to <your destination - no flightplan implemented>, maintain five thousand, expect flight level one zero zero - ten minutes after departure, squawk "
+                   << std::oct << event.value << std::dec << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_PilotIFRClearance:
+            stream << "$ Cleared to <my destination - no flightplan implemented>, initial altitude five thousand, expecting one zero zero in ten, squawking "
+                   << std::oct << event.value << std::dec << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_PilotRequestPushback:
+            stream << "$ " << airport->getCallsign() << ", " << callsign << ", at gate " << gate << ", requesting pushback." << std::endl;
+            break;
+        case EventEnums::kEvent_TowerPushbackApproved:
+            stream << "$ " << callsign << ", " << airport->getCallsign() << ", pushback approved." << std::endl;
+            break;
+        case EventEnums::kEvent_PilotPushbackApproved:
+            stream << "$ Pushback approved, " << callsign << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_PilotReadyToTaxi:
+            stream << "$ " << callsign << " is ready to taxi." << std::endl;
+            break;
+        case EventEnums::kEvent_TowerLineUp:
+            stream << "$ " << callsign << ", line-up at runway " << event.location->getName() << " and wait." << std::endl;
+            break;
+        case EventEnums::kEvent_PilotLinedUp:
+            stream << "$ " << airport->getCallsign() << ", " << callsign << ", finished line-up at " << event.location->getName() << " and ready for take off." << std::endl;
+            break;
+        case EventEnums::kEvent_TowerClearedForTakeoff:
+            stream << "$ " << callsign << ", runway " << event.location->getName() << " cleared for take-off." << std::endl;
+            break;
+        case EventEnums::kEvent_PilotClearedForTakeoff:
+            stream << "$ Runway " << event.location->getName() << " cleared for take-off, " << callsign << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_PilotMaydayLanding:
+            stream << "$ Mayday mayday mayday, " << airport->getCallsign() << ", " << callsign << ", out of fuel, performing emergency landing, "
+                   << event.value << " passengers on board." << std::endl;
+            break;
+        case EventEnums::kEvent_PilotMaydayRequest:
+            stream << "$ Mayday mayday mayday, " << airport->getCallsign() << ", " << callsign << ", out of fuel, request immediate landing, "
+                   << event.value << " passengers on board." << std::endl;
+            break;
+        case EventEnums::kEvent_TowerMaydayClearedILSLanding:
+            stream << "$ " << callsign << " roger mayday, squawk seven seven zero zero, cleared ILS landing runway " << event.location->getName() << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_TowerMaydayGlide:
+            stream << "$ " << callsign << " roger mayday, squawk seven seven zero zero, glide until a free runway is available." << std::endl;
+            break;
+        case EventEnums::kEvent_TowerClearedILSLanding:
+            stream << "$ " << callsign << ", cleared ILS landing runway " << event.location->getName() << '.' << std::endl;
+            break;
+        case EventEnums::kEvent_TowerEmergencyStandby:
+            stream << "$ " << callsign << ", emergency personel on standby, good luck!" << std::endl;
+            break;
+        default:
+            break;
+    }
+}
+
+FloorplanRenderer::FloorplanRenderer(const Airport* _airport, std::ostream& _stream) : EventRenderer(_airport, _stream) {}
+
+std::string FloorplanRenderer::getName() const {
+    return "floorplan";
+}
+
+void FloorplanRenderer::render(const SimulationEvent& event) {
+    REQUIRE(properlyInitialized(), "EventRenderer was not properly initialized.");
+
+    if (event.type == EventEnums::kEvent_TickEnd) {
+        stream << getRealisticTimeStamp(event.timer) << std::endl;
+        airport->printGraphicalImpression(stream);
+        stream << std::endl;
+    }
+}
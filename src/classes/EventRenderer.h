@@ -0,0 +1,123 @@
+#ifndef INC_EVENTRENDERER_H
+#define INC_EVENTRENDERER_H
+
+#include "../lib/DesignByContract.h"
+#include "../utils/Utils.h"
+#include "SimulationEvent.h"
+#include "Airport.h"
+#include "Airplane.h"
+#include "Location.h"
+
+#include <iostream>
+
+/**
+ * Turns SimulationEvents into one of the text formats of the Simulator. \n
+ * Renderers can be attached to a Simulator to render every tick, or be run over an EventLog afterwards.
+ */
+class EventRenderer {
+protected:
+    const Airport* airport;
+    std::ostream& stream;
+
+    const EventRenderer* init;
+
+    bool properlyInitialized() const;
+
+public:
+    /**
+     * PRE: \n
+     * REQUIRE(_airport != NULL, "Referenced Airport is a nullpointer."); \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "EventRenderer was not properly initialized.");
+     * @param _airport The Airport the events take place at, its names are used in the messages
+     * @param _stream The stream the rendered text is written to
+     */
+    EventRenderer(const Airport* _airport, std::ostream& _stream);
+
+    virtual ~EventRenderer();
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "EventRenderer was not properly initialized.");
+     */
+    const Airport* getAirport() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "EventRenderer was not properly initialized.");
+     */
+    std::ostream& getStream() const;
+
+    /**
+     * Writes the event to the stream, events that are not part of this format are skipped
+     */
+    virtual void render(const SimulationEvent& event) = 0;
+
+    /**
+     * Renders every event of the log in order \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "EventRenderer was not properly initialized.");
+     */
+    void renderLog(const EventLog& log);
+
+    /**
+     * Called by the Simulator when the simulation ends, everything rendered so far must have reached the stream on return
+     */
+    virtual void flush();
+
+    /**
+     * @return the name of the output format, used to label the renderer in reports
+     */
+    virtual std::string getName() const;
+};
+
+/**
+ * Renders the state transitions (output_output.txt)
+ */
+class OutputRenderer: public EventRenderer {
+public:
+    OutputRenderer(const Airport* _airport, std::ostream& _stream);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "EventRenderer was not properly initialized.");
+     */
+    void render(const SimulationEvent& event);
+
+    std::string getName() const;
+};
+
+/**
+ * Renders the radio communication between the pilots and the tower (output_tower.txt)
+ */
+class TowerRenderer: public EventRenderer {
+public:
+    TowerRenderer(const Airport* _airport, std::ostream& _stream);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "EventRenderer was not properly initialized.");
+     */
+    void render(const SimulationEvent& event);
+
+    std::string getName() const;
+};
+
+/**
+ * Renders the graphical impression of the Airport at the end of every tick (output_floorplan.txt). \n
+ * The floorplan is drawn from the current state of the Airport, so this renderer must be attached to the Simulator.
+ */
+class FloorplanRenderer: public EventRenderer {
+public:
+    FloorplanRenderer(const Airport* _airport, std::ostream& _stream);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "EventRenderer was not properly initialized.");
+     */
+    void render(const SimulationEvent& event);
+
+    std::string getName() const;
+};
+
+#endif
@@ -0,0 +1,175 @@
+#include "OperationalStatistics.h"
+
+#include <iomanip>
+#include <sstream>
+
+AirplaneStatistics::AirplaneStatistics() : gateTime(0) {
+    for (unsigned int status = 0; status < AirplaneEnums::kStatusCount; status++) statusTime[status] = 0;
+}
+
+unsigned int AirplaneStatistics::getHoldingTime() const {
+    return statusTime[AirplaneEnums::kStatus_FlyingWaitPattern];
+}
+
+unsigned int AirplaneStatistics::getTaxiWaitTime() const {
+    return statusTime[AirplaneEnums::kStatus_HoldingShort];
+}
+
+unsigned int AirplaneStatistics::getCrossingWaitTime() const {
+    return statusTime[AirplaneEnums::kStatus_WaitingAtCrossing];
+}
+
+bool OperationalStatistics::properlyInitialized() const {
+    return this == init;
+}
+
+OperationalStatistics::OperationalStatistics()
+        : ticks(0),
+          airplanes(),
+          runwayTime(),
+          crossingTime(),
+          gateTime(),
+          slot3000ftTime(0),
+          slot5000ftTime(0),
+          init(this) {
+    ENSURE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+}
+
+void OperationalStatistics::sample(const Airport* airport) {
+    REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+    REQUIRE(airport != NULL, "Airport can not be NULL.");
+
+    ticks++;
+
+    // both maps are ordered by number, the hint keeps the insert constant time
+    std::map<std::string, AirplaneStatistics>::iterator it_statistics = airplanes.begin();
+    for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
+        const Airplane* airplane = it_airplane->second;
+        while (it_statistics != airplanes.end() && it_statistics->first < it_airplane->first) it_statistics++;
+        if (it_statistics == airplanes.end() || it_statistics->first != it_airplane->first) {
+            it_statistics = airplanes.insert(it_statistics, std::make_pair(it_airplane->first, AirplaneStatistics()));
+        }
+
+        it_statistics->second.statusTime[airplane->getStatus()]++;
+        if (airplane->getGate() != -1) it_statistics->second.gateTime++;
+    }
+
+    for (RunwayMap::const_iterator it_runway = airport->getRunways().begin(); it_runway != airport->getRunways().end(); it_runway++) {
+        unsigned int& runway = runwayTime[it_runway->first];
+        unsigned int& crossing = crossingTime[it_runway->first];
+        if (it_runway->second->getAirplane() != NULL) runway++;
+        if (it_runway->second->getCrossingAirplane() != NULL) crossing++;
+    }
+
+    const AirplaneVector& gates = airport->getGates();
+    if (gateTime.size() < gates.size()) gateTime.resize(gates.size(), 0);
+    for (unsigned long gate = 0; gate < gates.size(); gate++) {
+        if (gates[gate] != NULL) gateTime[gate]++;
+    }
+
+    if (!airport->is3000ftVacant()) slot3000ftTime++;
+    if (!airport->is5000ftVacant()) slot5000ftTime++;
+}
+
+unsigned int OperationalStatistics::getTicks() const {
+    REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+    return ticks;
+}
+
+const AirplaneStatistics* OperationalStatistics::getAirplane(const std::string& number) const {
+    REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+    std::map<std::string, AirplaneStatistics>::const_iterator it_statistics = airplanes.find(number);
+    return (it_statistics != airplanes.end() ? &it_statistics->second : NULL);
+}
+
+unsigned int OperationalStatistics::getRunwayTime(const std::string& runway) const {
+    REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+    std::map<std::string, unsigned int>::const_iterator it_runway = runwayTime.find(runway);
+    return (it_runway != runwayTime.end() ? it_runway->second : 0);
+}
+
+unsigned int OperationalStatistics::getCrossingTime(const std::string& runway) const {
+    REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+    std::map<std::string, unsigned int>::const_iterator it_runway = crossingTime.find(runway);
+    return (it_runway != crossingTime.end() ? it_runway->second : 0);
+}
+
+unsigned int OperationalStatistics::getGateTime(const unsigned long gate) const {
+    REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+    return (gate < gateTime.size() ? gateTime[gate] : 0);
+}
+
+unsigned int OperationalStatistics::get3000ftTime() const {
+    REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+    return slot3000ftTime;
+}
+
+unsigned int OperationalStatistics::get5000ftTime() const {
+    REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+    return slot5000ftTime;
+}
+
+void OperationalStatistics::report(std::ostream& stream) const {
+    REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+
+    const double tickCount = ticks > 0 ? ticks : 1;
+
+    stream << std::fixed << std::setprecision(1);
+    stream << "Operational statistics over " << ticks << " minutes" << std::endl << std::endl;
+
+    AirplaneStatistics total;
+    stream << std::left << std::setw(14) << "Airplane" << std::right << std::setw(10) << "holding" << std::setw(12) << "taxi wait" << std::setw(16) << "crossing wait" << std::setw(12) << "at gate" << std::endl;
+    for (std::map<std::string, AirplaneStatistics>::const_iterator it_airplane = airplanes.begin(); it_airplane != airplanes.end(); it_airplane++) {
+        const AirplaneStatistics& airplane = it_airplane->second;
+        stream << std::left << std::setw(14) << it_airplane->first << std::right
+               << std::setw(10) << airplane.getHoldingTime()
+               << std::setw(12) << airplane.getTaxiWaitTime()
+               << std::setw(16) << airplane.getCrossingWaitTime()
+               << std::setw(12) << airplane.gateTime << std::endl;
+
+        for (unsigned int status = 0; status < AirplaneEnums::kStatusCount; status++) total.statusTime[status] += airplane.statusTime[status];
+        total.gateTime += airplane.gateTime;
+    }
+    stream << std::left << std::setw(14) << "Total" << std::right
+           << std::setw(10) << total.getHoldingTime()
+           << std::setw(12) << total.getTaxiWaitTime()
+           << std::setw(16) << total.getCrossingWaitTime()
+           << std::setw(12) << total.gateTime << std::endl << std::endl;
+
+    // one line per airplane with the minutes of every status it was in
+    for (std::map<std::string, AirplaneStatistics>::const_iterator it_airplane = airplanes.begin(); it_airplane != airplanes.end(); it_airplane++) {
+        stream << it_airplane->first << ':';
+        for (unsigned int status = 0; status < AirplaneEnums::kStatusCount; status++) {
+            if (it_airplane->second.statusTime[status] == 0) continue;
+            stream << ' ' << AirplaneEnums::EnumToString(static_cast<AirplaneEnums::EStatus>(status)) << '=' << it_airplane->second.statusTime[status];
+        }
+        stream << std::endl;
+    }
+    stream << std::endl;
+
+    stream << std::left << std::setw(14) << "Resource" << std::right << std::setw(10) << "minutes" << std::setw(12) << "occupied %" << std::endl;
+    for (std::map<std::string, unsigned int>::const_iterator it_runway = runwayTime.begin(); it_runway != runwayTime.end(); it_runway++) {
+        const unsigned int crossing = getCrossingTime(it_runway->first);
+        stream << std::left << std::setw(14) << ("runway " + it_runway->first) << std::right
+               << std::setw(10) << it_runway->second
+               << std::setw(12) << it_runway->second * 100.0 / tickCount << std::endl;
+        stream << std::left << std::setw(14) << ("crossing " + it_runway->first) << std::right
+               << std::setw(10) << crossing
+               << std::setw(12) << crossing * 100.0 / tickCount << std::endl;
+    }
+    for (unsigned long gate = 0; gate < gateTime.size(); gate++) {
+        std::ostringstream name;
+        name << "gate " << gate + 1;
+        stream << std::left << std::setw(14) << name.str() << std::right
+               << std::setw(10) << gateTime[gate]
+               << std::setw(12) << gateTime[gate] * 100.0 / tickCount << std::endl;
+    }
+    stream << std::left << std::setw(14) << "slot 3000ft" << std::right
+           << std::setw(10) << slot3000ftTime
+           << std::setw(12) << slot3000ftTime * 100.0 / tickCount << std::endl;
+    stream << std::left << std::setw(14) << "slot 5000ft" << std::right
+           << std::setw(10) << slot5000ftTime
+           << std::setw(12) << slot5000ftTime * 100.0 / tickCount << std::endl;
+
+    stream << std::resetiosflags(std::ios::fixed) << std::setprecision(6);
+}
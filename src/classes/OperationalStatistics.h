@@ -0,0 +1,130 @@
+#ifndef INC_OPERATIONALSTATISTICS_H
+#define INC_OPERATIONALSTATISTICS_H
+
+#include "../lib/DesignByContract.h"
+#include "Airport.h"
+#include "Airplane.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+
+/**
+ * The minutes one Airplane spent in every status and at its gate
+ */
+struct AirplaneStatistics {
+    unsigned int statusTime[AirplaneEnums::kStatusCount];
+    unsigned int gateTime;
+
+    AirplaneStatistics();
+
+    /**
+     * @return the minutes in the waiting pattern at 5000ft and 3000ft
+     */
+    unsigned int getHoldingTime() const;
+
+    /**
+     * @return the minutes holding short of a runway to line up
+     */
+    unsigned int getTaxiWaitTime() const;
+
+    /**
+     * @return the minutes waiting to cross a runway
+     */
+    unsigned int getCrossingWaitTime() const;
+};
+
+/**
+ * Samples the Airport at the end of every tick, one tick is one minute. \n
+ * Per Airplane it counts the minutes in every status and at a gate, per resource the minutes every runway, gate and
+ * the 3000ft and 5000ft slots were occupied. report writes the summary used for capacity decisions.
+ */
+class OperationalStatistics {
+private:
+    unsigned int ticks;
+
+    std::map<std::string, AirplaneStatistics> airplanes;
+    std::map<std::string, unsigned int> runwayTime;
+    std::map<std::string, unsigned int> crossingTime;
+    std::vector<unsigned int> gateTime;
+    unsigned int slot3000ftTime;
+    unsigned int slot5000ftTime;
+
+    const OperationalStatistics* init;
+
+    bool properlyInitialized() const;
+
+    OperationalStatistics(const OperationalStatistics&);
+
+    OperationalStatistics& operator=(const OperationalStatistics&);
+
+public:
+    /**
+     * POST: \n
+     * ENSURE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+     */
+    OperationalStatistics();
+
+    /**
+     * Adds one minute in the current state of the Airport \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized."); \n
+     * REQUIRE(airport != NULL, "Airport can not be NULL.");
+     */
+    void sample(const Airport* airport);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+     */
+    unsigned int getTicks() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+     * @return NULL if the Airplane was never sampled
+     */
+    const AirplaneStatistics* getAirplane(const std::string& number) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+     * @return the minutes an Airplane was cleared onto the runway to land or take off
+     */
+    unsigned int getRunwayTime(const std::string& runway) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+     * @return the minutes an Airplane was crossing the runway
+     */
+    unsigned int getCrossingTime(const std::string& runway) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+     * @return the minutes the gate was occupied, 0 for gates that do not exist
+     */
+    unsigned int getGateTime(const unsigned long gate) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+     */
+    unsigned int get3000ftTime() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+     */
+    unsigned int get5000ftTime() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "OperationalStatistics was not properly initialized.");
+     */
+    void report(std::ostream& stream) const;
+};
+
+#endif
@@ -0,0 +1,140 @@
+#include "PerformanceTable.h"
+
+namespace {
+    unsigned int defaultActionTime(const AirplaneEnums::EStatus status, const AirplaneEnums::ESize size, const AirplaneEnums::EEngine engine) {
+        switch (status) {
+            case AirplaneEnums::kStatus_Ascending:
+            case AirplaneEnums::kStatus_DescendingTo3000ft:
+            case AirplaneEnums::kStatus_DescendingTo5000ft:
+            case AirplaneEnums::kStatus_FinalApproach:
+            case AirplaneEnums::kStatus_EmergencyFinalApproach:
+                if (engine == AirplaneEnums::kEngine_Propeller) return 2;
+                else if (engine == AirplaneEnums::kEngine_Jet) return 1;
+                break;
+            case AirplaneEnums::kStatus_EmergencyLanding:
+            case AirplaneEnums::kStatus_Landing:
+                return 2;
+            case AirplaneEnums::kStatus_TaxiingToApron:
+            case AirplaneEnums::kStatus_TaxiingToRunway:
+            case AirplaneEnums::kStatus_TaxiingToCrossing:
+                return 5;
+            case AirplaneEnums::kStatus_LiningUp:
+                return 1;
+            case AirplaneEnums::kStatus_CrossingRunway:
+                return 1;
+            case AirplaneEnums::kStatus_EmergencyEvacuation:
+            case AirplaneEnums::kStatus_Boarding:
+            case AirplaneEnums::kStatus_Unboarding:
+                if (size == AirplaneEnums::kSize_Small) return 5;
+                else if (size == AirplaneEnums::kSize_Medium) return 10;
+                else if (size == AirplaneEnums::kSize_Large) return 15;
+                break;
+            case AirplaneEnums::kStatus_EmergencyCheckup:
+            case AirplaneEnums::kStatus_TechnicalCheckup:
+            case AirplaneEnums::kStatus_PushingBack:
+                if (size == AirplaneEnums::kSize_Small) return 1;
+                else if (size == AirplaneEnums::kSize_Medium) return 2;
+                else if (size == AirplaneEnums::kSize_Large) return 3;
+                break;
+            case AirplaneEnums::kStatus_TakingOff:
+                if (engine == AirplaneEnums::kEngine_Propeller) return 3;
+                else if (engine == AirplaneEnums::kEngine_Jet) return 2;
+                break;
+            default:
+                break;
+        }
+
+        return 1;
+    }
+
+    unsigned int defaultFuelConsumption(const AirplaneEnums::ESize size, const AirplaneEnums::EEngine engine) {
+        if (size == AirplaneEnums::kSize_Small) {
+            if (engine == AirplaneEnums::kEngine_Propeller) { return 10; }
+            else if (engine == AirplaneEnums::kEngine_Jet) { return 25; }
+        } else if (size == AirplaneEnums::kSize_Medium) {
+            if (engine == AirplaneEnums::kEngine_Propeller) { return 50; }
+            else if (engine == AirplaneEnums::kEngine_Jet) { return 175; }
+        } else if (size == AirplaneEnums::kSize_Large) {
+            if (engine == AirplaneEnums::kEngine_Propeller) { return 100; }
+            else if (engine == AirplaneEnums::kEngine_Jet) { return 250; }
+        }
+
+        return 0;
+    }
+}
+
+bool PerformanceTable::properlyInitialized() const {
+    return this == init;
+}
+
+PerformanceTable::PerformanceTable() : refuelRate(10000), init(this) {
+    for (unsigned int size = 0; size < AirplaneEnums::kSizeCount; size++) {
+        for (unsigned int engine = 0; engine < AirplaneEnums::kEngineCount; engine++) {
+            AircraftType& classType = classTypes[size][engine];
+
+            for (unsigned int status = 0; status < AirplaneEnums::kStatusCount; status++) {
+                classType.actionTimes[status] = defaultActionTime(static_cast<AirplaneEnums::EStatus>(status), static_cast<AirplaneEnums::ESize>(size), static_cast<AirplaneEnums::EEngine>(engine));
+            }
+
+            classType.fuelConsumption = defaultFuelConsumption(static_cast<AirplaneEnums::ESize>(size), static_cast<AirplaneEnums::EEngine>(engine));
+            classType.refuelRate = refuelRate;
+            classType.boardingRate = 0;
+        }
+    }
+
+    ENSURE(properlyInitialized(), "PerformanceTable was not properly initialized.");
+}
+
+const PerformanceTable& PerformanceTable::getDefault() {
+    static const PerformanceTable defaultTable;
+    return defaultTable;
+}
+
+unsigned int PerformanceTable::getActionTime(const AirplaneEnums::EStatus status, const AirplaneEnums::ESize size, const AirplaneEnums::EEngine engine) const {
+    REQUIRE(properlyInitialized(), "PerformanceTable was not properly initialized.");
+    return classTypes[size][engine].actionTimes[status];
+}
+
+void PerformanceTable::setActionTime(const AirplaneEnums::EStatus status, const AirplaneEnums::ESize size, const AirplaneEnums::EEngine engine, const unsigned int minutes) {
+    REQUIRE(properlyInitialized(), "PerformanceTable was not properly initialized.");
+    classTypes[size][engine].actionTimes[status] = minutes;
+    ENSURE(getActionTime(status, size, engine) == minutes, "Action time was not correctly set.");
+}
+
+unsigned int PerformanceTable::getFuelConsumption(const AirplaneEnums::ESize size, const AirplaneEnums::EEngine engine) const {
+    REQUIRE(properlyInitialized(), "PerformanceTable was not properly initialized.");
+    return classTypes[size][engine].fuelConsumption;
+}
+
+void PerformanceTable::setFuelConsumption(const AirplaneEnums::ESize size, const AirplaneEnums::EEngine engine, const unsigned int consumption) {
+    REQUIRE(properlyInitialized(), "PerformanceTable was not properly initialized.");
+    classTypes[size][engine].fuelConsumption = consumption;
+    ENSURE(getFuelConsumption(size, engine) == consumption, "Fuel consumption was not correctly set.");
+}
+
+unsigned int PerformanceTable::getRefuelRate() const {
+    REQUIRE(properlyInitialized(), "PerformanceTable was not properly initialized.");
+    return refuelRate;
+}
+
+void PerformanceTable::setRefuelRate(const unsigned int rate) {
+    REQUIRE(properlyInitialized(), "PerformanceTable was not properly initialized.");
+    REQUIRE(rate > 0, "Refuel rate must be positive.");
+    refuelRate = rate;
+    for (unsigned int size = 0; size < AirplaneEnums::kSizeCount; size++) {
+        for (unsigned int engine = 0; engine < AirplaneEnums::kEngineCount; engine++) {
+            classTypes[size][engine].refuelRate = rate;
+        }
+    }
+    ENSURE(getRefuelRate() == rate, "Refuel rate was not correctly set.");
+}
+
+unsigned int PerformanceTable::getRefuelTime(const unsigned int missingFuel) const {
+    REQUIRE(properlyInitialized(), "PerformanceTable was not properly initialized.");
+    return (missingFuel + refuelRate - 1) / refuelRate;
+}
+
+const AircraftType* PerformanceTable::getAircraftType(const AirplaneEnums::ESize size, const AirplaneEnums::EEngine engine) const {
+    REQUIRE(properlyInitialized(), "PerformanceTable was not properly initialized.");
+    return &classTypes[size][engine];
+}
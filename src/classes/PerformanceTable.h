@@ -0,0 +1,121 @@
+#ifndef INC_PERFORMANCETABLE_H
+#define INC_PERFORMANCETABLE_H
+
+#include "../lib/DesignByContract.h"
+#include "Airplane.h"
+
+/**
+ * Resolved performance record of an Airplane, read by the Simulator with a single pointer dereference. \n
+ * Records for the size/engine classes live in a PerformanceTable, records for specific models in an AircraftDatabase.
+ */
+struct AircraftType {
+    /**
+     * Minutes needed for the action belonging to each status
+     */
+    unsigned int actionTimes[AirplaneEnums::kStatusCount];
+
+    /**
+     * Fuel burned per minute while airborne
+     */
+    unsigned int fuelConsumption;
+
+    /**
+     * Fuel units pumped per minute
+     */
+    unsigned int refuelRate;
+
+    /**
+     * Passengers (un)boarded per minute, 0 when (un)boarding takes the fixed action time
+     */
+    unsigned int boardingRate;
+};
+
+/**
+ * Dense lookup tables for the time an action takes ([status][size][engine], in minutes)
+ * and the fuel an airborne Airplane burns per minute ([size][engine]), stored as one AircraftType per size/engine class. \n
+ * Refueling is not a fixed duration, it follows from the missing fuel and the refuel rate.
+ */
+class PerformanceTable {
+private:
+    AircraftType classTypes[AirplaneEnums::kSizeCount][AirplaneEnums::kEngineCount];
+    unsigned int refuelRate;
+
+    const PerformanceTable* init;
+
+    bool properlyInitialized() const;
+
+public:
+    /**
+     * Fills the tables with the compiled defaults \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "PerformanceTable was not properly initialized.");
+     */
+    PerformanceTable();
+
+    /**
+     * @return the shared table holding the compiled defaults
+     */
+    static const PerformanceTable& getDefault();
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "PerformanceTable was not properly initialized.");
+     * @return the minutes needed for the action belonging to the status
+     */
+    unsigned int getActionTime(const AirplaneEnums::EStatus status, const AirplaneEnums::ESize size, const AirplaneEnums::EEngine engine) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "PerformanceTable was not properly initialized."); \n
+     * POST: \n
+     * ENSURE(getActionTime(status, size, engine) == minutes, "Action time was not correctly set.");
+     */
+    void setActionTime(const AirplaneEnums::EStatus status, const AirplaneEnums::ESize size, const AirplaneEnums::EEngine engine, const unsigned int minutes);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "PerformanceTable was not properly initialized.");
+     * @return the fuel burned per minute
+     */
+    unsigned int getFuelConsumption(const AirplaneEnums::ESize size, const AirplaneEnums::EEngine engine) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "PerformanceTable was not properly initialized."); \n
+     * POST: \n
+     * ENSURE(getFuelConsumption(size, engine) == consumption, "Fuel consumption was not correctly set.");
+     */
+    void setFuelConsumption(const AirplaneEnums::ESize size, const AirplaneEnums::EEngine engine, const unsigned int consumption);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "PerformanceTable was not properly initialized.");
+     * @return the fuel units pumped per minute
+     */
+    unsigned int getRefuelRate() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "PerformanceTable was not properly initialized."); \n
+     * REQUIRE(rate > 0, "Refuel rate must be positive."); \n
+     * POST: \n
+     * ENSURE(getRefuelRate() == rate, "Refuel rate was not correctly set.");
+     */
+    void setRefuelRate(const unsigned int rate);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "PerformanceTable was not properly initialized.");
+     * @return the minutes needed to fill up the missing fuel
+     */
+    unsigned int getRefuelTime(const unsigned int missingFuel) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "PerformanceTable was not properly initialized.");
+     * @return the record of the size/engine class, it stays valid and up to date for the lifetime of the table
+     */
+    const AircraftType* getAircraftType(const AirplaneEnums::ESize size, const AirplaneEnums::EEngine engine) const;
+};
+
+#endif
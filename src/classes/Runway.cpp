@@ -40,6 +40,19 @@ const RunwayEnums::EType Runway::getType() const {
     return type;
 }
 
+void Runway::setLength(const unsigned int _length) {
+    REQUIRE(properlyInitialized(), "Runway was not properly initialized.");
+    length = _length;
+    ENSURE(length == _length, "Runway length was not properly set.");
+}
+
+void Runway::setType(const RunwayEnums::EType _type) {
+    REQUIRE(properlyInitialized(), "Runway was not properly initialized.");
+    REQUIRE(_type != RunwayEnums::kInvalidType, "Runway type can not be invalid.");
+    type = _type;
+    ENSURE(type == _type, "Runway type was not properly set.");
+}
+
 Airplane* Runway::getAirplane() const {
     REQUIRE(properlyInitialized(), "Runway was not properly initialized.");
     return airplane;
@@ -68,6 +68,19 @@ public:
      */
     const RunwayEnums::EType getType() const;
 
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Runway was not properly initialized.");
+     */
+    void setLength(const unsigned int _length);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Runway was not properly initialized."); \n
+     * REQUIRE(_type != RunwayEnums::kInvalidType, "Runway type can not be invalid.");
+     */
+    void setType(const RunwayEnums::EType _type);
+
     /**
      * PRE: \n
      * REQUIRE(properlyInitialized(), "Runway was not properly initialized.");
@@ -0,0 +1,47 @@
+#include "SimulationEvent.h"
+
+namespace EventEnums {
+    #define eevent(x) #x
+        const char* strEEvent[] = { EEVENTS };
+    #undef eevent
+
+    const char* EnumToString(EEvent f)
+    {
+        return strEEvent[static_cast<int>(f)];
+    }
+}
+
+bool EventLog::properlyInitialized() const {
+    return this == init;
+}
+
+EventLog::EventLog() : events(), init(this) {
+    ENSURE(properlyInitialized(), "EventLog was not properly initialized.");
+}
+
+void EventLog::append(const SimulationEvent& event) {
+    REQUIRE(properlyInitialized(), "EventLog was not properly initialized.");
+    events.push_back(event);
+}
+
+void EventLog::clear() {
+    REQUIRE(properlyInitialized(), "EventLog was not properly initialized.");
+    events.clear();
+    ENSURE(empty(), "EventLog was not properly cleared.");
+}
+
+const SimulationEvent& EventLog::at(const unsigned long index) const {
+    REQUIRE(properlyInitialized(), "EventLog was not properly initialized.");
+    REQUIRE(index < size(), "Event index is out of range.");
+    return events[index];
+}
+
+unsigned long EventLog::size() const {
+    REQUIRE(properlyInitialized(), "EventLog was not properly initialized.");
+    return events.size();
+}
+
+bool EventLog::empty() const {
+    REQUIRE(properlyInitialized(), "EventLog was not properly initialized.");
+    return events.empty();
+}
@@ -0,0 +1,180 @@
+#ifndef INC_SIMULATIONEVENT_H
+#define INC_SIMULATIONEVENT_H
+
+#include "../lib/DesignByContract.h"
+
+#include <vector>
+
+namespace EventEnums {
+    #define EEVENTS \
+        eevent(InvalidEvent), \
+        eevent(TickEnd), \
+        eevent(Approaching), \
+        eevent(StandingAtGate), \
+        eevent(DescentTo5000ftBegun), \
+        eevent(Descended), \
+        eevent(DescentTo3000ftBegun), \
+        eevent(WaitPatternDescentTo3000ftBegun), \
+        eevent(FlyingWaitPattern), \
+        eevent(FinalApproachBegun), \
+        eevent(FinalApproachDescended), \
+        eevent(Landed), \
+        eevent(Vacated), \
+        eevent(OnTaxipoint), \
+        eevent(EnteredGate), \
+        eevent(EmergencyEnteredGate), \
+        eevent(HoldingShortAtRunway), \
+        eevent(PassengersExited), \
+        eevent(TechnicalCheckupDone), \
+        eevent(Refueled), \
+        eevent(PassengersBoarded), \
+        eevent(PushbackBegun), \
+        eevent(PushbackDone), \
+        eevent(LiningUp), \
+        eevent(LinedUp), \
+        eevent(TakingOff), \
+        eevent(TookOff), \
+        eevent(Ascended), \
+        eevent(LeftAirport), \
+        eevent(Crashed), \
+        eevent(EmergencyLandingBegun), \
+        eevent(EmergencyLanded), \
+        eevent(PassengersEvacuated), \
+        eevent(EmergencyCheckupDone), \
+        eevent(EmergencyRefueled), \
+        eevent(PilotArriving), \
+        eevent(TowerDescendTo5000ft), \
+        eevent(PilotDescendTo5000ft), \
+        eevent(TowerDescendTo3000ft), \
+        eevent(PilotDescendTo3000ft), \
+        eevent(TowerHoldSouth), \
+        eevent(PilotHoldSouth), \
+        eevent(TowerClearedILSApproach), \
+        eevent(PilotClearedILSApproach), \
+        eevent(PilotVacated), \
+        eevent(PilotTaxiToHoldingPoint), \
+        eevent(PilotHoldingShort), \
+        eevent(TowerClearedToCross), \
+        eevent(PilotClearedToCross), \
+        eevent(TowerHoldPosition), \
+        eevent(PilotHoldPosition), \
+        eevent(TowerTaxiToApron), \
+        eevent(PilotTaxiToApron), \
+        eevent(TowerTaxiToHoldingPoint), \
+        eevent(TowerTaxiToGate), \
+        eevent(PilotTaxiToGate), \
+        eevent(TowerTaxiToRunway), \
+        eevent(PilotTaxiToRunway), \
+        eevent(PilotRequestIFRClearance), \
+        eevent(TowerIFRClearance), \
+        eevent(PilotIFRClearance), \
+        eevent(PilotRequestPushback), \
+        eevent(TowerPushbackApproved), \
+        eevent(PilotPushbackApproved), \
+        eevent(PilotReadyToTaxi), \
+        eevent(TowerLineUp), \
+        eevent(PilotLinedUp), \
+        eevent(TowerClearedForTakeoff), \
+        eevent(PilotClearedForTakeoff), \
+        eevent(PilotMaydayLanding), \
+        eevent(PilotMaydayRequest), \
+        eevent(TowerMaydayClearedILSLanding), \
+        eevent(TowerMaydayGlide), \
+        eevent(TowerClearedILSLanding), \
+        eevent(TowerEmergencyStandby)
+
+    #define eevent(x) kEvent_##x
+        enum EEvent { EEVENTS };
+    #undef eevent
+
+    const unsigned int kEventCount = kEvent_TowerEmergencyStandby + 1;
+
+    const char* EnumToString(EEvent f);
+}
+
+class Airplane;
+class Location;
+
+/**
+ * A single state transition or radio message of the Simulator, in the order the handlers produced them. \n
+ * Everything a renderer prints is captured when the event is emitted, the pointers only serve names that never change.
+ */
+struct SimulationEvent {
+    EventEnums::EEvent type;
+
+    /**
+     * Simulator timer at the time of the event
+     */
+    unsigned int timer;
+
+    /**
+     * Airplane the event is about, NULL for kEvent_TickEnd
+     */
+    const Airplane* airplane;
+
+    /**
+     * Runway, holding point or taxipoint the event refers to
+     */
+    const Location* location;
+
+    /**
+     * Taxipoint the Airplane taxis via
+     */
+    const Location* via;
+
+    /**
+     * Altitude, squawk, passenger count, fuel units or minutes, depending on the type
+     */
+    unsigned int value;
+
+    /**
+     * Gate index of the Airplane at the time of the event
+     */
+    unsigned long gate;
+};
+
+/**
+ * Append-only in-memory log of SimulationEvents
+ */
+class EventLog {
+private:
+    std::vector<SimulationEvent> events;
+
+    const EventLog* init;
+
+    bool properlyInitialized() const;
+
+public:
+    /**
+     * POST: \n
+     * ENSURE(properlyInitialized(), "EventLog was not properly initialized.");
+     */
+    EventLog();
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "EventLog was not properly initialized.");
+     */
+    void append(const SimulationEvent& event);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "EventLog was not properly initialized."); \n
+     * POST: \n
+     * ENSURE(empty(), "EventLog was not properly cleared.");
+     */
+    void clear();
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "EventLog was not properly initialized."); \n
+     * REQUIRE(index < size(), "Event index is out of range.");
+     */
+    const SimulationEvent& at(const unsigned long index) const;
+
+    unsigned long size() const;
+
+    bool empty() const;
+};
+
+#endif
@@ -0,0 +1,42 @@
+#include "SimulationObserver.h"
+
+bool SimulationObserver::properlyInitialized() const {
+    return this == init;
+}
+
+SimulationObserver::SimulationObserver() : airplanes(), statuses(), init(this) {
+    ENSURE(properlyInitialized(), "SimulationObserver was not properly initialized.");
+}
+
+SimulationObserver::~SimulationObserver() {}
+
+void SimulationObserver::watchAirplane(const std::string& number) {
+    REQUIRE(properlyInitialized(), "SimulationObserver was not properly initialized.");
+    airplanes.insert(number);
+}
+
+void SimulationObserver::watchStatus(const AirplaneEnums::EStatus status) {
+    REQUIRE(properlyInitialized(), "SimulationObserver was not properly initialized.");
+    statuses.insert(status);
+}
+
+bool SimulationObserver::accepts(const Airplane* airplane, const AirplaneEnums::EStatus from, const AirplaneEnums::EStatus to) const {
+    REQUIRE(properlyInitialized(), "SimulationObserver was not properly initialized.");
+    REQUIRE(airplane != NULL, "Referenced Airplane is a nullpointer.");
+
+    if (!airplanes.empty() && airplanes.find(airplane->getNumber()) == airplanes.end()) return false;
+    if (!statuses.empty() && statuses.find(from) == statuses.end() && statuses.find(to) == statuses.end()) return false;
+    return true;
+}
+
+void SimulationObserver::onTransition(const unsigned int, const Airplane*, const AirplaneEnums::EStatus, const AirplaneEnums::EStatus) {}
+
+void SimulationObserver::onRunwayAcquired(const unsigned int, const Airplane*, const Runway*) {}
+
+void SimulationObserver::onRunwayReleased(const unsigned int, const Airplane*, const Runway*) {}
+
+void SimulationObserver::onGateAcquired(const unsigned int, const Airplane*, const long) {}
+
+void SimulationObserver::onGateReleased(const unsigned int, const Airplane*, const long) {}
+
+void SimulationObserver::onEmergency(const unsigned int, const Airplane*) {}
@@ -0,0 +1,79 @@
+#ifndef INC_SIMULATIONOBSERVER_H
+#define INC_SIMULATIONOBSERVER_H
+
+#include "../lib/DesignByContract.h"
+#include "Airplane.h"
+#include "Runway.h"
+
+#include <set>
+#include <string>
+
+/**
+ * Receives the state changes of the Airplanes while a Simulator runs, without going through the rendered text. \n
+ * The Simulator only compares the Airplane states before and after their handlers while an observer is attached. \n
+ * Airplanes placed by a FlightSchedule are reported as a transition from kStatus_InvalidStatus, with the gate they are
+ * placed at. \n
+ * The callbacks do nothing by default, derived observers override the ones they need.
+ */
+class SimulationObserver {
+private:
+    std::set<std::string> airplanes;
+    std::set<AirplaneEnums::EStatus> statuses;
+
+    const SimulationObserver* init;
+
+protected:
+    bool properlyInitialized() const;
+
+public:
+    /**
+     * Observes every Airplane in every status \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "SimulationObserver was not properly initialized.");
+     */
+    SimulationObserver();
+
+    virtual ~SimulationObserver();
+
+    /**
+     * Limits the observer to the watched Airplanes, it can be called once per Airplane \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SimulationObserver was not properly initialized.");
+     */
+    void watchAirplane(const std::string& number);
+
+    /**
+     * Limits the observer to changes from or into the watched statuses, it can be called once per status \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SimulationObserver was not properly initialized.");
+     */
+    void watchStatus(const AirplaneEnums::EStatus status);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SimulationObserver was not properly initialized."); \n
+     * REQUIRE(airplane != NULL, "Referenced Airplane is a nullpointer.");
+     * @return true if the change of the Airplane from the status into the other passes the filters
+     */
+    bool accepts(const Airplane* airplane, const AirplaneEnums::EStatus from, const AirplaneEnums::EStatus to) const;
+
+    virtual void onTransition(const unsigned int timer, const Airplane* airplane, const AirplaneEnums::EStatus from, const AirplaneEnums::EStatus to);
+
+    /**
+     * Called when the Airplane is cleared onto the Runway, to land, take off or cross it
+     */
+    virtual void onRunwayAcquired(const unsigned int timer, const Airplane* airplane, const Runway* runway);
+
+    virtual void onRunwayReleased(const unsigned int timer, const Airplane* airplane, const Runway* runway);
+
+    virtual void onGateAcquired(const unsigned int timer, const Airplane* airplane, const long gate);
+
+    virtual void onGateReleased(const unsigned int timer, const Airplane* airplane, const long gate);
+
+    /**
+     * Called when the Airplane declares an emergency, after onTransition into the emergency status
+     */
+    virtual void onEmergency(const unsigned int timer, const Airplane* airplane);
+};
+
+#endif
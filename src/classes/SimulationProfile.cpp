@@ -0,0 +1,142 @@
+#include "SimulationProfile.h"
+
+#include <iomanip>
+#include <algorithm>
+
+namespace ProfileEnums {
+    #define ephase(x) #x
+        const char* strEPhase[] = { EPHASES };
+    #undef ephase
+
+    const char* EnumToString(EPhase f)
+    {
+        return strEPhase[static_cast<int>(f)];
+    }
+}
+
+bool SimulationProfile::properlyInitialized() const {
+    return this == init;
+}
+
+SimulationProfile::SimulationProfile() : ticks(0), rendererTime(), init(this) {
+    for (unsigned int status = 0; status < AirplaneEnums::kStatusCount; status++) {
+        handlerCalls[status] = 0;
+        handlerTime[status] = 0;
+        waitingPolls[status] = 0;
+    }
+
+    for (unsigned int phase = 0; phase < ProfileEnums::kPhaseCount; phase++) {
+        phaseTime[phase] = 0;
+        phaseTickTime[phase] = 0;
+        phaseMaxTickTime[phase] = 0;
+    }
+
+    ENSURE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+}
+
+void SimulationProfile::endTick() {
+    REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+
+    for (unsigned int phase = 0; phase < ProfileEnums::kPhaseCount; phase++) {
+        phaseMaxTickTime[phase] = std::max(phaseMaxTickTime[phase], phaseTickTime[phase]);
+        phaseTickTime[phase] = 0;
+    }
+
+    ticks++;
+}
+
+void SimulationProfile::addHandler(const AirplaneEnums::EStatus status, const unsigned long long nanoseconds, const bool waited) {
+    REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+    REQUIRE(status < AirplaneEnums::kStatusCount, "Status is out of range.");
+
+    handlerCalls[status]++;
+    handlerTime[status] += nanoseconds;
+    if (waited) waitingPolls[status]++;
+}
+
+void SimulationProfile::addPhase(const ProfileEnums::EPhase phase, const unsigned long long nanoseconds) {
+    REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+    REQUIRE(phase < ProfileEnums::kPhaseCount, "Phase is out of range.");
+
+    phaseTime[phase] += nanoseconds;
+    phaseTickTime[phase] += nanoseconds;
+}
+
+void SimulationProfile::addRenderer(const std::string& name, const unsigned long long nanoseconds) {
+    REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+    rendererTime[name] += nanoseconds;
+}
+
+unsigned long SimulationProfile::getTicks() const {
+    REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+    return ticks;
+}
+
+unsigned long SimulationProfile::getHandlerCalls(const AirplaneEnums::EStatus status) const {
+    REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+    REQUIRE(status < AirplaneEnums::kStatusCount, "Status is out of range.");
+    return handlerCalls[status];
+}
+
+unsigned long long SimulationProfile::getHandlerTime(const AirplaneEnums::EStatus status) const {
+    REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+    REQUIRE(status < AirplaneEnums::kStatusCount, "Status is out of range.");
+    return handlerTime[status];
+}
+
+unsigned long SimulationProfile::getWaitingPolls(const AirplaneEnums::EStatus status) const {
+    REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+    REQUIRE(status < AirplaneEnums::kStatusCount, "Status is out of range.");
+    return waitingPolls[status];
+}
+
+unsigned long long SimulationProfile::getPhaseTime(const ProfileEnums::EPhase phase) const {
+    REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+    REQUIRE(phase < ProfileEnums::kPhaseCount, "Phase is out of range.");
+    return phaseTime[phase];
+}
+
+unsigned long long SimulationProfile::getRendererTime(const std::string& name) const {
+    REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+    std::map<std::string, unsigned long long>::const_iterator it_renderer = rendererTime.find(name);
+    return it_renderer != rendererTime.end() ? it_renderer->second : 0;
+}
+
+void SimulationProfile::report(std::ostream& stream) const {
+    REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+
+    const double tickCount = ticks > 0 ? ticks : 1;
+
+    stream << std::fixed << std::setprecision(3);
+    stream << "Simulation profile over " << ticks << " ticks" << std::endl << std::endl;
+
+    stream << std::left << std::setw(26) << "Phase" << std::right << std::setw(14) << "total ms" << std::setw(14) << "avg us/tick" << std::setw(14) << "max us/tick" << std::endl;
+    for (unsigned int phase = 0; phase < ProfileEnums::kPhaseCount; phase++) {
+        stream << std::left << std::setw(26) << ProfileEnums::EnumToString(static_cast<ProfileEnums::EPhase>(phase)) << std::right
+               << std::setw(14) << phaseTime[phase] / 1000000.0
+               << std::setw(14) << phaseTime[phase] / 1000.0 / tickCount
+               << std::setw(14) << std::max(phaseMaxTickTime[phase], phaseTickTime[phase]) / 1000.0 << std::endl;
+    }
+    stream << std::endl;
+
+    stream << std::left << std::setw(26) << "Handler" << std::right << std::setw(14) << "calls" << std::setw(14) << "total ms" << std::setw(14) << "avg us" << std::setw(14) << "waiting polls" << std::endl;
+    for (unsigned int status = 0; status < AirplaneEnums::kStatusCount; status++) {
+        if (handlerCalls[status] == 0) continue;
+
+        stream << std::left << std::setw(26) << AirplaneEnums::EnumToString(static_cast<AirplaneEnums::EStatus>(status)) << std::right
+               << std::setw(14) << handlerCalls[status]
+               << std::setw(14) << handlerTime[status] / 1000000.0
+               << std::setw(14) << handlerTime[status] / 1000.0 / handlerCalls[status]
+               << std::setw(14) << waitingPolls[status] << std::endl;
+    }
+    stream << std::endl;
+
+    stream << std::left << std::setw(26) << "Renderer" << std::right << std::setw(14) << "total ms" << std::setw(14) << "avg us/tick" << std::endl;
+    for (std::map<std::string, unsigned long long>::const_iterator it_renderer = rendererTime.begin(); it_renderer != rendererTime.end(); it_renderer++) {
+        stream << std::left << std::setw(26) << it_renderer->first << std::right
+               << std::setw(14) << it_renderer->second / 1000000.0
+               << std::setw(14) << it_renderer->second / 1000.0 / tickCount << std::endl;
+    }
+
+    stream << std::resetiosflags(std::ios::fixed) << std::setprecision(6);
+}
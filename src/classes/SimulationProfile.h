@@ -0,0 +1,138 @@
+#ifndef INC_SIMULATIONPROFILE_H
+#define INC_SIMULATIONPROFILE_H
+
+#include "../lib/DesignByContract.h"
+#include "Airplane.h"
+
+#include <iostream>
+#include <string>
+#include <map>
+
+namespace ProfileEnums {
+    #define EPHASES \
+        ephase(Schedule), \
+        ephase(Burn), \
+        ephase(Dispatch), \
+        ephase(Render), \
+        ephase(Flush)
+
+    #define ephase(x) kPhase_##x
+        enum EPhase { EPHASES };
+    #undef ephase
+
+    const unsigned int kPhaseCount = kPhase_Flush + 1;
+
+    const char* EnumToString(EPhase f);
+}
+
+/**
+ * Counters filled in by a Simulator that has a profile attached. \n
+ * Schedule covers the finished check and the squawk queue, Burn the fuel burned by flying airplanes, Dispatch the status
+ * handlers, Render the renderers at the end of each tick and Flush the final flush after the last tick. \n
+ * A waiting poll is a handler call after which status, action timer and communication timer are unchanged,
+ * the airplane spent the tick waiting for a runway, crossing, altitude or gate.
+ */
+class SimulationProfile {
+private:
+    unsigned long ticks;
+
+    unsigned long handlerCalls[AirplaneEnums::kStatusCount];
+    unsigned long long handlerTime[AirplaneEnums::kStatusCount];
+    unsigned long waitingPolls[AirplaneEnums::kStatusCount];
+
+    unsigned long long phaseTime[ProfileEnums::kPhaseCount];
+    unsigned long long phaseTickTime[ProfileEnums::kPhaseCount];
+    unsigned long long phaseMaxTickTime[ProfileEnums::kPhaseCount];
+
+    std::map<std::string, unsigned long long> rendererTime;
+
+    const SimulationProfile* init;
+
+    bool properlyInitialized() const;
+
+public:
+    /**
+     * POST: \n
+     * ENSURE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+     */
+    SimulationProfile();
+
+    /**
+     * Closes the phase times of the current tick \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+     */
+    void endTick();
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized."); \n
+     * REQUIRE(status < AirplaneEnums::kStatusCount, "Status is out of range.");
+     * @param nanoseconds Time spent in the handler
+     * @param waited True if the call was a waiting poll
+     */
+    void addHandler(const AirplaneEnums::EStatus status, const unsigned long long nanoseconds, const bool waited);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized."); \n
+     * REQUIRE(phase < ProfileEnums::kPhaseCount, "Phase is out of range.");
+     */
+    void addPhase(const ProfileEnums::EPhase phase, const unsigned long long nanoseconds);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+     */
+    void addRenderer(const std::string& name, const unsigned long long nanoseconds);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+     */
+    unsigned long getTicks() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized."); \n
+     * REQUIRE(status < AirplaneEnums::kStatusCount, "Status is out of range.");
+     */
+    unsigned long getHandlerCalls(const AirplaneEnums::EStatus status) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized."); \n
+     * REQUIRE(status < AirplaneEnums::kStatusCount, "Status is out of range.");
+     */
+    unsigned long long getHandlerTime(const AirplaneEnums::EStatus status) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized."); \n
+     * REQUIRE(status < AirplaneEnums::kStatusCount, "Status is out of range.");
+     */
+    unsigned long getWaitingPolls(const AirplaneEnums::EStatus status) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized."); \n
+     * REQUIRE(phase < ProfileEnums::kPhaseCount, "Phase is out of range.");
+     */
+    unsigned long long getPhaseTime(const ProfileEnums::EPhase phase) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+     * @return the time spent in the named renderer, 0 if it never rendered
+     */
+    unsigned long long getRendererTime(const std::string& name) const;
+
+    /**
+     * Writes the phase, handler and renderer tables \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SimulationProfile was not properly initialized.");
+     */
+    void report(std::ostream& stream) const;
+};
+
+#endif
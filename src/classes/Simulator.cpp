@@ -1,4 +1,5 @@
 #include "Simulator.h"
+#include "../parser/FlightSchedule.h"
 
 bool Simulator::properlyInitialized() const {
     return this == init;
@@ -6,190 +7,746 @@ bool Simulator::properlyInitialized() const {
 
 Simulator::Simulator(const Airport* _airport, std::ostream& _outputStream, std::ostream& _errorStream, std::ostream& _airTrafficControllerStream, std::ostream& _floorplanStream)
     : timer(0),
+      started(false),
+      finished(false),
+      phaseStart(0),
+      copyStart(getMonotonicNanoseconds()),
       airport(new Airport(_airport)),
-      airTrafficController(_airTrafficControllerStream),
-      floorplanStream(_floorplanStream),
-      outputStream(_outputStream),
+      copyEnd(getMonotonicNanoseconds()),
       errorStream(_errorStream),
+      eventLog(),
+      renderers(),
+      ownedRenderers(),
+      recordEvents(true),
+      tickLimit(11520),
+      profile(NULL),
+      profileStream(NULL),
+      trace(NULL),
+      perfCounters(NULL),
+      allocationTracker(NULL),
+      stateDigest(NULL),
+      statistics(NULL),
+      timeSeries(NULL),
+      perturbation(NULL),
+      schedule(NULL),
+      waitingForGate(),
+      squawks(),
+      retireAirplanes(false),
+      retired(),
+      retiredCount(0),
+      observers(),
+      runwayChanges(),
+      init(this) {
+    ownedRenderers.push_back(new OutputRenderer(airport, _outputStream));
+    ownedRenderers.push_back(new TowerRenderer(airport, _airTrafficControllerStream));
+    ownedRenderers.push_back(new FloorplanRenderer(airport, _floorplanStream));
+    renderers = ownedRenderers;
+    ENSURE(properlyInitialized(), "Simulator was not properly initialized");
+}
+
+Simulator::Simulator(const Airport* _airport, std::ostream& _errorStream)
+    : timer(0),
+      started(false),
+      finished(false),
+      phaseStart(0),
+      copyStart(getMonotonicNanoseconds()),
+      airport(new Airport(_airport)),
+      copyEnd(getMonotonicNanoseconds()),
+      errorStream(_errorStream),
+      eventLog(),
+      renderers(),
+      ownedRenderers(),
+      recordEvents(true),
+      tickLimit(11520),
+      profile(NULL),
+      profileStream(NULL),
+      trace(NULL),
+      perfCounters(NULL),
+      allocationTracker(NULL),
+      stateDigest(NULL),
+      statistics(NULL),
+      timeSeries(NULL),
+      perturbation(NULL),
+      schedule(NULL),
+      waitingForGate(),
+      squawks(),
+      retireAirplanes(false),
+      retired(),
+      retiredCount(0),
+      observers(),
+      runwayChanges(),
       init(this) {
     ENSURE(properlyInitialized(), "Simulator was not properly initialized");
 }
 
 Simulator::~Simulator() {
+    for (std::vector<EventRenderer*>::iterator it_renderer = ownedRenderers.begin(); it_renderer != ownedRenderers.end(); it_renderer++) {
+        delete *it_renderer;
+    }
+    for (std::vector<Airplane*>::iterator it_airplane = retired.begin(); it_airplane != retired.end(); it_airplane++) {
+        delete *it_airplane;
+    }
+    for (std::deque<Airplane*>::iterator it_airplane = waitingForGate.begin(); it_airplane != waitingForGate.end(); it_airplane++) {
+        delete *it_airplane;
+    }
     delete airport;
 }
 
+const Airport* Simulator::getAirport() const {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    return airport;
+}
+
+const EventLog& Simulator::getEventLog() const {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    return eventLog;
+}
+
+void Simulator::addRenderer(EventRenderer* renderer) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    REQUIRE(renderer != NULL, "Referenced EventRenderer is a nullpointer.");
+    renderers.push_back(renderer);
+}
+
+void Simulator::setRecordEvents(const bool _recordEvents) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    recordEvents = _recordEvents;
+}
+
+void Simulator::setTickLimit(const unsigned int _tickLimit) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    tickLimit = _tickLimit;
+}
+
+void Simulator::setProfile(SimulationProfile* _profile, std::ostream* _profileStream) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    profile = _profile;
+    profileStream = _profileStream;
+}
+
+void Simulator::setTrace(TraceWriter* _trace) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    trace = _trace;
+    if (trace != NULL) trace->span("Airport copy", "simulation", copyStart, copyEnd);
+}
+
+void Simulator::setPerfCounters(PerfCounters* _perfCounters) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    perfCounters = _perfCounters;
+}
+
+void Simulator::setAllocationTracker(AllocationTracker* _allocationTracker) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    allocationTracker = _allocationTracker;
+}
+
+void Simulator::setStateDigest(StateDigest* _stateDigest) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    stateDigest = _stateDigest;
+}
+
+void Simulator::setStatistics(OperationalStatistics* _statistics) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    statistics = _statistics;
+}
+
+void Simulator::setTimeSeries(TimeSeriesWriter* _timeSeries) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    timeSeries = _timeSeries;
+    if (timeSeries != NULL) timeSeries->countAirport(airport);
+}
+
+void Simulator::setPerturbation(const TimingPerturbation* _perturbation) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    perturbation = _perturbation;
+}
+
+void Simulator::setSchedule(FlightSchedule* _schedule) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    schedule = _schedule;
+
+    squawks.clear();
+    for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
+        if (it_airplane->second->getStatus() != AirplaneEnums::kStatus_LeftAirport && it_airplane->second->getStatus() != AirplaneEnums::kStatus_Crashed) {
+            squawks.hold(it_airplane->second->getAssignedSquawk());
+        }
+    }
+}
+
+void Simulator::setRetireAirplanes(const bool _retireAirplanes) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    retireAirplanes = _retireAirplanes;
+}
+
+unsigned long Simulator::getRetiredCount() const {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    return retiredCount;
+}
+
+void Simulator::addObserver(SimulationObserver* observer) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    REQUIRE(observer != NULL, "Referenced SimulationObserver is a nullpointer.");
+    observers.push_back(observer);
+}
+
+void Simulator::removeObserver(SimulationObserver* observer) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    observers.erase(std::remove(observers.begin(), observers.end(), observer), observers.end());
+}
+
+unsigned long long Simulator::profilePhase(const ProfileEnums::EPhase phase, const unsigned long long start) {
+    const unsigned long long now = getMonotonicNanoseconds();
+    if (profile != NULL) profile->addPhase(phase, now - start);
+    return now;
+}
+
+void Simulator::emit(const EventEnums::EEvent type, const Airplane* airplane, const Location* location, const Location* via, const unsigned int value) {
+    if (!recordEvents) return;
+
+    SimulationEvent event;
+    event.type = type;
+    event.timer = timer;
+    event.airplane = airplane;
+    event.location = location;
+    event.via = via;
+    event.value = value;
+    event.gate = (airplane != NULL ? airplane->getGate() : 0);
+    eventLog.append(event);
+}
+
+void Simulator::flushEvents() {
+    if (renderers.empty()) return;
+
+    for (std::vector<EventRenderer*>::iterator it_renderer = renderers.begin(); it_renderer != renderers.end(); it_renderer++) {
+        if (profile != NULL) {
+            const unsigned long long start = getMonotonicNanoseconds();
+            (*it_renderer)->renderLog(eventLog);
+            profile->addRenderer((*it_renderer)->getName(), getMonotonicNanoseconds() - start);
+        } else {
+            (*it_renderer)->renderLog(eventLog);
+        }
+    }
+    eventLog.clear();
+}
+
 void Simulator::Simulate() {
-    for (AirplaneMap::iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    REQUIRE(!isFinished(), "Simulation is already finished.");
+
+    resume();
+    while (!isStopped()) tick();
+    finish();
+}
+
+unsigned int Simulator::step(const unsigned int ticks) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    REQUIRE(!isFinished(), "Simulation is already finished.");
+
+    resume();
+    unsigned int ran = 0;
+    while (ran < ticks && !isStopped()) {
+        tick();
+        ran++;
+    }
+    return ran;
+}
+
+unsigned int Simulator::runUntilTime(const unsigned int time) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    REQUIRE(!isFinished(), "Simulation is already finished.");
+
+    resume();
+    unsigned int ran = 0;
+    while (timer < time && !isStopped()) {
+        tick();
+        ran++;
+    }
+    return ran;
+}
+
+unsigned int Simulator::runUntil(const SimulationCondition& condition) {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    REQUIRE(!isFinished(), "Simulation is already finished.");
+
+    resume();
+    unsigned int ran = 0;
+    while (!isStopped() && !condition.holds(*this)) {
+        tick();
+        ran++;
+    }
+    return ran;
+}
+
+void Simulator::finish() {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    REQUIRE(!isFinished(), "Simulation is already finished.");
+
+    resume();
+    const bool instrumented = (profile != NULL || trace != NULL);
+
+    if (perfCounters != NULL) perfCounters->begin();
+    if (allocationTracker != NULL) allocationTracker->setPhase(ProfileEnums::kPhase_Flush);
+
+    flushEvents();
+
+    if (!retired.empty() && eventLog.empty()) {
+        deleteRetired();
+    } else {
+        for (std::vector<EventRenderer*>::iterator it_renderer = renderers.begin(); it_renderer != renderers.end(); it_renderer++) {
+            (*it_renderer)->flush();
+        }
+    }
+
+    if (perfCounters != NULL) perfCounters->end("flush");
+    if (allocationTracker != NULL) allocationTracker->clearPhase();
+
+    if (instrumented) {
+        const unsigned long long flushEnd = profilePhase(ProfileEnums::kPhase_Flush, phaseStart);
+        if (trace != NULL) trace->span("flush", "simulation", phaseStart, flushEnd);
+        if (profile != NULL && profileStream != NULL) profile->report(*profileStream);
+    }
+
+    finished = true;
+    ENSURE(isFinished(), "Simulation was not finished.");
+}
+
+bool Simulator::isStopped() const {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    return started && (timer > tickLimit || SimulationFinished());
+}
+
+bool Simulator::isFinished() const {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    return finished;
+}
+
+unsigned int Simulator::getTimer() const {
+    REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+    return timer;
+}
+
+void Simulator::resume() {
+    // time spent outside the Simulator between two stepping calls is not part of any phase
+    if (profile != NULL || trace != NULL) phaseStart = getMonotonicNanoseconds();
+    if (!started) begin();
+}
+
+void Simulator::begin() {
+    for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
         if (it_airplane->second->getStatus() == AirplaneEnums::kStatus_Approaching) {
-            outputStream << getRealisticTimeStamp() << ' ' << it_airplane->second->getCallsign() << " is approaching" << std::endl;
+            emit(EventEnums::kEvent_Approaching, it_airplane->second);
         } else if (it_airplane->second->getStatus() == AirplaneEnums::kStatus_StandingAtGate)  {
-            outputStream << getRealisticTimeStamp() << ' ' << it_airplane->second->getCallsign() << " is standing at gate " << it_airplane->second->getGate() + 1 << std::endl;
+            emit(EventEnums::kEvent_StandingAtGate, it_airplane->second);
         } else {
             errorStream << "Airport is not consistent? This should never happen.";
         }
     }
-    
+    if (schedule != NULL) placeScheduled();
+
     timer++;
+    started = true;
+}
 
-    while (!SimulationFinished()) {
-        std::priority_queue<Airplane*, std::vector<Airplane*>, CompareSquawk> airplaneQueue;
-        for (AirplaneMap::iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
-            if (it_airplane->second->getStatus() != AirplaneEnums::kStatus_LeftAirport) {
-                airplaneQueue.push(it_airplane->second);
-            }
+void Simulator::tick() {
+    const bool instrumented = (profile != NULL || trace != NULL);
+    const unsigned long long tickStart = phaseStart;
+    if (perfCounters != NULL) perfCounters->begin();
+    if (allocationTracker != NULL) allocationTracker->setPhase(ProfileEnums::kPhase_Schedule);
+
+    if (schedule != NULL) placeScheduled();
+
+    const bool observed = !observers.empty();
+    ObservedState observedState;
+
+    std::priority_queue<Airplane*, std::vector<Airplane*>, CompareSquawk> airplaneQueue;
+    for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
+        // the queue must not depend on the finished Airplanes, squawk ties are broken by the heap and retiring removes them
+        if (it_airplane->second->getStatus() != AirplaneEnums::kStatus_LeftAirport && it_airplane->second->getStatus() != AirplaneEnums::kStatus_Crashed) {
+            airplaneQueue.push(it_airplane->second);
         }
+    }
 
-        while (!airplaneQueue.empty()) {
-            Airplane* airplane = airplaneQueue.top();
-            airplaneQueue.pop();
-
-            if (airplane->isFlying()) {
-                if (!airplane->fly()) {
-                    if (airplane->getStatus() != AirplaneEnums::kStatus_Emergency &&
-                        airplane->getStatus() != AirplaneEnums::kStatus_EmergencyLanding &&
-                        airplane->getStatus() != AirplaneEnums::kStatus_EmergencyFinalApproach
-                    ) {
-                        airplane->setStatus(AirplaneEnums::kStatus_Emergency);
-                        airplane->setCommunicationTimer(0);
-                        airplane->setActionTimer(0);
-                        airplane->setPermission(false);
-                    }
+    if (trace != NULL) traceQueues(airplaneQueue.size(), phaseStart);
+    if (instrumented) phaseStart = profilePhase(ProfileEnums::kPhase_Schedule, phaseStart);
+
+    while (!airplaneQueue.empty()) {
+        Airplane* airplane = airplaneQueue.top();
+        airplaneQueue.pop();
+
+        if (allocationTracker != NULL) allocationTracker->setPhase(ProfileEnums::kPhase_Burn);
+        if (observed) observe(airplane, observedState);
+        const AirplaneEnums::EStatus countedStatus = airplane->getStatus();
+
+        if (airplane->isFlying()) {
+            const bool flying = (perturbation != NULL ? airplane->fly(perturbation->perturbFuel(airplane, airplane->getFuelConsumption(), timer)) : airplane->fly());
+            if (!flying) {
+                if (airplane->getStatus() != AirplaneEnums::kStatus_Emergency &&
+                    airplane->getStatus() != AirplaneEnums::kStatus_EmergencyLanding &&
+                    airplane->getStatus() != AirplaneEnums::kStatus_EmergencyFinalApproach
+                ) {
+                    airplane->setStatus(AirplaneEnums::kStatus_Emergency);
+                    airplane->setCommunicationTimer(0);
+                    airplane->setActionTimer(0);
+                    airplane->setPermission(false);
                 }
             }
+        }
 
-            switch(airplane->getStatus()) {
-                case AirplaneEnums::kStatus_Approaching:
-                    Approach(airplane);
-                    break;
-                case AirplaneEnums::kStatus_DescendingTo5000ft:
-                    DescendTo5000ft(airplane);
-                    break;
-                case AirplaneEnums::kStatus_DescendingTo3000ft:
-                    DescendTo3000ft(airplane);
-                    break;
-                case AirplaneEnums::kStatus_FlyingWaitPattern:
-                    FlyWaitingPattern(airplane);
-                    break;
-                case AirplaneEnums::kStatus_FinalApproach:
-                    FinalApproach(airplane);
-                    break;
-                case AirplaneEnums::kStatus_Landing:
-                    Land(airplane);
-                    break;
-                case AirplaneEnums::kStatus_Vacate:
-                    Vacate(airplane);
-                    break;
-                case AirplaneEnums::kStatus_CrossingRunway:
-                    CrossRunway(airplane);
-                    break;
-                case AirplaneEnums::kStatus_TaxiingToCrossing:
-                    TaxiToCrossing(airplane);
-                    break;
-                case AirplaneEnums::kStatus_TaxiingToRunway:
-                    TaxiToRunway(airplane);
-                    break;
-                case AirplaneEnums::kStatus_WaitingAtCrossing:
-                    WaitingAtCrossing(airplane);
-                    break;
-                case AirplaneEnums::kStatus_TaxiingToApron:
-                    TaxiToApron(airplane);
-                    break;
-                case AirplaneEnums::kStatus_Unboarding:
-                    UnboardAirplane(airplane);
-                    break;
-                case AirplaneEnums::kStatus_TechnicalCheckup:
-                    TechnicalCheckup(airplane);
-                    break;
-                case AirplaneEnums::kStatus_Refueling:
-                    Refuel(airplane);
-                    break;
-                case AirplaneEnums::kStatus_Boarding:
-                    BoardAirplane(airplane);
-                    break;
-                case AirplaneEnums::kStatus_StandingAtGate:
-                    StandAtGate(airplane);
-                    break;
-                case AirplaneEnums::kStatus_PushingBack:
-                    Pushback(airplane);
-                    break;
-                case AirplaneEnums::kStatus_HoldingShort:
-                    HoldShort(airplane);
-                    break;
-                case AirplaneEnums::kStatus_LiningUp:
-                    LineUp(airplane);
-                    break;
-                case AirplaneEnums::kStatus_ReadyForTakeoff:
-                    ReadyForTakeoff(airplane);
-                    break;
-                case AirplaneEnums::kStatus_TakingOff:
-                    Takeoff(airplane);
-                    break;
-                case AirplaneEnums::kStatus_Ascending:
-                    Ascend(airplane);
-                    break;
-                case AirplaneEnums::kStatus_Emergency:
-                    Emergency(airplane);
-                    break;
-                case AirplaneEnums::kStatus_EmergencyFinalApproach:
-                    EmergencyFinalApproach(airplane);
-                    break;
-                case AirplaneEnums::kStatus_EmergencyLanding:
-                    EmergencyLand(airplane);
-                    break;
-                case AirplaneEnums::kStatus_EmergencyEvacuation:
-                    EmergencyEvacuate(airplane);
-                    break;
-                case AirplaneEnums::kStatus_EmergencyCheckup:
-                    EmergencyCheckup(airplane);
-                    break;
-                case AirplaneEnums::kStatus_EmergencyRefueling:
-                    EmergencyRefuel(airplane);
-                    break;
-                default:
-                    break;
-            }
+        // an emergency declared while flying is reported before its handler runs
+        if (observed && airplane->getStatus() != observedState.status) {
+            notifyObservers(airplane, observedState);
+            observe(airplane, observedState);
+        }
+
+        if (allocationTracker != NULL) allocationTracker->setPhase(ProfileEnums::kPhase_Dispatch);
+
+        if (instrumented) {
+            phaseStart = profilePhase(ProfileEnums::kPhase_Burn, phaseStart);
+
+            const AirplaneEnums::EStatus status = airplane->getStatus();
+            const unsigned int actionTimer = airplane->getActionTimer();
+            const unsigned int communicationTimer = airplane->getCommunicationTimer();
+
+            dispatch(airplane);
+
+            const unsigned long long handlerStart = phaseStart;
+            phaseStart = profilePhase(ProfileEnums::kPhase_Dispatch, phaseStart);
+            if (profile != NULL) profile->addHandler(status, phaseStart - handlerStart, airplane->getStatus() == status && airplane->getActionTimer() == actionTimer && airplane->getCommunicationTimer() == communicationTimer);
+            if (trace != NULL) trace->span(AirplaneEnums::EnumToString(status), "handler", handlerStart, phaseStart, airplane->getNumber());
+        } else {
+            dispatch(airplane);
         }
 
-        floorplanStream << getRealisticTimeStamp() << std::endl;
-        airport->printGraphicalImpression(floorplanStream);
-        floorplanStream << std::endl;
+        if (observed) notifyObservers(airplane, observedState);
+        if (timeSeries != NULL && airplane->getStatus() != countedStatus) timeSeries->changeStatus(countedStatus, airplane->getStatus());
+        if (schedule != NULL && airplane->getStatus() != countedStatus && (airplane->getStatus() == AirplaneEnums::kStatus_LeftAirport || airplane->getStatus() == AirplaneEnums::kStatus_Crashed)) {
+            // an emergency replaces the squawk, the code the Airplane was given is the one it held
+            squawks.release(airplane->getAssignedSquawk());
+        }
+    }
+
+    if (perfCounters != NULL) {
+        perfCounters->end("simulate");
+        perfCounters->begin();
+    }
+    if (allocationTracker != NULL) allocationTracker->setPhase(ProfileEnums::kPhase_Render);
 
-        timer++;
-        outputStream << std::endl;
-        airTrafficController << std::endl;
-        if (timer / 11520.0 > 1.0) break;
+    emit(EventEnums::kEvent_TickEnd, NULL);
+    if (trace != NULL) {
+        std::map<std::string, unsigned long> events;
+        events["logged"] = eventLog.size();
+        trace->counter("events", getMonotonicNanoseconds(), events);
     }
+    flushEvents();
+
+    if (perfCounters != NULL) perfCounters->end("render");
+    if (allocationTracker != NULL) allocationTracker->endTick();
+    if (stateDigest != NULL) stateDigest->record(timer, airport);
+    if (statistics != NULL) statistics->sample(airport);
+    if (timeSeries != NULL) timeSeries->record(timer, airport);
+
+    if (instrumented) {
+        phaseStart = profilePhase(ProfileEnums::kPhase_Render, phaseStart);
+        if (profile != NULL) profile->endTick();
+        if (trace != NULL) trace->span("tick", "simulation", tickStart, phaseStart, getRealisticTimeStamp());
+    }
+
+    if (retireAirplanes) retire();
+
+    timer++;
 }
 
-bool Simulator::SimulationFinished() {
-    for (AirplaneMap::iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
-        if (it_airplane->second->getStatus() != AirplaneEnums::kStatus_LeftAirport && it_airplane->second->getStatus() != AirplaneEnums::kStatus_Crashed) return false;
+void Simulator::placeScheduled() {
+    // StandingAtGate Airplanes that found no gate before go first, in the order of the schedule
+    while (!waitingForGate.empty() && place(waitingForGate.front())) {
+        waitingForGate.pop_front();
     }
 
+    while (!schedule->isExhausted() && schedule->getNextTime() <= timer) {
+        Airplane* airplane = schedule->takeNext();
+        if (!waitingForGate.empty() && airplane->getStatus() == AirplaneEnums::kStatus_StandingAtGate) {
+            waitingForGate.push_back(airplane);
+        } else if (!place(airplane)) {
+            waitingForGate.push_back(airplane);
+        }
+    }
+}
+
+bool Simulator::place(Airplane* airplane) {
+    const unsigned int offset = airplane->getSquawkBlock();
+    if (offset == 00) {
+        errorStream << "Invalid airplane combination: " << airplane->getCallsign() << " (" << airplane->getNumber() << ") " << std::endl;
+        airplane->printInfo(errorStream);
+        delete airplane;
+        return true;
+    }
+
+    if (airport->getAirplanesByRegistrationNumber(airplane->getNumber()) != NULL) {
+        errorStream << "Scheduled airplane is already at the airport: " << airplane->getCallsign() << " (" << airplane->getNumber() << ") " << std::endl;
+        delete airplane;
+        return true;
+    }
+
+    AirplaneVector::iterator it_freeGate = airport->getGates().end();
+    if (airplane->getStatus() == AirplaneEnums::kStatus_StandingAtGate) {
+        it_freeGate = std::find(airport->getGates().begin(), airport->getGates().end(), static_cast<Airplane*>(NULL));
+        if (it_freeGate == airport->getGates().end()) return false;
+    }
+
+    airplane->setAirport(airport);
+    airport->addAirplane(airplane);
+    airplane->setSquawk(squawks.take(offset));
+
+    if (airplane->getStatus() == AirplaneEnums::kStatus_StandingAtGate) {
+        *it_freeGate = airplane;
+        airplane->setGate(std::distance(airport->getGates().begin(), it_freeGate));
+        emit(EventEnums::kEvent_StandingAtGate, airplane);
+    } else {
+        emit(EventEnums::kEvent_Approaching, airplane);
+    }
+
+    if (timeSeries != NULL) timeSeries->changeStatus(AirplaneEnums::kStatus_InvalidStatus, airplane->getStatus());
+    if (!observers.empty()) notifyPlaced(airplane);
     return true;
 }
 
-std::string Simulator::getRealisticTimeStamp() const {
-    std::stringstream result;
+bool Simulator::isReferenced(const Airplane* airplane) const {
+    if (airplane->getGate() != -1 || airport->get3000ft() == airplane || airport->get5000ft() == airplane) return true;
+
+    for (RunwayMap::const_iterator it_runway = airport->getRunways().begin(); it_runway != airport->getRunways().end(); it_runway++) {
+        if (it_runway->second->getAirplane() == airplane || it_runway->second->getCrossingAirplane() == airplane) return true;
+    }
+    return false;
+}
+
+void Simulator::retire() {
+    std::vector<Airplane*> finishedAirplanes;
+    for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
+        const AirplaneEnums::EStatus status = it_airplane->second->getStatus();
+        // an Airplane that crashed while it held a slot keeps it, it is retired once nothing refers to it anymore
+        if ((status == AirplaneEnums::kStatus_LeftAirport || status == AirplaneEnums::kStatus_Crashed) && !isReferenced(it_airplane->second)) {
+            finishedAirplanes.push_back(it_airplane->second);
+        }
+    }
+
+    for (std::vector<Airplane*>::iterator it_airplane = finishedAirplanes.begin(); it_airplane != finishedAirplanes.end(); it_airplane++) {
+        airport->removeAirplane(*it_airplane);
+        retired.push_back(*it_airplane);
+        retiredCount++;
+    }
+
+    // flushing the renderers waits for the AsyncRenderer threads, that is only done once per batch
+    if (retired.size() >= kRetireBatch && eventLog.empty()) deleteRetired();
+}
+
+void Simulator::deleteRetired() {
+    for (std::vector<EventRenderer*>::iterator it_renderer = renderers.begin(); it_renderer != renderers.end(); it_renderer++) {
+        (*it_renderer)->flush();
+    }
+
+    for (std::vector<Airplane*>::iterator it_airplane = retired.begin(); it_airplane != retired.end(); it_airplane++) {
+        delete *it_airplane;
+    }
+    retired.clear();
+}
+
+void Simulator::traceQueues(const unsigned long active, const unsigned long long time) {
+    std::map<std::string, unsigned long> airplanes;
+    airplanes["active"] = active;
+    trace->counter("airplanes", time, airplanes);
+
+    std::map<std::string, unsigned long> queues;
+    queues["waitPattern"] = 0;
+    queues["crossing"] = 0;
+    queues["holdingShort"] = 0;
+    queues["gate"] = 0;
+
+    for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
+        switch (it_airplane->second->getStatus()) {
+            case AirplaneEnums::kStatus_FlyingWaitPattern:
+                queues["waitPattern"]++;
+                break;
+            case AirplaneEnums::kStatus_WaitingAtCrossing:
+                queues["crossing"]++;
+                break;
+            case AirplaneEnums::kStatus_HoldingShort:
+                queues["holdingShort"]++;
+                break;
+            case AirplaneEnums::kStatus_StandingAtGate:
+                queues["gate"]++;
+                break;
+            default:
+                break;
+        }
+    }
+
+    trace->counter("queues", time, queues);
+}
+
+void Simulator::observe(const Airplane* airplane, ObservedState& state) const {
+    state.status = airplane->getStatus();
+    state.gate = airplane->getGate();
+}
+
+void Simulator::notifyObservers(const Airplane* airplane, const ObservedState& before) {
+    ObservedState after;
+    observe(airplane, after);
+
+    for (std::vector<SimulationObserver*>::iterator it_observer = observers.begin(); it_observer != observers.end(); it_observer++) {
+        SimulationObserver* observer = *it_observer;
+        if (!observer->accepts(airplane, before.status, after.status)) continue;
+
+        if (after.status != before.status) observer->onTransition(timer, airplane, before.status, after.status);
+        if (after.status == AirplaneEnums::kStatus_Emergency && before.status != AirplaneEnums::kStatus_Emergency) observer->onEmergency(timer, airplane);
+
+        for (std::vector<std::pair<const Runway*, bool> >::const_iterator it_change = runwayChanges.begin(); it_change != runwayChanges.end(); it_change++) {
+            if (it_change->second) {
+                observer->onRunwayAcquired(timer, airplane, it_change->first);
+            } else {
+                observer->onRunwayReleased(timer, airplane, it_change->first);
+            }
+        }
+
+        if (after.gate != before.gate) {
+            if (before.gate != -1) observer->onGateReleased(timer, airplane, before.gate);
+            if (after.gate != -1) observer->onGateAcquired(timer, airplane, after.gate);
+        }
+    }
 
-    unsigned int days = static_cast<unsigned int>(std::floor((timer + 720) / 1440.0));
-    unsigned int hours = static_cast<unsigned int>(std::floor((timer + 720 - (days * 1440)) / 60.0));
-    unsigned int minutes = static_cast<unsigned int>(std::floor((timer + 720) - (days * 1440) - (hours * 60)));
+    runwayChanges.clear();
+}
+
+void Simulator::notifyPlaced(const Airplane* airplane) {
+    for (std::vector<SimulationObserver*>::iterator it_observer = observers.begin(); it_observer != observers.end(); it_observer++) {
+        SimulationObserver* observer = *it_observer;
+        if (!observer->accepts(airplane, AirplaneEnums::kStatus_InvalidStatus, airplane->getStatus())) continue;
+
+        observer->onTransition(timer, airplane, AirplaneEnums::kStatus_InvalidStatus, airplane->getStatus());
+        if (airplane->getGate() != -1) observer->onGateAcquired(timer, airplane, airplane->getGate());
+    }
+}
+
+void Simulator::setRunwayAirplane(Runway* runway, Airplane* airplane) {
+    // the observers are told about the change once the handler is done
+    if (!observers.empty() && runway->getAirplane() != airplane) {
+        runwayChanges.push_back(std::make_pair(runway, airplane != NULL));
+    }
+    runway->setAirplane(airplane);
+}
+
+void Simulator::setCrossingAirplane(Runway* runway, Airplane* airplane) {
+    if (!observers.empty() && runway->getCrossingAirplane() != airplane) {
+        runwayChanges.push_back(std::make_pair(runway, airplane != NULL));
+    }
+    runway->setCrossingAirplane(airplane);
+}
+
+void Simulator::dispatch(Airplane* airplane) {
+    switch(airplane->getStatus()) {
+        case AirplaneEnums::kStatus_Approaching:
+            Approach(airplane);
+            break;
+        case AirplaneEnums::kStatus_DescendingTo5000ft:
+            DescendTo5000ft(airplane);
+            break;
+        case AirplaneEnums::kStatus_DescendingTo3000ft:
+            DescendTo3000ft(airplane);
+            break;
+        case AirplaneEnums::kStatus_FlyingWaitPattern:
+            FlyWaitingPattern(airplane);
+            break;
+        case AirplaneEnums::kStatus_FinalApproach:
+            FinalApproach(airplane);
+            break;
+        case AirplaneEnums::kStatus_Landing:
+            Land(airplane);
+            break;
+        case AirplaneEnums::kStatus_Vacate:
+            Vacate(airplane);
+            break;
+        case AirplaneEnums::kStatus_CrossingRunway:
+            CrossRunway(airplane);
+            break;
+        case AirplaneEnums::kStatus_TaxiingToCrossing:
+            TaxiToCrossing(airplane);
+            break;
+        case AirplaneEnums::kStatus_TaxiingToRunway:
+            TaxiToRunway(airplane);
+            break;
+        case AirplaneEnums::kStatus_WaitingAtCrossing:
+            WaitingAtCrossing(airplane);
+            break;
+        case AirplaneEnums::kStatus_TaxiingToApron:
+            TaxiToApron(airplane);
+            break;
+        case AirplaneEnums::kStatus_Unboarding:
+            UnboardAirplane(airplane);
+            break;
+        case AirplaneEnums::kStatus_TechnicalCheckup:
+            TechnicalCheckup(airplane);
+            break;
+        case AirplaneEnums::kStatus_Refueling:
+            Refuel(airplane);
+            break;
+        case AirplaneEnums::kStatus_Boarding:
+            BoardAirplane(airplane);
+            break;
+        case AirplaneEnums::kStatus_StandingAtGate:
+            StandAtGate(airplane);
+            break;
+        case AirplaneEnums::kStatus_PushingBack:
+            Pushback(airplane);
+            break;
+        case AirplaneEnums::kStatus_HoldingShort:
+            HoldShort(airplane);
+            break;
+        case AirplaneEnums::kStatus_LiningUp:
+            LineUp(airplane);
+            break;
+        case AirplaneEnums::kStatus_ReadyForTakeoff:
+            ReadyForTakeoff(airplane);
+            break;
+        case AirplaneEnums::kStatus_TakingOff:
+            Takeoff(airplane);
+            break;
+        case AirplaneEnums::kStatus_Ascending:
+            Ascend(airplane);
+            break;
+        case AirplaneEnums::kStatus_Emergency:
+            Emergency(airplane);
+            break;
+        case AirplaneEnums::kStatus_EmergencyFinalApproach:
+            EmergencyFinalApproach(airplane);
+            break;
+        case AirplaneEnums::kStatus_EmergencyLanding:
+            EmergencyLand(airplane);
+            break;
+        case AirplaneEnums::kStatus_EmergencyEvacuation:
+            EmergencyEvacuate(airplane);
+            break;
+        case AirplaneEnums::kStatus_EmergencyCheckup:
+            EmergencyCheckup(airplane);
+            break;
+        case AirplaneEnums::kStatus_EmergencyRefueling:
+            EmergencyRefuel(airplane);
+            break;
+        default:
+            break;
+    }
+}
 
-    result << '[';
+bool Simulator::SimulationFinished() const {
+    if (schedule != NULL && (!waitingForGate.empty() || !schedule->isExhausted())) return false;
 
-    if (days % 7 == 0) result << "Monday ";
-    else if (days % 7 == 1) result << "Tuesday ";
-    else if (days % 7 == 2) result << "Wednesday ";
-    else if (days % 7 == 3) result << "Thursday ";
-    else if (days % 7 == 4) result << "Friday ";
-    else if (days % 7 == 5) result << "Saturday ";
-    else if (days % 7 == 6) result << "Sunday ";
+    for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
+        if (it_airplane->second->getStatus() != AirplaneEnums::kStatus_LeftAirport && it_airplane->second->getStatus() != AirplaneEnums::kStatus_Crashed) return false;
+    }
 
-    result << std::setw(2) << std::setfill('0') << hours << ":" << std::setw(2) << std::setfill('0') << minutes << ']';
+    return true;
+}
 
-    return result.str();
+std::string Simulator::getRealisticTimeStamp() const {
+    return ::getRealisticTimeStamp(timer);
 }
 
 void Simulator::Approach(Airplane* airplane) {
@@ -197,23 +754,20 @@ void Simulator::Approach(Airplane* airplane) {
     REQUIRE(airplane->getStatus() == AirplaneEnums::kStatus_Approaching, "Airplane is not in the correct status.");
 
     if (airplane->getCommunicationTimer() == 0) {
-        airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-        airTrafficController << "$ " << airport->getCallsign() << ", " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", arriving at " << airport->getAirportName() << '.' << std::endl;
+        emit(EventEnums::kEvent_PilotArriving, airplane);
 
         airplane->increaseCommunicationTimer();
     } else if (airplane->getCommunicationTimer() == 1) {
         if (airport->is5000ftVacant()) {
-            airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-            airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", radar contact, descend and maintain five thousand feet, squawk " << std::oct << airplane->getSquawk() << std::dec << '.' << std::endl;
+            emit(EventEnums::kEvent_TowerDescendTo5000ft, airplane, NULL, NULL, airplane->getSquawk());
 
             airport->set5000ft(airplane);
             airplane->increaseCommunicationTimer();
         }
     } else if (airplane->getCommunicationTimer() == 2) {
-        airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-        airTrafficController << "$ Descend and maintain five thousand feet, squawking " << std::oct << airplane->getSquawk() << std::dec << ", " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << "." << std::endl;
+        emit(EventEnums::kEvent_PilotDescendTo5000ft, airplane, NULL, NULL, airplane->getSquawk());
 
-        outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has begun its descent to 5000 ft." << std::endl;
+        emit(EventEnums::kEvent_DescentTo5000ftBegun, airplane);
 
         airplane->setStatus(AirplaneEnums::kStatus_DescendingTo5000ft);
 
@@ -233,7 +787,7 @@ void Simulator::DescendTo5000ft(Airplane* airplane) {
 
         if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
             if (airplane->descend(1000)) {
-                outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " descended to " << airplane->getAltitude() << " ft." << std::endl;
+                emit(EventEnums::kEvent_Descended, airplane, NULL, NULL, airplane->getAltitude());
 
                 airplane->setActionTimer(0);
             } else {
@@ -247,23 +801,19 @@ void Simulator::DescendTo5000ft(Airplane* airplane) {
             airplane->increaseCommunicationTimer();
 
             if(airport->is3000ftVacant()) {
-                airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-                airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", descend and maintain three thousand feet." << std::endl;
+                emit(EventEnums::kEvent_TowerDescendTo3000ft, airplane);
 
                 airplane->setPermission(true);
             } else {
-                airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-                airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", hold south on the one eighty radial, expect further clearance in " <<
-                    static_cast<unsigned int>(std::floor(airport->get3000ft()->getAltitude() / (airport->get3000ft()->getEngine() == AirplaneEnums::kEngine_Jet ? 1000.0 : 500.0))) << " minutes." << std::endl;
+                emit(EventEnums::kEvent_TowerHoldSouth, airplane, NULL, NULL, static_cast<unsigned int>(std::floor(airport->get3000ft()->getAltitude() / (airport->get3000ft()->getEngine() == AirplaneEnums::kEngine_Jet ? 1000.0 : 500.0))));
 
                 airplane->setPermission(false);
             }
         } else if (airplane->getCommunicationTimer() == 1) {
             if (airplane->hasPermission()) {
-                airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-                airTrafficController << "$ Descend and maintain three thousand feet, " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << '.' << std::endl;
+                emit(EventEnums::kEvent_PilotDescendTo3000ft, airplane);
 
-                outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has begun its descent to 3000 ft." << std::endl;
+                emit(EventEnums::kEvent_DescentTo3000ftBegun, airplane);
 
                 airplane->setStatus(AirplaneEnums::kStatus_DescendingTo3000ft);
 
@@ -274,10 +824,9 @@ void Simulator::DescendTo5000ft(Airplane* airplane) {
                 airplane->setCommunicationTimer(0);
                 airplane->setPermission(false);
             } else {
-                airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-                airTrafficController << "$ Holding south on the one eighty radial, " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << '.' << std::endl;
+                emit(EventEnums::kEvent_PilotHoldSouth, airplane);
 
-                outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " is flying in a waiting pattern at 5000 ft." << std::endl;
+                emit(EventEnums::kEvent_FlyingWaitPattern, airplane, NULL, NULL, 5000);
 
                 airplane->setStatus(AirplaneEnums::kStatus_FlyingWaitPattern);
 
@@ -298,7 +847,7 @@ void Simulator::DescendTo3000ft(Airplane* airplane) {
         airplane->increaseActionTimer();
         if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
             if(airplane->descend(1000)) {
-                outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " descended to " << airplane->getAltitude() << " ft." << std::endl;
+                emit(EventEnums::kEvent_Descended, airplane, NULL, NULL, airplane->getAltitude());
 
                 airplane->setActionTimer(0);
             } else {
@@ -314,25 +863,22 @@ void Simulator::DescendTo3000ft(Airplane* airplane) {
             Runway* runway = airport->getFreeCompatibleRunway(airplane);
 
             if(runway != NULL) {
-                airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-                airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", cleared ILS approach runway " << runway->getName() << '.' << std::endl;
+                emit(EventEnums::kEvent_TowerClearedILSApproach, airplane, runway);
 
                 airplane->setRunway(runway);
-                runway->setAirplane(airplane);
+                setRunwayAirplane(runway, airplane);
 
                 airplane->setPermission(true);
             } else {
-                airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-                airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", hold south on the one eighty radial, expect further clearance in 5 minutes." << std::endl;
+                emit(EventEnums::kEvent_TowerHoldSouth, airplane, NULL, NULL, 5);
 
                 airplane->setPermission(false);
             }
         } else if (airplane->getCommunicationTimer() == 1) {
             if (airplane->hasPermission()) {
-                airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-                airTrafficController << "$ Cleared ILS approach runway " << airplane->getRunway()->getName() << ", " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << '.' << std::endl;
+                emit(EventEnums::kEvent_PilotClearedILSApproach, airplane, airplane->getRunway());
 
-                outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has begun its final approach to runway " << airplane->getRunway()->getName() << " at " << airport->getAirportName() << "." << std::endl;
+                emit(EventEnums::kEvent_FinalApproachBegun, airplane, airplane->getRunway());
 
                 airplane->setStatus(AirplaneEnums::kStatus_FinalApproach);
                 airport->set3000ft(NULL);
@@ -341,10 +887,9 @@ void Simulator::DescendTo3000ft(Airplane* airplane) {
                 airplane->setCommunicationTimer(0);
                 airplane->setPermission(false);
             } else {
-                airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-                airTrafficController << "$ Holding south on the one eighty radial, " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << '.' << std::endl;
+                emit(EventEnums::kEvent_PilotHoldSouth, airplane);
 
-                outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " is flying in a waiting pattern at 3000 ft." << std::endl;
+                emit(EventEnums::kEvent_FlyingWaitPattern, airplane, NULL, NULL, 3000);
 
                 airplane->setStatus(AirplaneEnums::kStatus_FlyingWaitPattern);
 
@@ -363,17 +908,15 @@ void Simulator::FlyWaitingPattern(Airplane* airplane) {
     if (airplane->getAltitude() == 5000) {
         if (airplane->getCommunicationTimer() == 0) {
             if (airport->is3000ftVacant()) {
-                airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-                airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", descend and maintain three thousand feet." << std::endl;
+                emit(EventEnums::kEvent_TowerDescendTo3000ft, airplane);
 
                 airplane->setPermission(true);
                 airplane->increaseCommunicationTimer();
             }
         } else if (airplane->getCommunicationTimer() == 1) {
-            airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-            airTrafficController << "$ Descend and maintain three thousand feet, " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << '.' << std::endl;
+            emit(EventEnums::kEvent_PilotDescendTo3000ft, airplane);
 
-            outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has begun its descent to 3000 ft" << std::endl;
+            emit(EventEnums::kEvent_WaitPatternDescentTo3000ftBegun, airplane);
 
             airport->set3000ft(airplane);
             airport->set5000ft(NULL);
@@ -390,24 +933,23 @@ void Simulator::FlyWaitingPattern(Airplane* airplane) {
             Runway* runway = airport->getFreeCompatibleRunway(airplane);
 
             if (runway != NULL) {
-                airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-                airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", cleared ILS approach runway " << runway->getName() << '.' << std::endl;
+                emit(EventEnums::kEvent_TowerClearedILSApproach, airplane, runway);
 
                 airport->set3000ft(NULL);
                 airplane->setRunway(runway);
-                runway->setAirplane(airplane);
+                setRunwayAirplane(runway, airplane);
 
                 airplane->increaseCommunicationTimer();
                 airplane->setPermission(true);
             }
         } else if (airplane->getCommunicationTimer() == 1) {
-            airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-            airTrafficController << "$ Cleared ILS approach runway " << airplane->getRunway()->getName() << ", " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << '.' << std::endl;
+            emit(EventEnums::kEvent_PilotClearedILSApproach, airplane, airplane->getRunway());
 
-            outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has begun its final approach to runway " << airplane->getRunway()->getName() << " at " << airport->getAirportName() << "." << std::endl;
+            emit(EventEnums::kEvent_FinalApproachBegun, airplane, airplane->getRunway());
 
             airplane->setStatus(AirplaneEnums::kStatus_FinalApproach);
-            airport->set3000ft(NULL);
+            // the slot was released when the runway was given, another airplane may hold it by now
+            if (airport->get3000ft() == airplane) airport->set3000ft(NULL);
 
             airplane->setActionTimer(0);
             airplane->setCommunicationTimer(0);
@@ -425,7 +967,7 @@ void Simulator::FinalApproach(Airplane* airplane) {
         if (airplane->descend(1000)) {
             airplane->setActionTimer(0);
 
-            outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has descended to " << airplane->getAltitude() << " ft" << std::endl;
+            emit(EventEnums::kEvent_FinalApproachDescended, airplane, NULL, NULL, airplane->getAltitude());
         } else {
             errorStream << "Shouldn't happen" << std::endl;
         }
@@ -443,7 +985,7 @@ void Simulator::Land(Airplane* airplane) {
 
     airplane->increaseActionTimer();
     if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
-        outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has landed on runway " << airplane->getRunway()->getName() << std::endl;
+        emit(EventEnums::kEvent_Landed, airplane, airplane->getRunway());
 
         airplane->setStatus(AirplaneEnums::kStatus_Vacate);
         airplane->setCurrentLocation(airplane->getRunway());
@@ -454,13 +996,12 @@ void Simulator::Vacate(Airplane* airplane) {
     REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
     REQUIRE(airplane->getStatus() == AirplaneEnums::kStatus_Vacate, "Airplane is not in the correct status.");
 
-    outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has vacated runway " << airplane->getRunway()->getName() << std::endl;
+    emit(EventEnums::kEvent_Vacated, airplane, airplane->getRunway());
 
-    airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-    airTrafficController << "$ " << airport->getCallsign() << ", " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << " runway " << airplane->getRunway()->getName() << " vacated." << std::endl;
+    emit(EventEnums::kEvent_PilotVacated, airplane, airplane->getRunway());
 
     airplane->setCurrentLocation(airplane->getRunway()->getPreviousLocation());
-    airplane->getRunway()->setAirplane(NULL);
+    setRunwayAirplane(airplane->getRunway(), NULL);
     airplane->setRunway(NULL);
     airplane->setTaxiRoute(airport->createTaxiRouteToGates(airplane->getCurrentLocation()));
     if (airplane->getTaxiRoute().size() == 0) {
@@ -477,14 +1018,12 @@ void Simulator::TaxiToCrossing(Airplane* airplane) {
     switch (airplane->getCommunicationTimer()) {
         case 0:
             if (airplane->getActionTimer() == 0) {
-                airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-                airTrafficController << "$ Taxi to holding point " << airplane->getTaxiRoute().front()->getName() << " via " << airplane->getCurrentLocation()->getName() << '.' << std::endl;
+                emit(EventEnums::kEvent_PilotTaxiToHoldingPoint, airplane, airplane->getTaxiRoute().front(), airplane->getCurrentLocation());
             }
 
             airplane->increaseActionTimer();
             if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
-                airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-                airTrafficController << "$ " << airport->getCallsign() << ", " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", holding short at " << airplane->getTaxiRoute().front()->getName() << '.' << std::endl;
+                emit(EventEnums::kEvent_PilotHoldingShort, airplane, airplane->getTaxiRoute().front());
                 airplane->increaseCommunicationTimer();
             }
             break;
@@ -493,10 +1032,9 @@ void Simulator::TaxiToCrossing(Airplane* airplane) {
 
             if (crossingRunway != NULL) {
                 if (crossingRunway->canCross()) {
-                    airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-                    airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", cleared to cross " << airplane->getTaxiRoute().front()->getName() << '.' << std::endl;
+                    emit(EventEnums::kEvent_TowerClearedToCross, airplane, airplane->getTaxiRoute().front());
 
-                    crossingRunway->setCrossingAirplane(airplane);
+                    setCrossingAirplane(crossingRunway, airplane);
                     airplane->setCurrentLocation(airplane->getTaxiRoute().front());
                     airplane->getTaxiRoute().pop();
 
@@ -505,8 +1043,7 @@ void Simulator::TaxiToCrossing(Airplane* airplane) {
                     airplane->setActionTimer(0);
                     airplane->setPermission(false);
                 } else {
-                    airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-                    airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", hold position." << std::endl;
+                    emit(EventEnums::kEvent_TowerHoldPosition, airplane);
 
                     airplane->setStatus(AirplaneEnums::kStatus_WaitingAtCrossing);
                     airplane->setCommunicationTimer(0);
@@ -526,8 +1063,7 @@ void Simulator::WaitingAtCrossing(Airplane* airplane) {
 
     switch (airplane->getCommunicationTimer()) {
         case 0:
-            airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-            airTrafficController << "$ Holding position, " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << '.' << std::endl;
+            emit(EventEnums::kEvent_PilotHoldPosition, airplane);
             airplane->increaseCommunicationTimer();
             break;
         case 1:
@@ -535,14 +1071,12 @@ void Simulator::WaitingAtCrossing(Airplane* airplane) {
 
             if (crossingRunway != NULL) {
                 if (crossingRunway->canCross()) {
-                    airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-                    airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", cleared to cross " << airplane->getTaxiRoute().front()->getName() << '.'
-                                         << std::endl;
+                    emit(EventEnums::kEvent_TowerClearedToCross, airplane, airplane->getTaxiRoute().front());
 
                     airplane->setCurrentLocation(airplane->getTaxiRoute().front());
                     airplane->getTaxiRoute().pop();
                     airplane->increaseCommunicationTimer();
-                    crossingRunway->setCrossingAirplane(airplane);
+                    setCrossingAirplane(crossingRunway, airplane);
 
                     airplane->setStatus(AirplaneEnums::kStatus_CrossingRunway);
                     airplane->setCommunicationTimer(0);
@@ -561,17 +1095,16 @@ void Simulator::CrossRunway(Airplane* airplane) {
     REQUIRE(airplane->getStatus() == AirplaneEnums::kStatus_CrossingRunway, "Airplane is not in the correct status.");
 
     if (airplane->getActionTimer() == 0) {
-        airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-        airTrafficController << "$ Cleared to cross " << airplane->getCurrentLocation()->getName() << ", " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << '.' << std::endl;
+        emit(EventEnums::kEvent_PilotClearedToCross, airplane, airplane->getCurrentLocation());
     }
 
     airplane->increaseActionTimer();
     if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
         Runway* crossingRunway = airport->getRunwayByName(airplane->getCurrentLocation()->getName());
 
-        crossingRunway->setCrossingAirplane(NULL);
+        setCrossingAirplane(crossingRunway, NULL);
         airplane->setCurrentLocation(airplane->getTaxiRoute().front());
-        outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " is now on taxipoint " << airplane->getCurrentLocation()->getName() << std::endl;
+        emit(EventEnums::kEvent_OnTaxipoint, airplane, airplane->getCurrentLocation());
         airplane->getTaxiRoute().pop();
 
         airplane->setCommunicationTimer(0);
@@ -580,16 +1113,14 @@ void Simulator::CrossRunway(Airplane* airplane) {
 
         if (airplane->getTaxiRoute().empty()) {
             if (airplane->getRunway() == NULL) {
-                airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-                airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", taxi to apron via " << airplane->getCurrentLocation()->getName() << '.' << std::endl;
+                emit(EventEnums::kEvent_TowerTaxiToApron, airplane, NULL, airplane->getCurrentLocation());
 
                 airplane->setStatus(AirplaneEnums::kStatus_TaxiingToApron);
             } else {
                 airplane->setStatus(AirplaneEnums::kStatus_TaxiingToRunway);
             }
         } else {
-            airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-            airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", taxi to holding point " << airplane->getTaxiRoute().front()->getName() << " via " << airplane->getCurrentLocation()->getName() << '.' << std::endl;
+            emit(EventEnums::kEvent_TowerTaxiToHoldingPoint, airplane, airplane->getTaxiRoute().front(), airplane->getCurrentLocation());
 
             airplane->setStatus(AirplaneEnums::kStatus_TaxiingToCrossing);
         }
@@ -602,29 +1133,26 @@ void Simulator::TaxiToApron(Airplane* airplane) {
 
     switch (airplane->getCommunicationTimer()) {
         case 0:
-            airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-            airTrafficController << "$ Taxi to apron via " << airplane->getCurrentLocation()->getName() << ", " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << '.' << std::endl;
+            emit(EventEnums::kEvent_PilotTaxiToApron, airplane, NULL, airplane->getCurrentLocation());
             airplane->increaseCommunicationTimer();
             break;
         case 1:
             airplane->increaseActionTimer();
             if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
                 if (airport->reserveGate(airplane)) {
-                    airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-                    airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", taxi to gate " << airplane->getGate() + 1 << '.' << std::endl;
+                    emit(EventEnums::kEvent_TowerTaxiToGate, airplane);
                     airplane->increaseCommunicationTimer();
                 }
             }
             break;
         case 2:
-            airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-            airTrafficController << "$ Taxi to gate " << airplane->getGate() + 1 << ", " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << '.' << std::endl;
+            emit(EventEnums::kEvent_PilotTaxiToGate, airplane);
 
             if (airplane->getSquawk() == 07700) {
-                outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has entered gate " << airplane->getGate() + 1 << " after an emergency landing" << std::endl;
+                emit(EventEnums::kEvent_EmergencyEnteredGate, airplane);
                 airplane->setStatus(AirplaneEnums::kStatus_Boarding);
             } else {
-                outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has entered gate " << airplane->getGate() + 1 << std::endl;
+                emit(EventEnums::kEvent_EnteredGate, airplane);
                 airplane->setStatus(AirplaneEnums::kStatus_Unboarding);
             }
 
@@ -643,22 +1171,19 @@ void Simulator::TaxiToRunway(Airplane* airplane) {
 
     switch (airplane->getCommunicationTimer()) {
         case 0:
-            airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-            airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", taxi to runway " << airplane->getRunway()->getName() << " via " << airplane->getCurrentLocation()->getName() << '.' << std::endl;
+            emit(EventEnums::kEvent_TowerTaxiToRunway, airplane, airplane->getRunway(), airplane->getCurrentLocation());
             airplane->increaseCommunicationTimer();
             break;
         case 1:
             if (airplane->getActionTimer() == 0) {
-                airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-                airTrafficController << "$ Taxi to runway " << airplane->getRunway()->getName() << " via " << airplane->getCurrentLocation()->getName() << ", " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << '.' << std::endl;
+                emit(EventEnums::kEvent_PilotTaxiToRunway, airplane, airplane->getRunway(), airplane->getCurrentLocation());
             }
 
             airplane->increaseActionTimer();
             if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
-                airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-                airTrafficController << "$ " << airport->getCallsign() << ", " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", holding short at " << airplane->getRunway()->getName() << '.' << std::endl;
+                emit(EventEnums::kEvent_PilotHoldingShort, airplane, airplane->getRunway());
 
-                outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " is holding short at runway " << airplane->getRunway()->getName() << std::endl;
+                emit(EventEnums::kEvent_HoldingShortAtRunway, airplane, airplane->getRunway());
 
                 airplane->setStatus(AirplaneEnums::kStatus_HoldingShort);
                 airplane->setCommunicationTimer(0);
@@ -674,8 +1199,7 @@ void Simulator::UnboardAirplane(Airplane* airplane) {
     REQUIRE(airplane->getStatus() == AirplaneEnums::kStatus_Unboarding, "Airplane is not in the correct status.");
     airplane->increaseActionTimer();
     if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
-        outputStream << getRealisticTimeStamp() << ' ' << airplane->getPassengers() << " passengers exited " << airplane->getCallsign()
-                    << " at gate " << airplane->getGate() + 1 << " of " << airport->getAirportName() << std::endl;
+        emit(EventEnums::kEvent_PassengersExited, airplane, NULL, NULL, airplane->getPassengers());
         airplane->setPassengers(0);
 
         airplane->setStatus(AirplaneEnums::kStatus_TechnicalCheckup);
@@ -688,7 +1212,7 @@ void Simulator::TechnicalCheckup(Airplane* airplane) {
     REQUIRE(airplane->getStatus() == AirplaneEnums::kStatus_TechnicalCheckup, "Airplane is not in the correct status.");
     airplane->increaseActionTimer();
     if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
-        outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has been checked for technical malfunctions" << std::endl;
+        emit(EventEnums::kEvent_TechnicalCheckupDone, airplane);
 
         airplane->setStatus(AirplaneEnums::kStatus_Refueling);
         airplane->setActionTimer(0);
@@ -701,7 +1225,7 @@ void Simulator::Refuel(Airplane* airplane) {
 
     airplane->increaseActionTimer();
     if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
-        outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has been refueled (" << airplane->getFuelCapacity() - airplane->getFuel() << " units)" << std::endl;
+        emit(EventEnums::kEvent_Refueled, airplane, NULL, NULL, airplane->getFuelCapacity() - airplane->getFuel());
         airplane->setFuel(airplane->getFuelCapacity());
 
         airplane->setStatus(AirplaneEnums::kStatus_Boarding);
@@ -716,7 +1240,7 @@ void Simulator::BoardAirplane(Airplane* airplane) {
     airplane->increaseActionTimer();
     if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
         airplane->setPassengers(airplane->getPassengerCapacity());
-        outputStream << getRealisticTimeStamp() << ' ' << airplane->getPassengers() << " passengers boarded " << airplane->getCallsign() << " at gate " << airplane->getGate() + 1 << " of " << airport->getAirportName() << std::endl;
+        emit(EventEnums::kEvent_PassengersBoarded, airplane, NULL, NULL, airplane->getPassengers());
 
         airplane->setStatus(AirplaneEnums::kStatus_StandingAtGate);
         airplane->setActionTimer(0);
@@ -730,29 +1254,26 @@ void Simulator::StandAtGate(Airplane* airplane) {
     switch(airplane->getCommunicationTimer()) {
         case 0:
             {
+                // a scheduled departure does not request its clearance before its departure time
+                if (timer < airplane->getDepartureTime()) break;
+
                 Runway* runway = airport->getFreeCompatibleRunway(airplane);
 
                 if (runway != NULL) {
                     airplane->setTaxiRoute(airport->createTaxiRouteToRunway(runway));
                     airplane->setRunway(runway);
-                    airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-                    airTrafficController << "$ " << airport->getCallsign() << ", " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", requesting IFR clearancy to <my destination - no flightplan implemented>." << std::endl;
+                    emit(EventEnums::kEvent_PilotRequestIFRClearance, airplane);
                     airplane->increaseCommunicationTimer();
                 }
             }
             break;
         case 1:
-            airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-            airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", " << airport->getCallsign()
-                                 << ", cleared to <your destination - no flightplan implemented>, maintain five thousand, expect flight level one zero zero - ten minutes after departure, squawk "
-                                 << std::oct << airplane->getSquawk() << std::dec << '.' << std::endl;
+            emit(EventEnums::kEvent_TowerIFRClearance, airplane, NULL, NULL, airplane->getSquawk());
 
             airplane->increaseCommunicationTimer();
             break;
         case 2:
-            airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-            airTrafficController << "$ Cleared to <my destination - no flightplan implemented>, initial altitude five thousand, expecting one zero zero in ten, squawking "
-                                 << std::oct << airplane->getSquawk() << std::dec << '.' << std::endl;
+            emit(EventEnums::kEvent_PilotIFRClearance, airplane, NULL, NULL, airplane->getSquawk());
 
             airplane->setStatus(AirplaneEnums::kStatus_PushingBack);
             airplane->setActionTimer(0);
@@ -768,26 +1289,23 @@ void Simulator::Pushback(Airplane* airplane) {
 
     switch(airplane->getCommunicationTimer()) {
         case 0:
-            airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-            airTrafficController << "$ " << airport->getCallsign() << ", " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", at gate " << airplane->getGate() + 1 << ", requesting pushback." << std::endl;
+            emit(EventEnums::kEvent_PilotRequestPushback, airplane);
             airplane->increaseCommunicationTimer();
             break;
         case 1:
-            airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-            airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", " << airport->getCallsign() << ", pushback approved." << std::endl;
+            emit(EventEnums::kEvent_TowerPushbackApproved, airplane);
             airplane->increaseCommunicationTimer();
             break;
         case 2:
             if (airplane->getActionTimer() == 0) {
-                airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-                airTrafficController << "$ Pushback approved, " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << '.' << std::endl;
+                emit(EventEnums::kEvent_PilotPushbackApproved, airplane);
 
-                outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " is pushing back from gate " << airplane->getGate() + 1 << std::endl;
+                emit(EventEnums::kEvent_PushbackBegun, airplane);
             }
 
             airplane->increaseActionTimer();
             if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
-                outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " succesfully pushed back from gate " << airplane->getGate() + 1 << std::endl;
+                emit(EventEnums::kEvent_PushbackDone, airplane);
                 airport->exitGate(airplane);
                 airplane->setCurrentLocation(airport->getConnectionToApron());
                 airplane->setActionTimer(0);
@@ -795,8 +1313,7 @@ void Simulator::Pushback(Airplane* airplane) {
             }
             break;
         case 3:
-            airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-            airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << " is ready to taxi." << std::endl;
+            emit(EventEnums::kEvent_PilotReadyToTaxi, airplane);
 
             airplane->setActionTimer(0);
             airplane->setCommunicationTimer(0);
@@ -816,13 +1333,12 @@ void Simulator::HoldShort(Airplane* airplane) {
     REQUIRE(airplane->getStatus() == AirplaneEnums::kStatus_HoldingShort, "Airplane is not in the correct status.");
 
     if (airplane->getRunway()->isVacant()) {
-        airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-        airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", line-up at runway " << airplane->getRunway()->getName() << " and wait." << std::endl;
+        emit(EventEnums::kEvent_TowerLineUp, airplane, airplane->getRunway());
 
-        outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " is now lining up on runway " << airplane->getRunway()->getName() << std::endl;
+        emit(EventEnums::kEvent_LiningUp, airplane, airplane->getRunway());
 
         airplane->setCurrentLocation(airplane->getRunway());
-        airplane->getRunway()->setAirplane(airplane);
+        setRunwayAirplane(airplane->getRunway(), airplane);
 
         airplane->setStatus(AirplaneEnums::kStatus_LiningUp);
         airplane->setCommunicationTimer(0);
@@ -837,10 +1353,9 @@ void Simulator::LineUp(Airplane* airplane) {
 
     airplane->increaseActionTimer();
     if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
-        airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-        airTrafficController << "$ " << airport->getCallsign() << ", " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", finished line-up at " << airplane->getRunway()->getName() << " and ready for take off." << std::endl;
+        emit(EventEnums::kEvent_PilotLinedUp, airplane, airplane->getRunway());
 
-        outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has lined up on runway " << airplane->getRunway()->getName() << std::endl;
+        emit(EventEnums::kEvent_LinedUp, airplane, airplane->getRunway());
 
         airplane->setStatus(AirplaneEnums::kStatus_ReadyForTakeoff);
         airplane->setCommunicationTimer(0);
@@ -855,15 +1370,13 @@ void Simulator::ReadyForTakeoff(Airplane* airplane) {
 
     switch(airplane->getCommunicationTimer()) {
         case 0:
-            airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-            airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", runway " << airplane->getRunway()->getName() << " cleared for take-off." << std::endl;
+            emit(EventEnums::kEvent_TowerClearedForTakeoff, airplane, airplane->getRunway());
             airplane->increaseCommunicationTimer();
             break;
         case 1:
-            airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-            airTrafficController << "$ Runway " << airplane->getRunway()->getName() << " cleared for take-off, " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << '.' << std::endl;
+            emit(EventEnums::kEvent_PilotClearedForTakeoff, airplane, airplane->getRunway());
 
-            outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " is taking off" << std::endl;
+            emit(EventEnums::kEvent_TakingOff, airplane);
 
             airplane->setStatus(AirplaneEnums::kStatus_TakingOff);
             break;
@@ -876,9 +1389,9 @@ void Simulator::Takeoff(Airplane* airplane) {
 
     airplane->increaseActionTimer();
     if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
-        outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has taken off from runway " << airplane->getRunway()->getName() << std::endl;
+        emit(EventEnums::kEvent_TookOff, airplane, airplane->getRunway());
 
-        airplane->getRunway()->setAirplane(NULL);
+        setRunwayAirplane(airplane->getRunway(), NULL);
         airplane->setCurrentLocation(NULL);
         airplane->setRunway(NULL);
 
@@ -896,12 +1409,12 @@ void Simulator::Ascend(Airplane* airplane) {
         airplane->ascend(1000);
 
         if (airplane->getAltitude() >= 5000) {
-            outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " ascended to " << airplane->getAltitude() << " ft. and has left " << airport->getAirportName() << std::endl;
+            emit(EventEnums::kEvent_LeftAirport, airplane, NULL, NULL, airplane->getAltitude());
 
             airplane->setStatus(AirplaneEnums::kStatus_LeftAirport);
             airplane->setActionTimer(0);
         } else {
-            outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " ascended to " << airplane->getAltitude() << " ft." << std::endl;
+            emit(EventEnums::kEvent_Ascended, airplane, NULL, NULL, airplane->getAltitude());
         }
     }
 }
@@ -914,18 +1427,14 @@ void Simulator::Emergency(Airplane* airplane) {
     switch (airplane->getCommunicationTimer()) {
         case 0:
             if (airplane->getAltitude() < 3000) {
-                airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-                airTrafficController << "$ Mayday mayday mayday, " << airport->getCallsign() << ", " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", out of fuel, performing emergency landing, "
-                                     << airplane->getPassengers() << " passengers on board." << std::endl;
+                emit(EventEnums::kEvent_PilotMaydayLanding, airplane, NULL, NULL, airplane->getPassengers());
 
                 airplane->setStatus(AirplaneEnums::kStatus_FinalApproach);
                 airplane->setCommunicationTimer(0);
                 airplane->setActionTimer(0);
                 airplane->setPermission(false);
             } else {
-                airTrafficController << getRealisticTimeStamp() << '[' << airplane->getNumber() << ']' << std::endl;
-                airTrafficController << "$ Mayday mayday mayday, " << airport->getCallsign() << ", " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", out of fuel, request immediate landing, "
-                                     << airplane->getPassengers() << " passengers on board." << std::endl;
+                emit(EventEnums::kEvent_PilotMaydayRequest, airplane, NULL, NULL, airplane->getPassengers());
                 airplane->increaseCommunicationTimer();
             }
             break;
@@ -934,19 +1443,17 @@ void Simulator::Emergency(Airplane* airplane) {
                 Runway* runway = airport->getFreeCompatibleRunway(airplane);
 
                 if (runway != NULL) {
-                    airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-                    airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << " roger mayday, squawk seven seven zero zero, cleared ILS landing runway " << runway->getName() << '.' << std::endl;
+                    emit(EventEnums::kEvent_TowerMaydayClearedILSLanding, airplane, runway);
 
                     airplane->setRunway(runway);
-                    runway->setAirplane(airplane);
+                    setRunwayAirplane(runway, airplane);
 
                     airplane->setStatus(AirplaneEnums::kStatus_EmergencyFinalApproach);
                     airplane->setCommunicationTimer(0);
                     airplane->setActionTimer(0);
                     airplane->setPermission(false);
                 } else {
-                    airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-                    airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << " roger mayday, squawk seven seven zero zero, glide until a free runway is available." << std::endl;
+                    emit(EventEnums::kEvent_TowerMaydayGlide, airplane);
                     airplane->increaseCommunicationTimer();
                 }
             }
@@ -955,7 +1462,7 @@ void Simulator::Emergency(Airplane* airplane) {
             Runway* runway = airport->getFreeCompatibleRunway(airplane);
 
             if (airplane->getAltitude() <= 0) {
-                outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " crashed with " << airplane->getPassengers() << " passengers aboard." << std::endl;
+                emit(EventEnums::kEvent_Crashed, airplane, NULL, NULL, airplane->getPassengers());
 
                 airplane->setStatus(AirplaneEnums::kStatus_Crashed);
                 airplane->setCommunicationTimer(0);
@@ -964,8 +1471,7 @@ void Simulator::Emergency(Airplane* airplane) {
             }
 
             if (runway != NULL) {
-                airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-                airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", cleared ILS landing runway " << runway->getName() << '.' << std::endl;
+                emit(EventEnums::kEvent_TowerClearedILSLanding, airplane, runway);
 
                 airplane->setStatus(AirplaneEnums::kStatus_FinalApproach);
                 airplane->setCommunicationTimer(0);
@@ -993,13 +1499,12 @@ void Simulator::EmergencyFinalApproach(Airplane* airplane) {
     }*/
 
     if (airplane->getCommunicationTimer() == 0) {
-        airTrafficController << getRealisticTimeStamp() << '[' << airport->getIata() << ']' << std::endl;
-        airTrafficController << "$ " << convertPartialNumbersToNATOAlphabet(airplane->getCallsign()) << ", emergency personel on standby, good luck!" << std::endl;
+        emit(EventEnums::kEvent_TowerEmergencyStandby, airplane);
         airplane->increaseCommunicationTimer();
     }
 
     if (airplane->getAltitude() == 0) {
-        outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " is making an emergency landing on " << airplane->getRunway()->getName() << std::endl;
+        emit(EventEnums::kEvent_EmergencyLandingBegun, airplane, airplane->getRunway());
 
         airplane->setStatus(AirplaneEnums::kStatus_EmergencyLanding);
         airplane->setCommunicationTimer(0);
@@ -1014,7 +1519,7 @@ void Simulator::EmergencyLand(Airplane* airplane) {
 
     airplane->increaseActionTimer();
     if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
-        outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has successfully performed an emergency landed on runway " << airplane->getRunway()->getName() << std::endl;
+        emit(EventEnums::kEvent_EmergencyLanded, airplane, airplane->getRunway());
 
         airplane->setStatus(AirplaneEnums::kStatus_EmergencyEvacuation);
         airplane->setCurrentLocation(airplane->getRunway());
@@ -1026,8 +1531,7 @@ void Simulator::EmergencyEvacuate(Airplane* airplane) {
     REQUIRE(airplane->getStatus() == AirplaneEnums::kStatus_EmergencyEvacuation, "Airplane is not in the correct status.");
     airplane->increaseActionTimer();
     if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
-        outputStream << getRealisticTimeStamp() << ' ' << airplane->getPassengers() << " passengers evacuated " << airplane->getCallsign()
-                     << " after an emergency landing on runway " << airplane->getRunway()->getName() << std::endl;
+        emit(EventEnums::kEvent_PassengersEvacuated, airplane, airplane->getRunway(), NULL, airplane->getPassengers());
         airplane->setPassengers(0);
 
         airplane->setStatus(AirplaneEnums::kStatus_EmergencyCheckup);
@@ -1040,7 +1544,7 @@ void Simulator::EmergencyCheckup(Airplane* airplane) {
     REQUIRE(airplane->getStatus() == AirplaneEnums::kStatus_EmergencyCheckup, "Airplane is not in the correct status.");
     airplane->increaseActionTimer();
     if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
-        outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has been checked for technical malfunctions after an emergency landing on runway " << airplane->getRunway()->getName() << std::endl;
+        emit(EventEnums::kEvent_EmergencyCheckupDone, airplane, airplane->getRunway());
 
         airplane->setStatus(AirplaneEnums::kStatus_EmergencyRefueling);
         airplane->setActionTimer(0);
@@ -1053,102 +1557,43 @@ void Simulator::EmergencyRefuel(Airplane* airplane) {
 
     airplane->increaseActionTimer();
     if (airplane->getActionTimer() >= getTimeNeededForAction(airplane)) {
-        outputStream << getRealisticTimeStamp() << ' ' << airplane->getCallsign() << " has been refueled (" << airplane->getFuelCapacity() - airplane->getFuel()
-                     << " units) after an emergency landing on runway " << airplane->getRunway()->getName() << std::endl;
+        emit(EventEnums::kEvent_EmergencyRefueled, airplane, airplane->getRunway(), NULL, airplane->getFuelCapacity() - airplane->getFuel());
         airplane->setFuel(airplane->getFuelCapacity());
 
         airplane->setStatus(AirplaneEnums::kStatus_Vacate);
 
-        AirplaneEnums::EType airplaneType = airplane->getType();
-        AirplaneEnums::ESize airplaneSize = airplane->getSize();
-        AirplaneEnums::EEngine airplaneEngine = airplane->getEngine();
-
-        unsigned int offset = 00;
-
-        if (airplaneType == AirplaneEnums::kType_Private) {
-            if (airplaneSize == AirplaneEnums::kSize_Small) {
-                offset = 01;
-            } else if (airplaneSize == AirplaneEnums::kSize_Medium) {
-                if (airplaneEngine == AirplaneEnums::kEngine_Jet) { offset = 01000; }
-            }
-        } else if (airplaneType == AirplaneEnums::kType_Airline) {
-            if (airplaneSize == AirplaneEnums::kSize_Medium) {
-                if (airplaneEngine == AirplaneEnums::kEngine_Propeller) { offset = 02000; }
-                else if (airplaneEngine == AirplaneEnums::kEngine_Jet) { offset = 03000; }
-            } else if (airplaneSize == AirplaneEnums::kSize_Large) {
-                if (airplaneEngine == AirplaneEnums::kEngine_Jet) { offset = 04000; }
-            }
-        } else if (airplaneType == AirplaneEnums::kType_Military) {
-            if (airplaneSize == AirplaneEnums::kSize_Small) {
-                if (airplaneEngine == AirplaneEnums::kEngine_Jet) { offset = 05000; }
-            } else if (airplaneSize == AirplaneEnums::kSize_Large) {
-                if (airplaneEngine == AirplaneEnums::kEngine_Propeller) { offset = 05000; }
-            }
-        } else if (airplaneType == AirplaneEnums::kType_Emergency) {
-            if (airplaneSize == AirplaneEnums::kSize_Small) {
-                if (airplaneEngine == AirplaneEnums::kEngine_Propeller) { offset = 06000; }
-            }
-        }
-
-        AirplaneMap::iterator it_airplane = airport->getAirplanes().find(airplane->getNumber());
-
-        if (it_airplane == airport->getAirplanes().end()) {
+        // the code the Airplane had before its emergency, its position at the Airport changes once Airplanes are retired
+        if (airplane->getAssignedSquawk() == 00) {
             errorStream << "Shouldn't happen" << std::endl;
         } else {
-            airplane->setSquawk(offset + std::distance(airport->getAirplanes().begin(), it_airplane));
+            airplane->setSquawk(airplane->getAssignedSquawk());
         }
     }
 }
 
 unsigned int Simulator::getTimeNeededForAction(const Airplane* airplane) {
-    switch (airplane->getStatus()) {
-        case AirplaneEnums::kStatus_Ascending:
-        case AirplaneEnums::kStatus_DescendingTo3000ft:
-        case AirplaneEnums::kStatus_DescendingTo5000ft:
-        case AirplaneEnums::kStatus_FinalApproach:
-        case AirplaneEnums::kStatus_EmergencyFinalApproach:
-            if (airplane->getEngine() == AirplaneEnums::kEngine_Propeller) return 2;
-            else if (airplane->getEngine() == AirplaneEnums::kEngine_Jet) return 1;
+    const AirplaneEnums::EStatus status = airplane->getStatus();
+    const AircraftType* aircraftType = airplane->getAircraftType();
+
+    unsigned int ticks = aircraftType->actionTimes[status];
+    switch (status) {
+        case AirplaneEnums::kStatus_Refueling:
+        case AirplaneEnums::kStatus_EmergencyRefueling:
+            ticks = (airplane->getFuelCapacity() - airplane->getFuel() + aircraftType->refuelRate - 1) / aircraftType->refuelRate;
             break;
-        case AirplaneEnums::kStatus_EmergencyLanding:
-        case AirplaneEnums::kStatus_Landing:
-            return 2;
-        case AirplaneEnums::kStatus_TaxiingToApron:
-        case AirplaneEnums::kStatus_TaxiingToRunway:
-        case AirplaneEnums::kStatus_TaxiingToCrossing:
-            return 5;
-        case AirplaneEnums::kStatus_LiningUp:
-            return 1;
-        case AirplaneEnums::kStatus_CrossingRunway:
-            return 1;
-        case AirplaneEnums::kStatus_EmergencyEvacuation:
+        // an empty Airplane still takes a tick to open and close its doors, like any other action
         case AirplaneEnums::kStatus_Boarding:
-        case AirplaneEnums::kStatus_Unboarding:
-            if (airplane->getSize() == AirplaneEnums::kSize_Small) return 5;
-            else if (airplane->getSize() == AirplaneEnums::kSize_Medium) return 10;
-            else if (airplane->getSize() == AirplaneEnums::kSize_Large) return 15;
+            if (aircraftType->boardingRate != 0) ticks = std::max(1u, (airplane->getPassengerCapacity() + aircraftType->boardingRate - 1) / aircraftType->boardingRate);
             break;
-        case AirplaneEnums::kStatus_EmergencyCheckup:
-        case AirplaneEnums::kStatus_TechnicalCheckup:
-            if (airplane->getSize() == AirplaneEnums::kSize_Small) return 1;
-            else if (airplane->getSize() == AirplaneEnums::kSize_Medium) return 2;
-            else if (airplane->getSize() == AirplaneEnums::kSize_Large) return 3;
-            break;
-        case AirplaneEnums::kStatus_EmergencyRefueling:
-        case AirplaneEnums::kStatus_Refueling:
-            return static_cast<unsigned int>(std::ceil((airplane->getFuelCapacity() - airplane->getFuel()) / 10000.0));
-        case AirplaneEnums::kStatus_PushingBack:
-            if (airplane->getSize() == AirplaneEnums::kSize_Small) return 1;
-            else if (airplane->getSize() == AirplaneEnums::kSize_Medium) return 2;
-            else if (airplane->getSize() == AirplaneEnums::kSize_Large) return 3;
-            break;
-        case AirplaneEnums::kStatus_TakingOff:
-            if (airplane->getEngine() == AirplaneEnums::kEngine_Propeller) return 3;
-            else if (airplane->getEngine() == AirplaneEnums::kEngine_Jet) return 2;
+        case AirplaneEnums::kStatus_Unboarding:
+        case AirplaneEnums::kStatus_EmergencyEvacuation:
+            if (aircraftType->boardingRate != 0) ticks = std::max(1u, (airplane->getPassengers() + aircraftType->boardingRate - 1) / aircraftType->boardingRate);
             break;
         default:
             break;
     }
 
-    return 1;
-}
\ No newline at end of file
+    // the action timer counts the ticks since the action started
+    if (perturbation != NULL) ticks = perturbation->perturbAction(airplane, ticks, timer - airplane->getActionTimer());
+    return ticks;
+}
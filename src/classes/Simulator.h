@@ -3,38 +3,446 @@
 #include "Airport.h"
 #include "Airplane.h"
 #include "Runway.h"
+#include "PerformanceTable.h"
+#include "SimulationEvent.h"
+#include "EventRenderer.h"
+#include "SimulationProfile.h"
+#include "TraceWriter.h"
+#include "AllocationTracker.h"
+#include "StateDigest.h"
+#include "SimulationObserver.h"
+#include "OperationalStatistics.h"
+#include "TimeSeries.h"
+#include "TimingPerturbation.h"
+#include "../utils/PerfCounters.h"
 
 #include <iomanip>
 #include <sstream>
 #include <iostream>
 #include <string>
 #include <queue>
+#include <deque>
 #include <vector>
+#include <algorithm>
 #include <math.h>
 
+class Simulator;
+class FlightSchedule;
+
+/**
+ * A condition that runUntil checks before every tick, the Simulator is passed read only
+ */
+class SimulationCondition {
+public:
+    virtual ~SimulationCondition() {}
+
+    virtual bool holds(const Simulator& simulator) const = 0;
+};
+
 class Simulator {
+public:
+    /**
+     * The number of retired Airplanes that are deleted at once
+     */
+    static const unsigned int kRetireBatch = 64;
+
 private:
     unsigned int timer;
 
-    Airport* airport;
+    bool started;
+    bool finished;
+    unsigned long long phaseStart;
 
-    std::ostream& airTrafficController;
+    unsigned long long copyStart;
+    Airport* airport;
+    unsigned long long copyEnd;
 
-    std::ostream& floorplanStream;
-    std::ostream& outputStream;
     std::ostream& errorStream;
 
+    EventLog eventLog;
+    std::vector<EventRenderer*> renderers;
+    std::vector<EventRenderer*> ownedRenderers;
+    bool recordEvents;
+    unsigned int tickLimit;
+
+    SimulationProfile* profile;
+    std::ostream* profileStream;
+
+    TraceWriter* trace;
+
+    PerfCounters* perfCounters;
+
+    AllocationTracker* allocationTracker;
+
+    StateDigest* stateDigest;
+
+    OperationalStatistics* statistics;
+
+    TimeSeriesWriter* timeSeries;
+
+    const TimingPerturbation* perturbation;
+
+    FlightSchedule* schedule;
+    std::deque<Airplane*> waitingForGate;
+
+    /**
+     * Holds the codes of the Airplanes that have not left or crashed, only kept while a schedule is set
+     */
+    SquawkAllocator squawks;
+
+    bool retireAirplanes;
+    std::vector<Airplane*> retired;
+    unsigned long retiredCount;
+
+    std::vector<SimulationObserver*> observers;
+
+    /**
+     * What the observers are told about when it changes during a handler
+     */
+    struct ObservedState {
+        AirplaneEnums::EStatus status;
+        long gate;
+    };
+
+    /**
+     * The Runways the handled Airplane was cleared onto (true) or released (false) since the last notification,
+     * only kept while an observer is attached
+     */
+    std::vector<std::pair<const Runway*, bool> > runwayChanges;
+
     Simulator* init;
 
     bool properlyInitialized() const;
+
+    /**
+     * Appends an event about the Airplane to the event log, the current timer and gate are filled in
+     */
+    void emit(const EventEnums::EEvent type, const Airplane* airplane, const Location* location = NULL, const Location* via = NULL, const unsigned int value = 0);
+
+    /**
+     * Renders the event log with every attached renderer and clears it, the log is kept when no renderers are attached
+     */
+    void flushEvents();
+
+    /**
+     * Adds the time since start to the phase of the attached profile
+     * @return the current time, the start of the next phase
+     */
+    unsigned long long profilePhase(const ProfileEnums::EPhase phase, const unsigned long long start);
+
+    /**
+     * Writes the airplanes and queues counter tracks, the queues count the airplanes waiting for a shared resource
+     */
+    void traceQueues(const unsigned long active, const unsigned long long time);
+
+    /**
+     * Runs the handler of the Airplane's current status
+     */
+    void dispatch(Airplane* airplane);
+
+    /**
+     * Fills in the status and gate of the Airplane
+     */
+    void observe(const Airplane* airplane, ObservedState& state) const;
+
+    /**
+     * Tells every observer that accepts it how the Airplane changed since the state was observed and which Runways
+     * it acquired or released in between
+     */
+    void notifyObservers(const Airplane* airplane, const ObservedState& before);
+
+    /**
+     * Tells every observer that accepts it about an Airplane of the schedule that was just placed, as a transition
+     * from kStatus_InvalidStatus and the gate it was placed at
+     */
+    void notifyPlaced(const Airplane* airplane);
+
+    /**
+     * Clears the Airplane onto the Runway, NULL releases it, the change is kept for the observers
+     */
+    void setRunwayAirplane(Runway* runway, Airplane* airplane);
+
+    /**
+     * Clears the Airplane to cross the Runway, NULL releases it, the change is kept for the observers
+     */
+    void setCrossingAirplane(Runway* runway, Airplane* airplane);
+
+    /**
+     * Places the scheduled Airplanes that are due at the current timer, StandingAtGate Airplanes wait for a free gate
+     */
+    void placeScheduled();
+
+    /**
+     * Links a scheduled Airplane to the Airport and gives it a squawk and a gate, the Airplane is deleted if it can not
+     * be placed at all
+     * @return false if a StandingAtGate Airplane found no free gate, it stays with the caller
+     */
+    bool place(Airplane* airplane);
+
+    /**
+     * @return true if a gate, Runway or altitude slot still refers to the Airplane
+     */
+    bool isReferenced(const Airplane* airplane) const;
+
+    /**
+     * Unlinks the Airplanes that left or crashed, they are deleted in batches once no renderer can refer to them
+     */
+    void retire();
+
+    /**
+     * Deletes the retired Airplanes, the renderers are flushed first \n
+     * The event log must be empty, its events refer to the Airplanes
+     */
+    void deleteRetired();
+
+    /**
+     * Emits the starting events of every Airplane, the first tick is tick 1
+     */
+    void begin();
+
+    /**
+     * Prepares a stepping call, begins the simulation on the first one and restarts the phase timing
+     */
+    void resume();
+
+    /**
+     * Runs the handlers and renderers for the current timer and advances it
+     */
+    void tick();
 public:
+    /**
+     * Renders output_output, output_tower and output_floorplan to the streams at the end of every tick \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "Simulator was not properly initialized");
+     */
     Simulator(const Airport* _airport, std::ostream& _outputStream, std::ostream& _errorStream, std::ostream& _airTrafficControllerStream, std::ostream& _floorplanStream);
 
+    /**
+     * Renders nothing, the events are kept in the event log until they are rendered or recording is disabled \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "Simulator was not properly initialized");
+     */
+    Simulator(const Airport* _airport, std::ostream& _errorStream);
+
     ~Simulator();
 
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     * @return the Simulator's copy of the Airport, the events refer to its Airplanes and Locations
+     */
+    const Airport* getAirport() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     * @return the events that have not been rendered yet
+     */
+    const EventLog& getEventLog() const;
+
+    /**
+     * Attaches a renderer that is run over the events at the end of every tick, the Simulator does not take ownership \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized."); \n
+     * REQUIRE(renderer != NULL, "Referenced EventRenderer is a nullpointer.");
+     */
+    void addRenderer(EventRenderer* renderer);
+
+    /**
+     * Disabling recording drops every event, for runs where only the final state matters \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     */
+    void setRecordEvents(const bool _recordEvents);
+
+    /**
+     * Simulate stops after the timer passes the limit, the default of 11520 is eight days \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     */
+    void setTickLimit(const unsigned int _tickLimit);
+
+    /**
+     * Attaches a profile that Simulate fills in, no timing is done while no profile is attached \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     * @param _profile The profile to fill in, NULL detaches it, the Simulator does not take ownership
+     * @param _profileStream The stream the report is written to at the end of Simulate, NULL writes no report
+     */
+    void setProfile(SimulationProfile* _profile, std::ostream* _profileStream = NULL);
+
+    /**
+     * Attaches a trace that Simulate writes tick, handler and flush spans and the airplanes, queues and events counters to. \n
+     * The span of the Airport copy made by the constructor is written immediately. \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     * @param _trace NULL detaches the trace, the Simulator does not take ownership
+     */
+    void setTrace(TraceWriter* _trace);
+
+    /**
+     * Attaches counters that Simulate samples every tick, the simulate phase covers the handlers and the render phase
+     * the renderers, the flush phase is the final flush after the last tick \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     * @param _perfCounters NULL detaches the counters, the Simulator does not take ownership
+     */
+    void setPerfCounters(PerfCounters* _perfCounters);
+
+    /**
+     * Attaches a tracker that Simulate tells the current phase and ends every tick on, allocations after Simulate count as Other \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     * @param _allocationTracker NULL detaches the tracker, the Simulator does not take ownership
+     */
+    void setAllocationTracker(AllocationTracker* _allocationTracker);
+
+    /**
+     * Attaches a digest that Simulate records the Airport state on at the end of every tick \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     * @param _stateDigest NULL detaches the digest, the Simulator does not take ownership
+     */
+    void setStateDigest(StateDigest* _stateDigest);
+
+    /**
+     * Attaches statistics that Simulate samples the Airport on at the end of every tick \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     * @param _statistics NULL detaches the statistics, the Simulator does not take ownership
+     */
+    void setStatistics(OperationalStatistics* _statistics);
+
+    /**
+     * Attaches a time series that Simulate writes a row to at the end of every tick, its status counts are set to the
+     * Airplanes now and kept up to date by the handlers \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     * @param _timeSeries NULL detaches the time series, the Simulator does not take ownership
+     */
+    void setTimeSeries(TimeSeriesWriter* _timeSeries);
+
+    /**
+     * Attaches a perturbation that scales the action durations and the fuel burn, the simulation is no longer the
+     * deterministic one but the same perturbation seed replays the same run \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     * @param _perturbation NULL detaches the perturbation, the Simulator does not take ownership
+     */
+    void setPerturbation(const TimingPerturbation* _perturbation);
+
+    /**
+     * Attaches a schedule whose Airplanes are placed at the Airport at their tick, Airplanes of tick 0 are placed with
+     * the parsed ones. The simulation is not finished while the schedule has Airplanes left. \n
+     * Placed Airplanes get the next squawk of their block, StandingAtGate Airplanes the first free gate or they wait
+     * for one. Airplanes with an invalid combination or the registration of an Airplane at the Airport are rejected. \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     * @param _schedule NULL detaches the schedule, the Simulator does not take ownership
+     */
+    void setSchedule(FlightSchedule* _schedule);
+
+    /**
+     * Retiring unlinks the Airplanes that left or crashed from the Airport at the end of every tick and deletes them,
+     * which bounds the memory of a run to the concurrent traffic. Retired Airplanes are no longer in getAirport(),
+     * the outputs written from the Airport after the run do not contain them. \n
+     * While the event log is kept because no renderers are attached, retired Airplanes are only deleted with the Simulator. \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     */
+    void setRetireAirplanes(const bool _retireAirplanes);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     * @return the number of Airplanes that were retired so far
+     */
+    unsigned long getRetiredCount() const;
+
+    /**
+     * Attaches an observer that is told about the transitions, Runway and gate changes and emergencies of every tick,
+     * the Airplanes are only compared while an observer is attached \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized."); \n
+     * REQUIRE(observer != NULL, "Referenced SimulationObserver is a nullpointer.");
+     * @param observer The Simulator does not take ownership
+     */
+    void addObserver(SimulationObserver* observer);
+
+    /**
+     * Detaches the observer, observers that are not attached are ignored \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     */
+    void removeObserver(SimulationObserver* observer);
+
+    /**
+     * Runs the simulation until every Airplane left or crashed or the tick limit is passed, then finishes it \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized."); \n
+     * REQUIRE(!isFinished(), "Simulation is already finished.");
+     */
     void Simulate();
 
-    bool SimulationFinished();
+    /**
+     * Runs at most ticks ticks, less when the simulation stops first \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized."); \n
+     * REQUIRE(!isFinished(), "Simulation is already finished.");
+     * @return the number of ticks that were run
+     */
+    unsigned int step(const unsigned int ticks = 1);
+
+    /**
+     * Runs ticks until the timer reaches time, the tick at time itself is not run yet \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized."); \n
+     * REQUIRE(!isFinished(), "Simulation is already finished.");
+     * @return the number of ticks that were run
+     */
+    unsigned int runUntilTime(const unsigned int time);
+
+    /**
+     * Runs ticks until the condition holds, it is checked before every tick \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized."); \n
+     * REQUIRE(!isFinished(), "Simulation is already finished.");
+     * @return the number of ticks that were run
+     */
+    unsigned int runUntil(const SimulationCondition& condition);
+
+    /**
+     * Renders the remaining events and flushes the renderers, stepping is not possible afterwards \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized."); \n
+     * REQUIRE(!isFinished(), "Simulation is already finished."); \n
+     * POST: \n
+     * ENSURE(isFinished(), "Simulation was not finished.");
+     */
+    void finish();
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     * @return true if every Airplane left or crashed and the schedule is exhausted or the tick limit is passed, no more ticks will be run
+     */
+    bool isStopped() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     * @return true once finish was called
+     */
+    bool isFinished() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "Simulator was not properly initialized.");
+     * @return the tick that runs next, 0 before the simulation began
+     */
+    unsigned int getTimer() const;
+
+    bool SimulationFinished() const;
 
     std::string getRealisticTimeStamp() const;
 
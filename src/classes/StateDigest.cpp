@@ -0,0 +1,150 @@
+#include "StateDigest.h"
+
+#include <iomanip>
+#include <sstream>
+#include <cstdlib>
+#include <algorithm>
+
+namespace {
+    const unsigned long long kOffsetBasis = 14695981039346656037ULL;
+    const unsigned long long kPrime = 1099511628211ULL;
+
+    std::string nameOf(const Airplane* airplane) {
+        return airplane != NULL ? airplane->getNumber() : "-";
+    }
+
+    std::string nameOf(const Location* location) {
+        return location != NULL ? location->getName() : "-";
+    }
+
+    unsigned long lineCount(std::istream& stream) {
+        stream.clear();
+        stream.seekg(0, std::ios::end);
+        const std::streamoff length = stream.tellg();
+        return length > 0 ? static_cast<unsigned long>(length / StateDigest::kLineLength) : 0;
+    }
+
+    std::string readLine(std::istream& stream, const unsigned long index) {
+        std::string line(StateDigest::kLineLength, '\0');
+        stream.clear();
+        stream.seekg(static_cast<std::streamoff>(index) * StateDigest::kLineLength);
+        stream.read(&line[0], StateDigest::kLineLength);
+        return line;
+    }
+
+    unsigned int tickOf(const std::string& line) {
+        return static_cast<unsigned int>(std::strtoul(line.substr(0, 10).c_str(), NULL, 10));
+    }
+}
+
+bool StateDigest::properlyInitialized() const {
+    return this == init;
+}
+
+StateDigest::StateDigest(std::ostream& _digestStream, std::ostream* _stateStream)
+        : digestStream(_digestStream),
+          stateStream(_stateStream),
+          digest(kOffsetBasis),
+          ticks(0),
+          init(this) {
+    ENSURE(properlyInitialized(), "StateDigest was not properly initialized.");
+}
+
+void StateDigest::record(const unsigned int tick, const Airport* airport) {
+    REQUIRE(properlyInitialized(), "StateDigest was not properly initialized.");
+    REQUIRE(airport != NULL, "Airport can not be NULL.");
+
+    std::ostringstream state;
+    describe(state, airport);
+    const std::string text = state.str();
+
+    // continues from the previous digest, once two streams differ every following line differs as well
+    for (std::string::const_iterator it_char = text.begin(); it_char != text.end(); it_char++) {
+        digest = (digest ^ static_cast<unsigned char>(*it_char)) * kPrime;
+    }
+
+    digestStream << std::setw(10) << std::setfill('0') << std::dec << tick << ' '
+                 << std::setw(16) << std::hex << digest << std::dec << std::setfill(' ') << '\n';
+
+    if (stateStream != NULL) *stateStream << "tick " << tick << '\n' << text << '\n';
+
+    ticks++;
+}
+
+unsigned long long StateDigest::getDigest() const {
+    REQUIRE(properlyInitialized(), "StateDigest was not properly initialized.");
+    return digest;
+}
+
+unsigned long StateDigest::getTicks() const {
+    REQUIRE(properlyInitialized(), "StateDigest was not properly initialized.");
+    return ticks;
+}
+
+void StateDigest::describe(std::ostream& stream, const Airport* airport) {
+    REQUIRE(airport != NULL, "Airport can not be NULL.");
+
+    for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
+        const Airplane* airplane = it_airplane->second;
+        stream << "airplane " << airplane->getNumber()
+               << " status " << AirplaneEnums::EnumToString(airplane->getStatus())
+               << " action " << airplane->getActionTimer()
+               << " communication " << airplane->getCommunicationTimer()
+               << " altitude " << airplane->getAltitude()
+               << " fuel " << airplane->getFuel()
+               << " permission " << airplane->hasPermission()
+               << " location " << nameOf(airplane->getCurrentLocation())
+               << " runway " << nameOf(airplane->getRunway())
+               << " gate " << airplane->getGate() << '\n';
+    }
+
+    for (RunwayMap::const_iterator it_runway = airport->getRunways().begin(); it_runway != airport->getRunways().end(); it_runway++) {
+        stream << "runway " << it_runway->first
+               << " airplane " << nameOf(it_runway->second->getAirplane())
+               << " crossing " << nameOf(it_runway->second->getCrossingAirplane()) << '\n';
+    }
+
+    for (unsigned long gate = 0; gate < airport->getGates().size(); gate++) {
+        stream << "gate " << gate << ' ' << nameOf(airport->getGates()[gate]) << '\n';
+    }
+}
+
+bool StateDigest::findDivergence(std::istream& first, std::istream& second, unsigned int& tick) {
+    const unsigned long firstLines = lineCount(first);
+    const unsigned long secondLines = lineCount(second);
+    const unsigned long common = std::min(firstLines, secondLines);
+
+    // the chained digests make "differs at line" monotone, the first differing line can be bisected
+    unsigned long low = 0;
+    unsigned long high = common;
+    while (low < high) {
+        const unsigned long middle = low + (high - low) / 2;
+        if (readLine(first, middle) == readLine(second, middle)) low = middle + 1;
+        else high = middle;
+    }
+
+    if (low == common && firstLines == secondLines) return false;
+
+    tick = tickOf(readLine(low < firstLines ? first : second, low));
+    return true;
+}
+
+bool StateDigest::extractState(std::istream& states, const unsigned int tick, std::ostream& stream) {
+    std::ostringstream header;
+    header << "tick " << tick;
+
+    states.clear();
+    states.seekg(0);
+
+    std::string line;
+    while (std::getline(states, line)) {
+        if (line != header.str()) continue;
+
+        while (std::getline(states, line) && !line.empty()) {
+            stream << line << '\n';
+        }
+        return true;
+    }
+
+    return false;
+}
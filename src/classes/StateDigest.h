@@ -0,0 +1,88 @@
+#ifndef INC_STATEDIGEST_H
+#define INC_STATEDIGEST_H
+
+#include "../lib/DesignByContract.h"
+#include "Airport.h"
+
+#include <iostream>
+#include <string>
+
+/**
+ * Writes one digest line per tick, the hash of the Airport state chained with the digest of the previous tick. \n
+ * The state covers status, timers, altitude, fuel, permission and position of every airplane and the occupancy of
+ * every runway and gate. Chaining keeps two streams different from the first divergent tick on, which lets
+ * findDivergence bisect them. \n
+ * The full state of every tick can be written to a second stream to look at the divergent tick.
+ */
+class StateDigest {
+private:
+    std::ostream& digestStream;
+    std::ostream* stateStream;
+
+    unsigned long long digest;
+    unsigned long ticks;
+
+    const StateDigest* init;
+
+    bool properlyInitialized() const;
+
+    StateDigest(const StateDigest&);
+
+    StateDigest& operator=(const StateDigest&);
+
+public:
+    /**
+     * Every digest line has this length, the streams can be bisected by seeking
+     */
+    static const unsigned int kLineLength = 28;
+
+    /**
+     * POST: \n
+     * ENSURE(properlyInitialized(), "StateDigest was not properly initialized.");
+     * @param _stateStream The stream the full state of every tick is written to, NULL writes only the digests
+     */
+    StateDigest(std::ostream& _digestStream, std::ostream* _stateStream = NULL);
+
+    /**
+     * Hashes the state of the Airport and writes the digest line of the tick \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "StateDigest was not properly initialized."); \n
+     * REQUIRE(airport != NULL, "Airport can not be NULL.");
+     */
+    void record(const unsigned int tick, const Airport* airport);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "StateDigest was not properly initialized.");
+     * @return the digest of the last recorded tick, the initial digest before any tick
+     */
+    unsigned long long getDigest() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "StateDigest was not properly initialized.");
+     */
+    unsigned long getTicks() const;
+
+    /**
+     * Writes the state that is hashed, one line per airplane, runway and gate in a fixed order \n
+     * PRE: \n
+     * REQUIRE(airport != NULL, "Airport can not be NULL.");
+     */
+    static void describe(std::ostream& stream, const Airport* airport);
+
+    /**
+     * Bisects two digest streams written by StateDigest
+     * @param tick The tick of the first divergent line, or the first tick only one of the streams has
+     * @return false if the streams are identical
+     */
+    static bool findDivergence(std::istream& first, std::istream& second, unsigned int& tick);
+
+    /**
+     * Copies the state of the tick from a state stream written by StateDigest
+     * @return false if the tick is not in the stream
+     */
+    static bool extractState(std::istream& states, const unsigned int tick, std::ostream& stream);
+};
+
+#endif
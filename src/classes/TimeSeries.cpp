@@ -0,0 +1,353 @@
+#include "TimeSeries.h"
+
+#include <cstring>
+
+namespace {
+    const char kMagic[] = "PSETS001";
+    const unsigned int kMagicLength = 8;
+
+    // the columns before the status counts
+    enum EColumn { kColumn_Tick, kColumn_Airborne, kColumn_Holding, kColumn_Taxiing, kColumn_Gates, kColumn_FreeRunways, kFixedColumnCount };
+    const char* kFixedColumnNames[] = {"tick", "airborne", "holding", "taxiing", "gates", "freeRunways"};
+
+    void writeUint32(std::ostream& stream, const unsigned long value) {
+        char bytes[4];
+        for (unsigned int i = 0; i < 4; i++) bytes[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+        stream.write(bytes, 4);
+    }
+
+    bool readUint32(std::istream& stream, unsigned long& value) {
+        unsigned char bytes[4];
+        if (!stream.read(reinterpret_cast<char*>(bytes), 4)) return false;
+        value = 0;
+        for (unsigned int i = 0; i < 4; i++) value |= static_cast<unsigned long>(bytes[i]) << (8 * i);
+        return true;
+    }
+
+    void appendVarint(std::string& chunk, unsigned long long value) {
+        while (value >= 0x80) {
+            chunk += static_cast<char>((value & 0x7f) | 0x80);
+            value >>= 7;
+        }
+        chunk += static_cast<char>(value);
+    }
+
+    bool isAirborne(const unsigned int status) {
+        switch (status) {
+            case AirplaneEnums::kStatus_Approaching:
+            case AirplaneEnums::kStatus_DescendingTo5000ft:
+            case AirplaneEnums::kStatus_DescendingTo3000ft:
+            case AirplaneEnums::kStatus_FlyingWaitPattern:
+            case AirplaneEnums::kStatus_FinalApproach:
+            case AirplaneEnums::kStatus_Landing:
+            case AirplaneEnums::kStatus_TakingOff:
+            case AirplaneEnums::kStatus_Ascending:
+            case AirplaneEnums::kStatus_Emergency:
+            case AirplaneEnums::kStatus_EmergencyFinalApproach:
+            case AirplaneEnums::kStatus_EmergencyLanding:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool isTaxiing(const unsigned int status) {
+        switch (status) {
+            case AirplaneEnums::kStatus_TaxiingToApron:
+            case AirplaneEnums::kStatus_TaxiingToRunway:
+            case AirplaneEnums::kStatus_TaxiingToCrossing:
+            case AirplaneEnums::kStatus_WaitingAtCrossing:
+            case AirplaneEnums::kStatus_CrossingRunway:
+            case AirplaneEnums::kStatus_HoldingShort:
+                return true;
+            default:
+                return false;
+        }
+    }
+}
+
+bool TimeSeriesWriter::properlyInitialized() const {
+    return this == init;
+}
+
+TimeSeriesWriter::TimeSeriesWriter(std::ostream& _stream)
+        : stream(_stream),
+          statusCounts(AirplaneEnums::kStatusCount, 0),
+          columns(getColumnNames().size()),
+          rows(0),
+          closed(false),
+          init(this) {
+    const std::vector<std::string> names = getColumnNames();
+
+    stream.write(kMagic, kMagicLength);
+    writeUint32(stream, names.size());
+    for (std::vector<std::string>::const_iterator it_name = names.begin(); it_name != names.end(); it_name++) {
+        writeUint32(stream, it_name->size());
+        stream.write(it_name->data(), it_name->size());
+    }
+    for (std::vector<std::vector<unsigned long> >::iterator it_column = columns.begin(); it_column != columns.end(); it_column++) {
+        it_column->reserve(kBlockRows);
+    }
+
+    ENSURE(properlyInitialized(), "TimeSeriesWriter was not properly initialized.");
+}
+
+TimeSeriesWriter::~TimeSeriesWriter() {
+    if (!closed) close();
+}
+
+std::vector<std::string> TimeSeriesWriter::getColumnNames() {
+    std::vector<std::string> names(kFixedColumnNames, kFixedColumnNames + kFixedColumnCount);
+    for (unsigned int status = AirplaneEnums::kStatus_InvalidStatus + 1; status < AirplaneEnums::kStatusCount; status++) {
+        names.push_back(AirplaneEnums::EnumToString(static_cast<AirplaneEnums::EStatus>(status)));
+    }
+    return names;
+}
+
+void TimeSeriesWriter::countAirport(const Airport* airport) {
+    REQUIRE(properlyInitialized(), "TimeSeriesWriter was not properly initialized.");
+    REQUIRE(airport != NULL, "Airport can not be NULL.");
+
+    statusCounts.assign(AirplaneEnums::kStatusCount, 0);
+    for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
+        statusCounts[it_airplane->second->getStatus()]++;
+    }
+}
+
+void TimeSeriesWriter::changeStatus(const AirplaneEnums::EStatus from, const AirplaneEnums::EStatus to) {
+    REQUIRE(properlyInitialized(), "TimeSeriesWriter was not properly initialized.");
+    REQUIRE(from < AirplaneEnums::kStatusCount && to < AirplaneEnums::kStatusCount, "Status is out of range.");
+
+    if (statusCounts[from] > 0) statusCounts[from]--;
+    statusCounts[to]++;
+}
+
+void TimeSeriesWriter::record(const unsigned int tick, const Airport* airport) {
+    REQUIRE(properlyInitialized(), "TimeSeriesWriter was not properly initialized.");
+    REQUIRE(airport != NULL, "Airport can not be NULL.");
+    REQUIRE(!isClosed(), "TimeSeriesWriter is already closed.");
+
+    unsigned long airborne = 0;
+    unsigned long taxiing = 0;
+    for (unsigned int status = 0; status < AirplaneEnums::kStatusCount; status++) {
+        if (isAirborne(status)) airborne += statusCounts[status];
+        if (isTaxiing(status)) taxiing += statusCounts[status];
+    }
+
+    unsigned long gates = 0;
+    for (AirplaneVector::const_iterator it_gate = airport->getGates().begin(); it_gate != airport->getGates().end(); it_gate++) {
+        if (*it_gate != NULL) gates++;
+    }
+
+    unsigned long freeRunways = 0;
+    for (RunwayMap::const_iterator it_runway = airport->getRunways().begin(); it_runway != airport->getRunways().end(); it_runway++) {
+        if (it_runway->second->isVacant()) freeRunways++;
+    }
+
+    columns[kColumn_Tick].push_back(tick);
+    columns[kColumn_Airborne].push_back(airborne);
+    columns[kColumn_Holding].push_back(statusCounts[AirplaneEnums::kStatus_FlyingWaitPattern]);
+    columns[kColumn_Taxiing].push_back(taxiing);
+    columns[kColumn_Gates].push_back(gates);
+    columns[kColumn_FreeRunways].push_back(freeRunways);
+    for (unsigned int status = AirplaneEnums::kStatus_InvalidStatus + 1; status < AirplaneEnums::kStatusCount; status++) {
+        columns[kFixedColumnCount + status - 1].push_back(statusCounts[status]);
+    }
+
+    rows++;
+    if (columns[kColumn_Tick].size() == kBlockRows) writeBlock();
+}
+
+void TimeSeriesWriter::writeBlock() {
+    if (columns[kColumn_Tick].empty()) return;
+
+    writeUint32(stream, columns[kColumn_Tick].size());
+
+    std::string chunk;
+    for (std::vector<std::vector<unsigned long> >::iterator it_column = columns.begin(); it_column != columns.end(); it_column++) {
+        chunk.clear();
+        long long previous = 0;
+        for (std::vector<unsigned long>::const_iterator it_value = it_column->begin(); it_value != it_column->end(); it_value++) {
+            const long long delta = static_cast<long long>(*it_value) - previous;
+            appendVarint(chunk, static_cast<unsigned long long>((delta << 1) ^ (delta >> 63)));
+            previous = *it_value;
+        }
+        writeUint32(stream, chunk.size());
+        stream.write(chunk.data(), chunk.size());
+        it_column->clear();
+    }
+}
+
+void TimeSeriesWriter::close() {
+    REQUIRE(properlyInitialized(), "TimeSeriesWriter was not properly initialized.");
+    if (closed) return;
+
+    writeBlock();
+    writeUint32(stream, 0);
+    stream.flush();
+    closed = true;
+
+    ENSURE(isClosed(), "TimeSeriesWriter was not closed.");
+}
+
+bool TimeSeriesWriter::isClosed() const {
+    return closed;
+}
+
+unsigned long TimeSeriesWriter::getRows() const {
+    REQUIRE(properlyInitialized(), "TimeSeriesWriter was not properly initialized.");
+    return rows;
+}
+
+unsigned long TimeSeriesWriter::getStatusCount(const AirplaneEnums::EStatus status) const {
+    REQUIRE(properlyInitialized(), "TimeSeriesWriter was not properly initialized.");
+    return (status < AirplaneEnums::kStatusCount ? statusCounts[status] : 0);
+}
+
+bool TimeSeriesReader::properlyInitialized() const {
+    return this == init;
+}
+
+TimeSeriesReader::TimeSeriesReader(std::istream& _stream) : stream(_stream), columns(), firstBlock(), valid(false), init(this) {
+    char magic[kMagicLength];
+    unsigned long count = 0;
+
+    if (stream.read(magic, kMagicLength) && std::memcmp(magic, kMagic, kMagicLength) == 0 && readUint32(stream, count)) {
+        valid = true;
+        for (unsigned long column = 0; column < count && valid; column++) {
+            unsigned long length = 0;
+            valid = readUint32(stream, length) && length < 256;
+            if (!valid) break;
+
+            std::string name(length, '\0');
+            if (length > 0) valid = static_cast<bool>(stream.read(&name[0], length));
+            columns.push_back(name);
+        }
+        firstBlock = stream.tellg();
+    }
+
+    if (!valid) columns.clear();
+
+    ENSURE(properlyInitialized(), "TimeSeriesReader was not properly initialized.");
+}
+
+bool TimeSeriesReader::isValid() const {
+    REQUIRE(properlyInitialized(), "TimeSeriesReader was not properly initialized.");
+    return valid;
+}
+
+const std::vector<std::string>& TimeSeriesReader::getColumns() const {
+    REQUIRE(properlyInitialized(), "TimeSeriesReader was not properly initialized.");
+    return columns;
+}
+
+bool TimeSeriesReader::readBlock(const std::vector<bool>& wanted, std::vector<std::vector<unsigned long> >& values) {
+    unsigned long blockRows = 0;
+    if (!readUint32(stream, blockRows) || blockRows == 0) return false;
+
+    std::string chunk;
+    for (unsigned long column = 0; column < columns.size(); column++) {
+        unsigned long length = 0;
+        if (!readUint32(stream, length)) return false;
+
+        if (!wanted[column]) {
+            stream.seekg(length, std::ios::cur);
+            continue;
+        }
+
+        chunk.assign(length, '\0');
+        if (length > 0 && !stream.read(&chunk[0], length)) return false;
+
+        long long previous = 0;
+        unsigned long long encoded = 0;
+        unsigned int shift = 0;
+        unsigned long decoded = 0;
+        for (std::string::const_iterator it_byte = chunk.begin(); it_byte != chunk.end(); it_byte++) {
+            const unsigned char byte = static_cast<unsigned char>(*it_byte);
+            encoded |= static_cast<unsigned long long>(byte & 0x7f) << shift;
+            shift += 7;
+            if (byte & 0x80) {
+                if (shift >= 64) return false;
+                continue;
+            }
+
+            const long long delta = static_cast<long long>(encoded >> 1) ^ -static_cast<long long>(encoded & 1);
+            previous += delta;
+            values[column].push_back(static_cast<unsigned long>(previous));
+            decoded++;
+            encoded = 0;
+            shift = 0;
+        }
+        if (decoded != blockRows) return false;
+    }
+    return !stream.fail();
+}
+
+bool TimeSeriesReader::readColumn(const std::string& name, std::vector<unsigned long>& values) {
+    REQUIRE(properlyInitialized(), "TimeSeriesReader was not properly initialized.");
+    if (!valid) return false;
+
+    std::vector<bool> wanted(columns.size(), false);
+    unsigned long index = 0;
+    while (index < columns.size() && columns[index] != name) index++;
+    if (index == columns.size()) return false;
+    wanted[index] = true;
+
+    std::vector<std::vector<unsigned long> > blockValues(columns.size());
+    stream.clear();
+    stream.seekg(firstBlock);
+
+    bool complete = false;
+    while (true) {
+        const std::streampos blockStart = stream.tellg();
+        if (!readBlock(wanted, blockValues)) {
+            // only the end block is a proper end
+            unsigned long blockRows = 1;
+            stream.clear();
+            stream.seekg(blockStart);
+            complete = readUint32(stream, blockRows) && blockRows == 0;
+            break;
+        }
+    }
+
+    values.swap(blockValues[index]);
+    return complete;
+}
+
+bool TimeSeriesReader::writeCsv(std::ostream& csv) {
+    REQUIRE(properlyInitialized(), "TimeSeriesReader was not properly initialized.");
+    if (!valid) return false;
+
+    for (unsigned long column = 0; column < columns.size(); column++) {
+        csv << (column > 0 ? "," : "") << columns[column];
+    }
+    csv << '\n';
+
+    const std::vector<bool> wanted(columns.size(), true);
+    std::vector<std::vector<unsigned long> > values(columns.size());
+    stream.clear();
+    stream.seekg(firstBlock);
+
+    bool complete = false;
+    while (true) {
+        for (unsigned long column = 0; column < columns.size(); column++) values[column].clear();
+
+        const std::streampos blockStart = stream.tellg();
+        if (!readBlock(wanted, values)) {
+            // only the end block is a proper end
+            unsigned long blockRows = 1;
+            stream.clear();
+            stream.seekg(blockStart);
+            complete = readUint32(stream, blockRows) && blockRows == 0;
+            break;
+        }
+
+        for (unsigned long row = 0; row < values[0].size(); row++) {
+            for (unsigned long column = 0; column < columns.size(); column++) {
+                csv << (column > 0 ? "," : "") << values[column][row];
+            }
+            csv << '\n';
+        }
+    }
+    return complete;
+}
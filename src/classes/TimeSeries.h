@@ -0,0 +1,171 @@
+#ifndef INC_TIMESERIES_H
+#define INC_TIMESERIES_H
+
+#include "../lib/DesignByContract.h"
+#include "Airport.h"
+#include "Airplane.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Writes per tick counters of an Airport in a compact columnar layout: \n
+ * header: "PSETS001", the column count and every column name (little endian 32 bit count, name length and name) \n
+ * blocks: the row count, then per column the byte length of its chunk and the chunk. A chunk holds the zigzag varint
+ * deltas of the column within the block, so constant columns take one byte per tick and readers can skip columns. \n
+ * A block with row count 0 ends the file. \n
+ * The status counts are kept up to date with changeStatus, recording a tick does not look at the Airplanes.
+ */
+class TimeSeriesWriter {
+private:
+    std::ostream& stream;
+
+    std::vector<unsigned long> statusCounts;
+    std::vector<std::vector<unsigned long> > columns;
+    unsigned long rows;
+    bool closed;
+
+    const TimeSeriesWriter* init;
+
+    bool properlyInitialized() const;
+
+    void writeBlock();
+
+    TimeSeriesWriter(const TimeSeriesWriter&);
+
+    TimeSeriesWriter& operator=(const TimeSeriesWriter&);
+
+public:
+    /**
+     * The number of ticks per block
+     */
+    static const unsigned int kBlockRows = 1024;
+
+    /**
+     * Writes the header \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "TimeSeriesWriter was not properly initialized.");
+     */
+    TimeSeriesWriter(std::ostream& _stream);
+
+    /**
+     * Closes the writer when that was not done yet
+     */
+    ~TimeSeriesWriter();
+
+    /**
+     * @return tick, airborne, holding, taxiing, gates, freeRunways and one column per status
+     */
+    static std::vector<std::string> getColumnNames();
+
+    /**
+     * Sets the status counts to the statuses of the Airplanes \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TimeSeriesWriter was not properly initialized."); \n
+     * REQUIRE(airport != NULL, "Airport can not be NULL.");
+     */
+    void countAirport(const Airport* airport);
+
+    /**
+     * Moves one Airplane from the status to the other in the status counts \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TimeSeriesWriter was not properly initialized."); \n
+     * REQUIRE(from < AirplaneEnums::kStatusCount && to < AirplaneEnums::kStatusCount, "Status is out of range.");
+     */
+    void changeStatus(const AirplaneEnums::EStatus from, const AirplaneEnums::EStatus to);
+
+    /**
+     * Adds a row with the status counts and the gates and runways of the Airport \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TimeSeriesWriter was not properly initialized."); \n
+     * REQUIRE(airport != NULL, "Airport can not be NULL."); \n
+     * REQUIRE(!isClosed(), "TimeSeriesWriter is already closed.");
+     */
+    void record(const unsigned int tick, const Airport* airport);
+
+    /**
+     * Writes the last block and the end block \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TimeSeriesWriter was not properly initialized."); \n
+     * POST: \n
+     * ENSURE(isClosed(), "TimeSeriesWriter was not closed.");
+     */
+    void close();
+
+    bool isClosed() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TimeSeriesWriter was not properly initialized.");
+     */
+    unsigned long getRows() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TimeSeriesWriter was not properly initialized.");
+     */
+    unsigned long getStatusCount(const AirplaneEnums::EStatus status) const;
+};
+
+/**
+ * Reads a file written by TimeSeriesWriter column by column or converts it to CSV
+ */
+class TimeSeriesReader {
+private:
+    std::istream& stream;
+    std::vector<std::string> columns;
+    std::streampos firstBlock;
+    bool valid;
+
+    const TimeSeriesReader* init;
+
+    bool properlyInitialized() const;
+
+    /**
+     * Decodes the block at the current position, only the wanted columns are decoded and the others are skipped
+     * @return false at the end block or when the block is damaged
+     */
+    bool readBlock(const std::vector<bool>& wanted, std::vector<std::vector<unsigned long> >& values);
+
+    TimeSeriesReader(const TimeSeriesReader&);
+
+    TimeSeriesReader& operator=(const TimeSeriesReader&);
+
+public:
+    /**
+     * Reads the header, a stream without it is not valid \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "TimeSeriesReader was not properly initialized.");
+     */
+    TimeSeriesReader(std::istream& _stream);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TimeSeriesReader was not properly initialized.");
+     */
+    bool isValid() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TimeSeriesReader was not properly initialized.");
+     */
+    const std::vector<std::string>& getColumns() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TimeSeriesReader was not properly initialized.");
+     * @return false if the column does not exist or the file is damaged
+     */
+    bool readColumn(const std::string& name, std::vector<unsigned long>& values);
+
+    /**
+     * Writes a header line with the column names and one line per tick \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TimeSeriesReader was not properly initialized.");
+     * @return false if the file is damaged
+     */
+    bool writeCsv(std::ostream& csv);
+};
+
+#endif
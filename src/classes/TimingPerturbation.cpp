@@ -0,0 +1,79 @@
+#include "TimingPerturbation.h"
+
+#include <math.h>
+
+namespace {
+    const unsigned int kFuelKind = AirplaneEnums::kStatusCount;
+
+    /**
+     * The splitmix64 finalizer, every bit of the input affects every bit of the output
+     */
+    unsigned long long mix(unsigned long long value) {
+        value += 0x9e3779b97f4a7c15ULL;
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+        return value ^ (value >> 31);
+    }
+
+    double toUnit(const unsigned long long value) {
+        return (value >> 11) * (1.0 / 9007199254740992.0);
+    }
+}
+
+bool TimingPerturbation::properlyInitialized() const {
+    return this == init;
+}
+
+TimingPerturbation::TimingPerturbation(const unsigned long long _seed, const double _spread) : seed(_seed), spread(_spread), init(this) {
+    REQUIRE(_spread >= 0 && _spread < 1, "Spread must be at least 0 and below 1.");
+    ENSURE(properlyInitialized(), "TimingPerturbation was not properly initialized.");
+}
+
+unsigned long long TimingPerturbation::getSeed() const {
+    REQUIRE(properlyInitialized(), "TimingPerturbation was not properly initialized.");
+    return seed;
+}
+
+double TimingPerturbation::getSpread() const {
+    REQUIRE(properlyInitialized(), "TimingPerturbation was not properly initialized.");
+    return spread;
+}
+
+void TimingPerturbation::draw(const Airplane* airplane, const unsigned int kind, const unsigned int tick, double& factor, double& rounding) const {
+    unsigned long long key = mix(seed);
+    const std::string& number = airplane->getNumber();
+    for (std::string::const_iterator it_char = number.begin(); it_char != number.end(); it_char++) {
+        key = mix(key ^ static_cast<unsigned char>(*it_char));
+    }
+    key = mix(key ^ (static_cast<unsigned long long>(kind) << 32 | tick));
+
+    factor = toUnit(key);
+    rounding = toUnit(mix(key));
+}
+
+unsigned int TimingPerturbation::perturb(const unsigned int value, const double factor, const double rounding) const {
+    if (value == 0) return 0;
+
+    const double scaled = value * (1.0 + spread * (2.0 * factor - 1.0));
+    unsigned int result = static_cast<unsigned int>(floor(scaled));
+    if (rounding < scaled - result) result++;
+    return (result > 0 ? result : 1);
+}
+
+unsigned int TimingPerturbation::perturbAction(const Airplane* airplane, const unsigned int ticks, const unsigned int actionStart) const {
+    REQUIRE(properlyInitialized(), "TimingPerturbation was not properly initialized.");
+    REQUIRE(airplane != NULL, "Airplane can not be NULL.");
+
+    double factor, rounding;
+    draw(airplane, airplane->getStatus(), actionStart, factor, rounding);
+    return perturb(ticks, factor, rounding);
+}
+
+unsigned int TimingPerturbation::perturbFuel(const Airplane* airplane, const unsigned int consumption, const unsigned int tick) const {
+    REQUIRE(properlyInitialized(), "TimingPerturbation was not properly initialized.");
+    REQUIRE(airplane != NULL, "Airplane can not be NULL.");
+
+    double factor, rounding;
+    draw(airplane, kFuelKind, tick, factor, rounding);
+    return perturb(consumption, factor, rounding);
+}
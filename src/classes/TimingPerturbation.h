@@ -0,0 +1,69 @@
+#ifndef INC_TIMINGPERTURBATION_H
+#define INC_TIMINGPERTURBATION_H
+
+#include "../lib/DesignByContract.h"
+#include "Airplane.h"
+
+/**
+ * Scales action durations and fuel burn by a random factor between 1 - spread and 1 + spread, the fraction is rounded
+ * up or down at random so the mean stays the same. \n
+ * Every draw is a hash of the seed, the Airplane, what is drawn and when, so a perturbation keeps no state: the same
+ * seed replays the same run and different seeds are independent streams. An action draws once, keyed by the tick it
+ * started on, so its duration does not change while the Airplane waits for it.
+ */
+class TimingPerturbation {
+private:
+    unsigned long long seed;
+    double spread;
+
+    const TimingPerturbation* init;
+
+    bool properlyInitialized() const;
+
+    /**
+     * Fills in two uniform numbers in [0, 1) for the key
+     */
+    void draw(const Airplane* airplane, const unsigned int kind, const unsigned int tick, double& factor, double& rounding) const;
+
+    unsigned int perturb(const unsigned int value, const double factor, const double rounding) const;
+
+public:
+    /**
+     * PRE: \n
+     * REQUIRE(_spread >= 0 && _spread < 1, "Spread must be at least 0 and below 1."); \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "TimingPerturbation was not properly initialized.");
+     */
+    TimingPerturbation(const unsigned long long _seed, const double _spread);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TimingPerturbation was not properly initialized.");
+     */
+    unsigned long long getSeed() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TimingPerturbation was not properly initialized.");
+     */
+    double getSpread() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TimingPerturbation was not properly initialized."); \n
+     * REQUIRE(airplane != NULL, "Airplane can not be NULL.");
+     * @param actionStart The tick the current action of the Airplane started on
+     * @return the perturbed duration, at least 1 when ticks is not 0
+     */
+    unsigned int perturbAction(const Airplane* airplane, const unsigned int ticks, const unsigned int actionStart) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TimingPerturbation was not properly initialized."); \n
+     * REQUIRE(airplane != NULL, "Airplane can not be NULL.");
+     * @return the perturbed fuel burn of the tick, at least 1 when consumption is not 0
+     */
+    unsigned int perturbFuel(const Airplane* airplane, const unsigned int consumption, const unsigned int tick) const;
+};
+
+#endif
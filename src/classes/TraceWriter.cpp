@@ -0,0 +1,95 @@
+#include "TraceWriter.h"
+
+#include <iomanip>
+
+namespace {
+    std::string escape(const std::string& string) {
+        std::string result;
+
+        for (std::string::const_iterator it_char = string.begin(); it_char != string.end(); it_char++) {
+            if (*it_char == '"' || *it_char == '\\') result += '\\';
+            result += *it_char;
+        }
+
+        return result;
+    }
+}
+
+bool TraceWriter::properlyInitialized() const {
+    return this == init;
+}
+
+TraceWriter::TraceWriter(std::ostream& _stream)
+        : stream(_stream),
+          origin(getMonotonicNanoseconds()),
+          track(0),
+          empty(true),
+          closed(false),
+          init(this) {
+    stream << "{\"traceEvents\":[";
+    ENSURE(properlyInitialized(), "TraceWriter was not properly initialized.");
+}
+
+TraceWriter::~TraceWriter() {
+    if (!closed) close();
+}
+
+void TraceWriter::beginEvent() {
+    stream << (empty ? "\n" : ",\n");
+    empty = false;
+}
+
+void TraceWriter::writeTime(const unsigned long long nanoseconds) {
+    // trace-event times are microseconds, the fraction keeps nanosecond resolution
+    stream << nanoseconds / 1000 << '.' << std::setw(3) << std::setfill('0') << nanoseconds % 1000;
+}
+
+void TraceWriter::beginTrack(const std::string& name) {
+    REQUIRE(properlyInitialized(), "TraceWriter was not properly initialized.");
+    REQUIRE(!isClosed(), "TraceWriter is already closed.");
+
+    track++;
+    beginEvent();
+    stream << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << track << ",\"args\":{\"name\":\"" << escape(name) << "\"}}";
+}
+
+void TraceWriter::span(const std::string& name, const std::string& category, const unsigned long long start, const unsigned long long end, const std::string& detail) {
+    REQUIRE(properlyInitialized(), "TraceWriter was not properly initialized.");
+    REQUIRE(!isClosed(), "TraceWriter is already closed.");
+    REQUIRE(start <= end, "A span can not end before it starts.");
+
+    beginEvent();
+    stream << "{\"ph\":\"X\",\"name\":\"" << escape(name) << "\",\"cat\":\"" << escape(category) << "\",\"pid\":1,\"tid\":" << track << ",\"ts\":";
+    writeTime(start > origin ? start - origin : 0);
+    stream << ",\"dur\":";
+    writeTime(end - start);
+    if (!detail.empty()) stream << ",\"args\":{\"detail\":\"" << escape(detail) << "\"}";
+    stream << "}";
+}
+
+void TraceWriter::counter(const std::string& name, const unsigned long long time, const std::map<std::string, unsigned long>& values) {
+    REQUIRE(properlyInitialized(), "TraceWriter was not properly initialized.");
+    REQUIRE(!isClosed(), "TraceWriter is already closed.");
+
+    beginEvent();
+    stream << "{\"ph\":\"C\",\"name\":\"" << escape(name) << "\",\"pid\":1,\"tid\":" << track << ",\"ts\":";
+    writeTime(time > origin ? time - origin : 0);
+    stream << ",\"args\":{";
+    for (std::map<std::string, unsigned long>::const_iterator it_value = values.begin(); it_value != values.end(); it_value++) {
+        if (it_value != values.begin()) stream << ",";
+        stream << "\"" << escape(it_value->first) << "\":" << it_value->second;
+    }
+    stream << "}}";
+}
+
+void TraceWriter::close() {
+    REQUIRE(properlyInitialized(), "TraceWriter was not properly initialized.");
+    if (closed) return;
+
+    stream << "\n]}" << std::endl;
+    closed = true;
+}
+
+bool TraceWriter::isClosed() const {
+    return closed;
+}
@@ -0,0 +1,84 @@
+#ifndef INC_TRACEWRITER_H
+#define INC_TRACEWRITER_H
+
+#include "../lib/DesignByContract.h"
+#include "../utils/Utils.h"
+
+#include <iostream>
+#include <string>
+#include <map>
+
+/**
+ * Writes wall clock spans and counters in the Chrome trace-event JSON format, the file opens in chrome://tracing and Perfetto. \n
+ * Times are taken from getMonotonicNanoseconds and written relative to the construction of the writer. \n
+ * Every track shows up as a separate thread in the viewer.
+ */
+class TraceWriter {
+private:
+    std::ostream& stream;
+    unsigned long long origin;
+    unsigned int track;
+    bool empty;
+    bool closed;
+
+    const TraceWriter* init;
+
+    bool properlyInitialized() const;
+
+    void beginEvent();
+
+    void writeTime(const unsigned long long nanoseconds);
+
+    TraceWriter(const TraceWriter&);
+
+    TraceWriter& operator=(const TraceWriter&);
+
+public:
+    /**
+     * POST: \n
+     * ENSURE(properlyInitialized(), "TraceWriter was not properly initialized.");
+     */
+    TraceWriter(std::ostream& _stream);
+
+    /**
+     * Closes the trace if that was not done yet
+     */
+    ~TraceWriter();
+
+    /**
+     * Starts a new track, the events that follow are shown under its name \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TraceWriter was not properly initialized."); \n
+     * REQUIRE(!isClosed(), "TraceWriter is already closed.");
+     */
+    void beginTrack(const std::string& name);
+
+    /**
+     * Writes a complete event from start to end, both read from getMonotonicNanoseconds \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TraceWriter was not properly initialized."); \n
+     * REQUIRE(!isClosed(), "TraceWriter is already closed."); \n
+     * REQUIRE(start <= end, "A span can not end before it starts.");
+     * @param detail Shown as the detail argument of the span, omitted when empty
+     */
+    void span(const std::string& name, const std::string& category, const unsigned long long start, const unsigned long long end, const std::string& detail = "");
+
+    /**
+     * Writes one sample of a counter track, every entry of the map becomes a series of the track \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TraceWriter was not properly initialized."); \n
+     * REQUIRE(!isClosed(), "TraceWriter is already closed.");
+     */
+    void counter(const std::string& name, const unsigned long long time, const std::map<std::string, unsigned long>& values);
+
+    /**
+     * Terminates the JSON document, no events can be written afterwards \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "TraceWriter was not properly initialized.");
+     */
+    void close();
+
+    bool isClosed() const;
+};
+
+#endif
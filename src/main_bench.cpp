@@ -0,0 +1,258 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+
+#include "classes/Simulator.h"
+#include "classes/EventRenderer.h"
+#include "parser/Parser.h"
+#include "utils/Utils.h"
+#include "utils/ScenarioGenerator.h"
+
+namespace {
+    /**
+     * Formats like a real stream but throws the characters away, so rendering is measured without disk latency
+     */
+    class NullBuffer: public std::streambuf {
+    protected:
+        int overflow(int c) {
+            return c;
+        }
+    };
+
+    /**
+     * Records the wall time between two TickEnd events
+     */
+    class TickTimer: public EventRenderer {
+    private:
+        std::vector<double>& samples;
+        unsigned long long last;
+
+    public:
+        TickTimer(const Airport* _airport, std::ostream& _stream, std::vector<double>& _samples)
+                : EventRenderer(_airport, _stream), samples(_samples), last(getMonotonicNanoseconds()) {}
+
+        void render(const SimulationEvent& event) {
+            if (event.type != EventEnums::kEvent_TickEnd) return;
+
+            unsigned long long now = getMonotonicNanoseconds();
+            samples.push_back((now - last) / 1000.0);
+            last = now;
+        }
+    };
+
+    double percentile(std::vector<double> samples, const double fraction) {
+        if (samples.empty()) return 0;
+
+        std::sort(samples.begin(), samples.end());
+        unsigned long rank = static_cast<unsigned long>(std::ceil(fraction * samples.size()));
+        return samples[rank == 0 ? 0 : rank - 1];
+    }
+
+    struct BenchResult {
+        unsigned int airplanes;
+        unsigned int runways;
+        unsigned long ticks;
+
+        // parse and copy in milliseconds, ticks and rendering in microseconds per tick
+        std::vector<double> parse;
+        std::vector<double> copy;
+        std::vector<double> tick;
+        std::vector<double> render;
+    };
+
+    double elapsedMilliseconds(const unsigned long long start) {
+        return (getMonotonicNanoseconds() - start) / 1000000.0;
+    }
+
+    bool runCase(BenchResult& result, const unsigned int repeat, const unsigned int ticks, std::ostream& nullStream) {
+        const std::string fileName = "bench_input.xml";
+
+        ScenarioConfig config;
+        config.airplanes = result.airplanes;
+        config.runways = result.runways;
+        config.taxiChainLength = result.runways - 1;
+
+        ScenarioGenerator generator(config);
+        if (!generator.writeFile(fileName)) return false;
+
+        for (unsigned int iteration = 0; iteration < repeat; iteration++) {
+            Parser parser(nullStream);
+
+            unsigned long long start = getMonotonicNanoseconds();
+            std::pair<ParseEnum::EResult, AirportMap> parsed = parser.parseFile(fileName.c_str());
+            result.parse.push_back(elapsedMilliseconds(start));
+
+            if (parsed.first != ParseEnum::kSuccess || parsed.second.size() != 1) {
+                for (AirportMap::iterator it_airport = parsed.second.begin(); it_airport != parsed.second.end(); it_airport++) {
+                    delete it_airport->second;
+                }
+                std::remove(fileName.c_str());
+                return false;
+            }
+
+            Airport* airport = parsed.second.begin()->second;
+
+            start = getMonotonicNanoseconds();
+            Airport* copy = new Airport(airport);
+            result.copy.push_back(elapsedMilliseconds(start));
+            delete copy;
+
+            {
+                Simulator simulator(airport, nullStream);
+                TickTimer tickTimer(simulator.getAirport(), nullStream, result.tick);
+                simulator.addRenderer(&tickTimer);
+                simulator.setTickLimit(ticks);
+                simulator.Simulate();
+            }
+
+            {
+                Simulator simulator(airport, nullStream);
+                simulator.setTickLimit(ticks);
+                simulator.Simulate();
+
+                OutputRenderer outputRenderer(simulator.getAirport(), nullStream);
+                TowerRenderer towerRenderer(simulator.getAirport(), nullStream);
+                FloorplanRenderer floorplanRenderer(simulator.getAirport(), nullStream);
+
+                const EventLog& log = simulator.getEventLog();
+                start = getMonotonicNanoseconds();
+                for (unsigned long index = 0; index < log.size(); index++) {
+                    outputRenderer.render(log.at(index));
+                    towerRenderer.render(log.at(index));
+                    floorplanRenderer.render(log.at(index));
+
+                    if (log.at(index).type == EventEnums::kEvent_TickEnd) {
+                        result.render.push_back(elapsedMilliseconds(start) * 1000.0);
+                        start = getMonotonicNanoseconds();
+                    }
+                }
+            }
+
+            delete airport;
+        }
+
+        result.ticks = result.tick.size() / repeat;
+        std::remove(fileName.c_str());
+        return true;
+    }
+
+    void writeSummary(const std::string& name, const std::vector<double>& samples, std::ostream& stream) {
+        stream << "\"" << name << "\": {\"median\": " << percentile(samples, 0.5) << ", \"p99\": " << percentile(samples, 0.99) << ", \"samples\": " << samples.size() << "}";
+    }
+
+    void writeResults(const std::vector<BenchResult>& results, const unsigned int repeat, std::ostream& stream) {
+        stream << std::fixed << std::setprecision(3);
+        stream << "{" << std::endl;
+        stream << "  \"repeat\": " << repeat << "," << std::endl;
+        stream << "  \"cases\": [" << std::endl;
+
+        for (unsigned int i = 0; i < results.size(); i++) {
+            const BenchResult& result = results[i];
+            stream << "    {\"airplanes\": " << result.airplanes << ", \"runways\": " << result.runways << ", \"ticks\": " << result.ticks << ", ";
+            writeSummary("parse_ms", result.parse, stream);
+            stream << ", ";
+            writeSummary("copy_ms", result.copy, stream);
+            stream << ", ";
+            writeSummary("tick_us", result.tick, stream);
+            stream << ", ";
+            writeSummary("render_tick_us", result.render, stream);
+            stream << ", \"ticks_per_second\": " << (percentile(result.tick, 0.5) > 0 ? 1000000.0 / percentile(result.tick, 0.5) : 0);
+            stream << "}" << (i + 1 < results.size() ? "," : "") << std::endl;
+        }
+
+        stream << "  ]" << std::endl;
+        stream << "}" << std::endl;
+    }
+
+    void printRow(const BenchResult& result) {
+        std::cout << std::setw(10) << result.airplanes << std::setw(8) << result.runways
+                  << std::setw(12) << percentile(result.parse, 0.5) << std::setw(12) << percentile(result.parse, 0.99)
+                  << std::setw(12) << percentile(result.copy, 0.5) << std::setw(12) << percentile(result.copy, 0.99)
+                  << std::setw(12) << percentile(result.tick, 0.5) << std::setw(12) << percentile(result.tick, 0.99)
+                  << std::setw(12) << percentile(result.render, 0.5) << std::setw(12) << percentile(result.render, 0.99)
+                  << std::endl;
+    }
+
+    void printUsage() {
+        std::cout << "Usage: PSE_Bench [--repeat N] [--ticks N] [--max-airplanes N] [--max-runways N] [--output FILE]" << std::endl;
+    }
+}
+
+int main(int argc, char **argv) {
+    unsigned int repeat = 5;
+    unsigned int ticks = 60;
+    unsigned int maxAirplanes = 100000;
+    unsigned int maxRunways = 50;
+    std::string outputName = "bench_results.json";
+
+    for (int i = 1; i < argc; i++) {
+        std::string argument = argv[i];
+        if (i + 1 >= argc) {
+            printUsage();
+            return 1;
+        }
+
+        int value = 0;
+        if (argument == "--output") {
+            outputName = argv[++i];
+        } else if (tryCastStringToInt(argv[i + 1], &value) && value > 0) {
+            i++;
+            if (argument == "--repeat") repeat = value;
+            else if (argument == "--ticks") ticks = value;
+            else if (argument == "--max-airplanes") maxAirplanes = value;
+            else if (argument == "--max-runways") maxRunways = value;
+            else {
+                printUsage();
+                return 1;
+            }
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    const unsigned int airplaneCounts[] = {10, 100, 1000, 10000, 100000};
+    const unsigned int runwayCounts[] = {1, 10, 50};
+
+    NullBuffer nullBuffer;
+    std::ostream nullStream(&nullBuffer);
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::setw(10) << "airplanes" << std::setw(8) << "runways"
+              << std::setw(12) << "parse ms" << std::setw(12) << "p99"
+              << std::setw(12) << "copy ms" << std::setw(12) << "p99"
+              << std::setw(12) << "tick us" << std::setw(12) << "p99"
+              << std::setw(12) << "render us" << std::setw(12) << "p99"
+              << std::endl;
+
+    std::vector<BenchResult> results;
+    for (unsigned int a = 0; a < sizeof(airplaneCounts) / sizeof(airplaneCounts[0]); a++) {
+        for (unsigned int r = 0; r < sizeof(runwayCounts) / sizeof(runwayCounts[0]); r++) {
+            if (airplaneCounts[a] > maxAirplanes || runwayCounts[r] > maxRunways) continue;
+
+            BenchResult result;
+            result.airplanes = airplaneCounts[a];
+            result.runways = runwayCounts[r];
+            result.ticks = 0;
+
+            if (!runCase(result, repeat, ticks, nullStream)) {
+                std::cerr << "Generated scenario with " << result.airplanes << " airplanes and " << result.runways << " runways did not parse." << std::endl;
+                return 1;
+            }
+
+            printRow(result);
+            results.push_back(result);
+        }
+    }
+
+    std::ofstream outputStream(outputName.c_str());
+    writeResults(results, repeat, outputStream);
+    outputStream.close();
+
+    std::cout << "Results written to " << outputName << std::endl;
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <set>
+
+#include "classes/StateDigest.h"
+
+namespace {
+    void printUsage() {
+        std::cout << "Usage: PSE_Bisect DIGEST_A DIGEST_B [STATES_A STATES_B]" << std::endl;
+    }
+
+    bool readState(const std::string& fileName, const unsigned int tick, std::string& state) {
+        std::ifstream stream(fileName.c_str());
+        std::ostringstream result;
+        if (!stream.is_open() || !StateDigest::extractState(stream, tick, result)) return false;
+        state = result.str();
+        return true;
+    }
+
+    std::set<std::string> splitLines(const std::string& text) {
+        std::set<std::string> lines;
+        std::istringstream stream(text);
+        std::string line;
+        while (std::getline(stream, line)) lines.insert(line);
+        return lines;
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3 && argc != 5) {
+        printUsage();
+        return 1;
+    }
+
+    std::ifstream first(argv[1], std::ios::binary);
+    std::ifstream second(argv[2], std::ios::binary);
+    if (!first.is_open() || !second.is_open()) {
+        std::cerr << "Could not open " << (first.is_open() ? argv[2] : argv[1]) << std::endl;
+        return 1;
+    }
+
+    unsigned int tick = 0;
+    if (!StateDigest::findDivergence(first, second, tick)) {
+        std::cout << "Digests are identical" << std::endl;
+        return 0;
+    }
+
+    std::cout << "First divergent tick: " << tick << std::endl;
+    if (argc != 5) return 2;
+
+    std::string firstState, secondState;
+    if (!readState(argv[3], tick, firstState) || !readState(argv[4], tick, secondState)) {
+        std::cerr << "Tick " << tick << " is missing from the state files" << std::endl;
+        return 2;
+    }
+
+    std::cout << std::endl << "--- " << argv[3] << std::endl << firstState;
+    std::cout << std::endl << "+++ " << argv[4] << std::endl << secondState;
+
+    // the state lines have a fixed order, the lines only one side has are the difference
+    const std::set<std::string> firstLines = splitLines(firstState);
+    const std::set<std::string> secondLines = splitLines(secondState);
+    std::cout << std::endl << "Difference" << std::endl;
+    for (std::set<std::string>::const_iterator it_line = firstLines.begin(); it_line != firstLines.end(); it_line++) {
+        if (secondLines.find(*it_line) == secondLines.end()) std::cout << "- " << *it_line << std::endl;
+    }
+    for (std::set<std::string>::const_iterator it_line = secondLines.begin(); it_line != secondLines.end(); it_line++) {
+        if (firstLines.find(*it_line) == firstLines.end()) std::cout << "+ " << *it_line << std::endl;
+    }
+
+    return 2;
+}
@@ -0,0 +1,100 @@
+#include <iostream>
+#include <sstream>
+
+#include "parser/Parser.h"
+#include "utils/Utils.h"
+#include "utils/ScenarioGenerator.h"
+
+namespace {
+    void printUsage() {
+        std::cout << "Usage: PSE_Generator [--airplanes N] [--runways N] [--chain-length N] [--crossing-density PERCENT]" << std::endl;
+        std::cout << "                     [--gate-share PERCENT] [--mix PRIVATE:AIRLINE:MILITARY:EMERGENCY] [--seed N]" << std::endl;
+        std::cout << "                     [--output FILE] [--verify]" << std::endl;
+    }
+
+    bool parseMix(const std::string& mix, ScenarioConfig& config) {
+        std::vector<unsigned int> weights;
+        std::stringstream stream(mix);
+        std::string weight;
+
+        while (std::getline(stream, weight, ':')) {
+            int value = 0;
+            if (!tryCastStringToInt(weight, &value) || value < 0) return false;
+            weights.push_back(value);
+        }
+
+        if (weights.size() != 4 || weights[0] + weights[1] + weights[2] + weights[3] == 0) return false;
+
+        config.privateWeight = weights[0];
+        config.airlineWeight = weights[1];
+        config.militaryWeight = weights[2];
+        config.emergencyWeight = weights[3];
+        return true;
+    }
+}
+
+int main(int argc, char **argv) {
+    ScenarioConfig config;
+    std::string outputName = "generated.xml";
+    bool verify = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string argument = argv[i];
+
+        if (argument == "--verify") {
+            verify = true;
+            continue;
+        }
+
+        if (i + 1 >= argc) {
+            printUsage();
+            return 1;
+        }
+
+        std::string parameter = argv[++i];
+        int value = 0;
+        bool isNumber = tryCastStringToInt(parameter, &value) && value >= 0;
+
+        if (argument == "--output") outputName = parameter;
+        else if (argument == "--mix" && parseMix(parameter, config)) continue;
+        else if (argument == "--airplanes" && isNumber && value > 0) config.airplanes = value;
+        else if (argument == "--runways" && isNumber && value > 0) config.runways = value;
+        else if (argument == "--chain-length" && isNumber) config.taxiChainLength = value;
+        else if (argument == "--crossing-density" && isNumber && value <= 100) config.crossingDensity = value;
+        else if (argument == "--gate-share" && isNumber && value <= 100) config.gateShare = value;
+        else if (argument == "--seed" && isNumber) config.seed = value;
+        else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    ScenarioGenerator generator(config);
+    if (!generator.writeFile(outputName)) {
+        std::cerr << "Could not write " << outputName << std::endl;
+        return 1;
+    }
+
+    std::cout << "Wrote " << config.airplanes << " airplanes and " << config.runways << " runways at "
+              << generator.getAirportCount() << " airports to " << outputName << std::endl;
+
+    if (verify) {
+        std::ostringstream parserStream;
+        Parser parser(parserStream);
+        std::pair<ParseEnum::EResult, AirportMap> result = parser.parseFile(outputName.c_str());
+
+        for (AirportMap::iterator it_airport = result.second.begin(); it_airport != result.second.end(); it_airport++) {
+            delete it_airport->second;
+        }
+
+        if (result.first != ParseEnum::kSuccess) {
+            std::cerr << parserStream.str();
+            std::cerr << "Generated file did not parse as success." << std::endl;
+            return 1;
+        }
+
+        std::cout << "Parsed as success" << std::endl;
+    }
+
+    return 0;
+}
@@ -1,79 +1,414 @@
 #include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <glob.h>
 
-#include "classes/Simulator.h"
-#include "parser/Parser.h"
 #include "utils/Utils.h"
+#include "utils/ScenarioRunner.h"
+#include "utils/WorkStealingPool.h"
+#include "utils/ScenarioInput.h"
+#include "utils/MonteCarlo.h"
+#include "utils/ParameterSweep.h"
+#include "utils/SaturationFinder.h"
 
-int main(int argc, char **argv) {
-    std::cout << "Hello, Release!" << std::endl;
-    if (argc == 2) {
-        std::cout << "Running scenario " << argv[1] << std::endl;
-        std::string scenarioName = argv[1];
-        std::string path = "scenarios/" + scenarioName + "/";
-        if (DirectoryExists(path)) {
-            if (!FileExists(path + "input.xml")) return 0;
+namespace {
+    bool parseFlag(const std::string& flag, RunOptions& options) {
+        if (flag == "--async-output") options.asyncOutput = true;
+        else if (flag == "--profile") options.profile = true;
+        else if (flag == "--trace") options.trace = true;
+        else if (flag == "--perf") options.perf = true;
+        else if (flag == "--allocations") options.allocations = true;
+        else if (flag == "--digest") options.digest = true;
+        else if (flag == "--states") options.states = true;
+        else if (flag == "--cache") options.cache = true;
+        else if (flag == "--airplane-files") options.airplaneFiles = true;
+        else if (flag == "--statistics") options.statistics = true;
+        else if (flag == "--time-series") options.timeSeries = true;
+        else if (flag == "--retire") options.retire = true;
+        else return false;
+        return true;
+    }
+
+    /**
+     * Adds the directories matching the pattern, a pattern without matches is tried inside scenarios/
+     * @return false if nothing matched
+     */
+    bool expandScenarios(const std::string& pattern, std::vector<std::string>& paths) {
+        for (unsigned int attempt = 0; attempt < 2; attempt++) {
+            const std::string fullPattern = (attempt == 0 ? pattern : "scenarios/" + pattern);
+
+            glob_t matches;
+            if (glob(fullPattern.c_str(), GLOB_MARK, NULL, &matches) == 0) {
+                for (size_t i = 0; i < matches.gl_pathc; i++) {
+                    std::string path = matches.gl_pathv[i];
+                    if (!path.empty() && path[path.size() - 1] == '/') paths.push_back(path);
+                }
+            }
+            const bool found = matches.gl_pathc > 0;
+            globfree(&matches);
+            if (found) return true;
+        }
+        return false;
+    }
+
+    const char* resultName(const ParseEnum::EResult result) {
+        switch (result) {
+            case ParseEnum::kSuccess:
+                return "success";
+            case ParseEnum::kPartial:
+                return "partial";
+            case ParseEnum::kAborted:
+                return "aborted";
+            default:
+                return "no input";
+        }
+    }
+
+    class ScenarioJob: public PoolJob {
+    public:
+        const ScenarioRunner& runner;
+        std::string path;
+        ScenarioSummary summary;
+        std::ostringstream console;
+        unsigned int thread;
+
+        ScenarioJob(const ScenarioRunner& _runner, const std::string& _path) : runner(_runner), path(_path), summary(), console(), thread(0) {}
+
+        void run(const unsigned int _thread) {
+            thread = _thread;
+            summary = runner.run(path, console);
+        }
+    };
+
+    int runBatch(int argc, char **argv) {
+        RunOptions options;
+        unsigned int threads = 0;
+        std::vector<std::string> paths;
+
+        for (int i = 2; i < argc; i++) {
+            std::string argument = argv[i];
+            int value = 0;
 
-            std::ofstream parserOutputStream;
-            std::string paserOutputName = path + "output_parser.txt";
-            parserOutputStream.open(paserOutputName.c_str());
+            if (argument == "--jobs" && i + 1 < argc && tryCastStringToInt(argv[i + 1], &value) && value > 0) {
+                threads = value;
+                i++;
+            } else if (!parseFlag(argument, options) && !expandScenarios(argument, paths)) {
+                std::cerr << "No scenario directory matches " << argument << std::endl;
+            }
+        }
+
+        if (paths.empty()) {
+            std::cout << "Usage: PSE_Release --batch [--jobs N] [flags] SCENARIO_DIRECTORY_OR_GLOB..." << std::endl;
+            return 1;
+        }
 
-            Parser parser = Parser(parserOutputStream);
+        ScenarioRunner runner(options);
+        WorkStealingPool pool(threads);
+        std::vector<ScenarioJob*> jobs;
+        for (std::vector<std::string>::const_iterator it_path = paths.begin(); it_path != paths.end(); it_path++) {
+            jobs.push_back(new ScenarioJob(runner, *it_path));
+            pool.submit(jobs.back());
+        }
 
-            std::string completefilename = path + "input.xml";
-            std::pair<ParseEnum::EResult, std::map<std::string, Airport *> > pairResult = parser.parseFile(completefilename.c_str());
+        std::cout << "Running " << jobs.size() << " scenarios on " << pool.getThreadCount() << " threads" << std::endl;
+        const unsigned long long start = getMonotonicNanoseconds();
+        pool.run();
+        const double elapsed = (getMonotonicNanoseconds() - start) / 1000000.0;
 
-            parserOutputStream.close();
+        int exitCode = 0;
+        double work = 0;
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << std::left << std::setw(40) << "Scenario" << std::setw(10) << "Result" << std::right << std::setw(10) << "Airports"
+                  << std::setw(11) << "Airplanes" << std::setw(12) << "Parse ms" << std::setw(14) << "Simulate ms" << std::setw(8) << "Thread" << std::setw(8) << "Cached" << std::endl;
+        for (std::vector<ScenarioJob*>::const_iterator it_job = jobs.begin(); it_job != jobs.end(); it_job++) {
+            const ScenarioSummary& summary = (*it_job)->summary;
+            std::cout << std::left << std::setw(40) << summary.path << std::setw(10) << resultName(summary.result) << std::right
+                      << std::setw(10) << summary.airports << std::setw(11) << summary.airplanes
+                      << std::setw(12) << summary.parseTime << std::setw(14) << summary.simulateTime << std::setw(8) << (*it_job)->thread << std::setw(8) << (summary.cached ? "yes" : "no") << std::endl;
 
-            if (pairResult.first != ParseEnum::kSuccess) return 0;
-            for (AirportMap::iterator it_airport = pairResult.second.begin(); it_airport != pairResult.second.end(); it_airport++)
-            {
-                Airport *airport = it_airport->second;
+            work += summary.parseTime + summary.simulateTime;
+            if (summary.result != ParseEnum::kSuccess) exitCode = 1;
+        }
+        std::cout << jobs.size() << " scenarios in " << elapsed << " ms, " << work << " ms of work, "
+                  << pool.getStolen() << " jobs stolen" << std::endl;
 
-                std::string airportPath = path + airport->getIata() + "/";
+        for (std::vector<ScenarioJob*>::iterator it_job = jobs.begin(); it_job != jobs.end(); it_job++) {
+            if (!(*it_job)->console.str().empty()) std::cout << std::endl << (*it_job)->path << std::endl << (*it_job)->console.str();
+            delete *it_job;
+        }
 
-                std::ofstream outputStream;
-                std::string outputStreamName = airportPath + "output_output.txt";
-                outputStream.open(outputStreamName.c_str());
+        return exitCode;
+    }
 
-                std::ofstream errorStream;
-                std::string errorStreamName = airportPath + "output_error.txt";
-                errorStream.open(errorStreamName.c_str());
+    int runMonteCarlo(int argc, char **argv) {
+        MonteCarloOptions options;
+        std::vector<std::string> paths;
 
-                std::ofstream towerStream;
-                std::string towerStreamName = airportPath + "output_tower.txt";
-                towerStream.open(towerStreamName.c_str());
+        for (int i = 2; i < argc; i++) {
+            std::string argument = argv[i];
+            int value = 0;
 
-                std::ofstream floorplanStream;
-                std::string floorplanStreamName = airportPath + "output_floorplan.txt";
-                floorplanStream.open(floorplanStreamName.c_str());
+            if (argument == "--replications" && i + 1 < argc && tryCastStringToInt(argv[i + 1], &value) && value > 0) {
+                options.replications = value;
+                i++;
+            } else if (argument == "--seed" && i + 1 < argc && tryCastStringToInt(argv[i + 1], &value) && value >= 0) {
+                options.seed = value;
+                i++;
+            } else if (argument == "--spread" && i + 1 < argc && tryCastStringToInt(argv[i + 1], &value) && value >= 0 && value < 100) {
+                options.spread = value / 100.0;
+                i++;
+            } else if (argument == "--jobs" && i + 1 < argc && tryCastStringToInt(argv[i + 1], &value) && value > 0) {
+                options.threads = value;
+                i++;
+            } else if (!expandScenarios(argument, paths)) {
+                std::cerr << "No scenario directory matches " << argument << std::endl;
+            }
+        }
 
-                std::ofstream airportInfoStream;
-                std::string fairportInfoStreamName = airportPath + "output_airportinfo.txt";
-                airportInfoStream.open(fairportInfoStreamName.c_str());
+        if (paths.empty()) {
+            std::cout << "Usage: PSE_Release --monte-carlo [--replications N] [--seed S] [--spread PERCENT] [--jobs N] SCENARIO_DIRECTORY_OR_GLOB..." << std::endl;
+            return 1;
+        }
 
-                airport->printInfo(airportInfoStream);
+        int exitCode = 0;
+        MonteCarloRunner runner(options);
+        for (std::vector<std::string>::const_iterator it_path = paths.begin(); it_path != paths.end(); it_path++) {
+            std::ostringstream parserStream;
+            ScenarioInput input;
+            if (input.load(*it_path, parserStream) != ParseEnum::kSuccess) {
+                std::cerr << "Could not load " << *it_path << std::endl << parserStream.str();
+                exitCode = 1;
+                continue;
+            }
 
-                for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++)
-                {
-                    std::ofstream airplaneStream;
-                    std::string airplaneMap = airportPath + "airplanes/" + it_airplane->second->getNumber() + ".txt";
-                    airplaneStream.open(airplaneMap.c_str());
+            for (AirportMap::const_iterator it_airport = input.getAirports().begin(); it_airport != input.getAirports().end(); it_airport++) {
+                const unsigned long long start = getMonotonicNanoseconds();
+                const std::vector<ReplicationResult> results = runner.run(it_airport->second);
+                const double elapsed = (getMonotonicNanoseconds() - start) / 1000000.0;
 
-                    it_airplane->second->printInfo(airplaneStream);
+                std::ostringstream report;
+                MonteCarloRunner::report(results, report);
+
+                std::ofstream reportStream;
+                std::string reportStreamName = *it_path + it_airport->second->getIata() + "/output_montecarlo.txt";
+                reportStream.open(reportStreamName.c_str());
+                reportStream << report.str();
+                reportStream.close();
+
+                std::cout << std::endl << *it_path << it_airport->second->getIata() << " in " << std::fixed << std::setprecision(1) << elapsed << " ms" << std::endl << report.str();
+            }
+        }
+        return exitCode;
+    }
+
+    bool parseRunwayTypes(const std::string& text, std::vector<RunwayEnums::EType>& types) {
+        std::vector<RunwayEnums::EType> parsed;
+        std::stringstream stream(text);
+        std::string name;
+        while (std::getline(stream, name, ',')) {
+            const RunwayEnums::EType type = RunwayEnums::StringToTypeEnum(name.c_str());
+            if (type == RunwayEnums::kInvalidType && name != "keep") return false;
+            parsed.push_back(type);
+        }
+        if (parsed.empty()) return false;
+        types = parsed;
+        return true;
+    }
+
+    bool parseMixes(const std::string& text, std::vector<FleetMix>& mixes) {
+        std::vector<FleetMix> parsed;
+        std::stringstream stream(text);
+        std::string name;
+        while (std::getline(stream, name, ',')) {
+            FleetMix mix;
+            if (!mix.parse(name)) return false;
+            parsed.push_back(mix);
+        }
+        if (parsed.empty()) return false;
+        mixes = parsed;
+        return true;
+    }
 
-                    airplaneStream.close();
+    int runSweep(int argc, char **argv) {
+        SweepRanges ranges;
+        unsigned int threads = 0;
+        std::vector<std::string> paths;
+
+        for (int i = 2; i < argc; i++) {
+            std::string argument = argv[i];
+            std::vector<unsigned int> values;
+            int value = 0;
+
+            if (i + 1 < argc && argument == "--gates" && ParameterSweep::parseRange(argv[i + 1], values)) {
+                ranges.gates.assign(values.begin(), values.end());
+                i++;
+            } else if (i + 1 < argc && argument == "--runway-length" && ParameterSweep::parseRange(argv[i + 1], ranges.runwayLengths)) {
+                i++;
+            } else if (i + 1 < argc && argument == "--runway-type" && parseRunwayTypes(argv[i + 1], ranges.runwayTypes)) {
+                i++;
+            } else if (i + 1 < argc && argument == "--mix" && parseMixes(argv[i + 1], ranges.mixes)) {
+                i++;
+            } else if (i + 1 < argc && argument == "--arrivals" && ParameterSweep::parseRange(argv[i + 1], ranges.arrivals)) {
+                i++;
+            } else if (argument == "--jobs" && i + 1 < argc && tryCastStringToInt(argv[i + 1], &value) && value > 0) {
+                threads = value;
+                i++;
+            } else if (!expandScenarios(argument, paths)) {
+                std::cerr << "No scenario directory matches " << argument << std::endl;
+            }
+        }
+
+        if (paths.empty()) {
+            std::cout << "Usage: PSE_Release --sweep [--gates RANGE] [--runway-length PERCENT_RANGE] [--runway-type keep,asphalt,grass]" << std::endl;
+            std::cout << "                   [--mix keep,PRIVATE:AIRLINE:MILITARY:EMERGENCY] [--arrivals PERCENT_RANGE] [--jobs N]" << std::endl;
+            std::cout << "                   SCENARIO_DIRECTORY_OR_GLOB..." << std::endl;
+            std::cout << "A RANGE is a comma separated list of numbers and FROM-TO or FROM-TO/STEP ranges, 0 gates keeps the gate count" << std::endl;
+            return 1;
+        }
+
+        int exitCode = 0;
+        const std::vector<SweepPoint> points = ranges.getPoints();
+        ParameterSweep sweep(threads, MonteCarloOptions().tickLimit);
+        for (std::vector<std::string>::const_iterator it_path = paths.begin(); it_path != paths.end(); it_path++) {
+            std::ostringstream parserStream;
+            ScenarioInput input;
+            if (input.load(*it_path, parserStream) != ParseEnum::kSuccess) {
+                std::cerr << "Could not load " << *it_path << std::endl << parserStream.str();
+                exitCode = 1;
+                continue;
+            }
+
+            for (AirportMap::const_iterator it_airport = input.getAirports().begin(); it_airport != input.getAirports().end(); it_airport++) {
+                const Airport* airport = it_airport->second;
+
+                std::vector<SweepPoint> valid;
+                for (std::vector<SweepPoint>::const_iterator it_point = points.begin(); it_point != points.end(); it_point++) {
+                    if (it_point->runwayLength == 0) continue;
+                    if (it_point->gates != 0 && it_point->gates < ParameterSweep::getMinimumGates(airport)) continue;
+                    if (it_point->arrivals != 0 && !ParameterSweep::canDraw(airport, it_point->mix)) continue;
+                    valid.push_back(*it_point);
+                }
+                if (valid.size() != points.size()) {
+                    std::cerr << airport->getIata() << ": skipped " << points.size() - valid.size() << " points with no runway length, fewer gates than "
+                              << ParameterSweep::getMinimumGates(airport) << " in use or a fleet mix without base arrivals" << std::endl;
                 }
 
-                Simulator simulator(airport, outputStream, errorStream, towerStream, floorplanStream);
-                simulator.Simulate();
+                const unsigned long long start = getMonotonicNanoseconds();
+                const std::vector<SweepResult> results = sweep.run(airport, valid);
+                const double elapsed = (getMonotonicNanoseconds() - start) / 1000000.0;
+
+                std::ostringstream report;
+                ParameterSweep::report(results, report);
 
-                outputStream.close();
-                errorStream.close();
-                towerStream.close();
-                floorplanStream.close();
-                airportInfoStream.close();
+                std::ofstream reportStream;
+                std::string reportStreamName = *it_path + airport->getIata() + "/output_sweep.txt";
+                reportStream.open(reportStreamName.c_str());
+                reportStream << report.str();
+                reportStream.close();
+
+                std::cout << std::endl << *it_path << airport->getIata() << ": " << results.size() << " points in " << std::fixed << std::setprecision(1) << elapsed << " ms" << std::endl << report.str();
+            }
+        }
+        return exitCode;
+    }
+
+    int runSaturation(int argc, char **argv) {
+        SaturationOptions options;
+        std::vector<std::string> paths;
+
+        for (int i = 2; i < argc; i++) {
+            std::string argument = argv[i];
+            int value = 0;
+
+            if (argument == "--max-holding" && i + 1 < argc && tryCastStringToInt(argv[i + 1], &value) && value >= 0) {
+                options.maxHolding = value;
+                i++;
+            } else if (argument == "--upper" && i + 1 < argc && tryCastStringToInt(argv[i + 1], &value) && value > 0) {
+                options.upper = value;
+                i++;
+            } else if (argument == "--precision" && i + 1 < argc && tryCastStringToInt(argv[i + 1], &value) && value > 0) {
+                options.precision = value;
+                i++;
+            } else if (argument == "--mix" && i + 1 < argc && options.mix.parse(argv[i + 1])) {
+                i++;
+            } else if (argument == "--jobs" && i + 1 < argc && tryCastStringToInt(argv[i + 1], &value) && value > 0) {
+                options.threads = value;
+                i++;
+            } else if (!expandScenarios(argument, paths)) {
+                std::cerr << "No scenario directory matches " << argument << std::endl;
+            }
+        }
+
+        if (paths.empty()) {
+            std::cout << "Usage: PSE_Release --saturation [--max-holding MINUTES] [--upper PERCENT] [--precision PERCENT]" << std::endl;
+            std::cout << "                        [--mix keep|PRIVATE:AIRLINE:MILITARY:EMERGENCY] [--jobs N] SCENARIO_DIRECTORY_OR_GLOB..." << std::endl;
+            return 1;
+        }
 
-                delete airport;
+        int exitCode = 0;
+        for (std::vector<std::string>::const_iterator it_path = paths.begin(); it_path != paths.end(); it_path++) {
+            std::ostringstream parserStream;
+            ScenarioInput input;
+            if (input.load(*it_path, parserStream) != ParseEnum::kSuccess) {
+                std::cerr << "Could not load " << *it_path << std::endl << parserStream.str();
+                exitCode = 1;
+                continue;
+            }
+
+            for (AirportMap::const_iterator it_airport = input.getAirports().begin(); it_airport != input.getAirports().end(); it_airport++) {
+                const Airport* airport = it_airport->second;
+                if (!ParameterSweep::canDraw(airport, options.mix)) {
+                    std::cerr << airport->getIata() << " has no arrivals of fleet mix " << options.mix.getName() << std::endl;
+                    exitCode = 1;
+                    continue;
+                }
+
+                const unsigned long long start = getMonotonicNanoseconds();
+                SaturationFinder finder(options);
+                finder.search(airport);
+                const double elapsed = (getMonotonicNanoseconds() - start) / 1000000.0;
+
+                std::ostringstream report;
+                finder.report(report);
+
+                std::ofstream reportStream;
+                std::string reportStreamName = *it_path + airport->getIata() + "/output_saturation.txt";
+                reportStream.open(reportStreamName.c_str());
+                reportStream << report.str();
+                reportStream.close();
+
+                std::cout << std::endl << *it_path << airport->getIata() << ": " << finder.getProbes().size() << " runs in " << std::fixed << std::setprecision(1) << elapsed << " ms" << std::endl << report.str();
+            }
+        }
+        return exitCode;
+    }
+}
+
+int main(int argc, char **argv) {
+    std::cout << "Hello, Release!" << std::endl;
+    if (argc > 1 && std::string(argv[1]) == "--batch") return runBatch(argc, argv);
+    if (argc > 1 && std::string(argv[1]) == "--monte-carlo") return runMonteCarlo(argc, argv);
+    if (argc > 1 && std::string(argv[1]) == "--sweep") return runSweep(argc, argv);
+    if (argc > 1 && std::string(argv[1]) == "--saturation") return runSaturation(argc, argv);
+
+    RunOptions options;
+    while (argc > 2) {
+        if (!parseFlag(argv[argc - 1], options)) break;
+        argc--;
+    }
+
+    if (argc == 2) {
+        std::cout << "Running scenario " << argv[1] << std::endl;
+        std::string scenarioName = argv[1];
+        std::string path = "scenarios/" + scenarioName + "/";
+        if (DirectoryExists(path)) {
+            ScenarioRunner runner(options);
+            const ScenarioSummary summary = runner.run(path, std::cout);
+            if (summary.cached) std::cout << "Restored the outputs from the cache" << std::endl;
+            if (summary.result == ParseEnum::kAborted) {
+                std::cerr << "Could not load scenario " << scenarioName << ", see " << path << "output_parser.txt" << std::endl;
+                return 1;
             }
         }
     }
@@ -6,6 +6,8 @@
 #include "utils/Utils.h"
 
 int main(int argc, char **argv) {
+    // the performance regression tests only run when they are selected with --gtest_filter
+    ::testing::GTEST_FLAG(filter) = "-PerformanceRegressionTests.*";
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
 }
\ No newline at end of file
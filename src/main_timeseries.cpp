@@ -0,0 +1,45 @@
+#include <iostream>
+#include <fstream>
+
+#include "classes/TimeSeries.h"
+
+namespace {
+    void printUsage() {
+        std::cout << "Usage: PSE_TimeSeries TIMESERIES_BIN [CSV]" << std::endl;
+        std::cout << "Converts an output_timeseries.bin to CSV, written to standard output when no CSV file is given" << std::endl;
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2 && argc != 3) {
+        printUsage();
+        return 1;
+    }
+
+    std::ifstream input(argv[1], std::ios::binary);
+    if (!input.is_open()) {
+        std::cerr << "Could not open " << argv[1] << std::endl;
+        return 1;
+    }
+
+    TimeSeriesReader reader(input);
+    if (!reader.isValid()) {
+        std::cerr << argv[1] << " is not a time series" << std::endl;
+        return 1;
+    }
+
+    std::ofstream output;
+    if (argc == 3) {
+        output.open(argv[2]);
+        if (!output.is_open()) {
+            std::cerr << "Could not open " << argv[2] << std::endl;
+            return 1;
+        }
+    }
+
+    if (!reader.writeCsv(argc == 3 ? output : std::cout)) {
+        std::cerr << argv[1] << " is damaged, the rows before the damage were written" << std::endl;
+        return 2;
+    }
+    return 0;
+}
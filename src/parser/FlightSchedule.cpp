@@ -0,0 +1,199 @@
+#include "FlightSchedule.h"
+
+#include <algorithm>
+
+bool FlightSchedule::properlyInitialized() const {
+    return this == init;
+}
+
+FlightSchedule::FlightSchedule(std::istream& _stream, std::ostream& _errorStream, const std::string& _iata)
+        : stream(_stream),
+          errorStream(_errorStream),
+          parser(_errorStream),
+          iata(_iata),
+          buffer(),
+          searched(0),
+          line(1),
+          primed(false),
+          next(NULL),
+          nextTime(0),
+          lastTime(0),
+          taken(0),
+          rejected(0),
+          init(this) {
+    ENSURE(properlyInitialized(), "FlightSchedule was not properly initialized.");
+}
+
+FlightSchedule::~FlightSchedule() {
+    delete next;
+}
+
+void FlightSchedule::setPerformanceTable(const PerformanceTable* _performanceTable) {
+    REQUIRE(properlyInitialized(), "FlightSchedule was not properly initialized.");
+    REQUIRE(_performanceTable != NULL, "Referenced PerformanceTable is a nullpointer.");
+    REQUIRE(!isPrimed(), "FlightSchedule was already read from.");
+    parser.setPerformanceTable(_performanceTable);
+}
+
+void FlightSchedule::setAircraftDatabase(AircraftDatabase* _aircraftDatabase) {
+    REQUIRE(properlyInitialized(), "FlightSchedule was not properly initialized.");
+    REQUIRE(!isPrimed(), "FlightSchedule was already read from.");
+    parser.setAircraftDatabase(_aircraftDatabase);
+}
+
+bool FlightSchedule::isPrimed() const {
+    return primed;
+}
+
+bool FlightSchedule::readElement(std::string& element, unsigned long& firstLine) {
+    const std::string closingTag = "</AIRPLANE>";
+
+    // only the lines read since the last search can complete the closing tag
+    std::string::size_type end = buffer.find(closingTag, searched);
+    std::string text;
+    while (end == std::string::npos) {
+        searched = (buffer.size() >= closingTag.size() ? buffer.size() - closingTag.size() + 1 : 0);
+        if (!std::getline(stream, text)) return false;
+        buffer += text;
+        buffer += '\n';
+        end = buffer.find(closingTag, searched);
+    }
+    end += closingTag.size();
+
+    // the element starts on its first line, the rows TinyXML reports are counted from there
+    const std::string::size_type start = buffer.find_first_not_of(" \t\r\n");
+    line += std::count(buffer.begin(), buffer.begin() + start, '\n');
+    firstLine = line;
+
+    element = buffer.substr(start, end - start);
+    buffer.erase(0, end);
+    searched = 0;
+    line += std::count(element.begin(), element.end(), '\n');
+    return true;
+}
+
+bool FlightSchedule::readTime(TiXmlElement* object, const char* name, bool& found, unsigned int& time) {
+    TiXmlElement* timeElement = object->FirstChildElement(name);
+    found = (timeElement != NULL);
+    if (!found) return true;
+
+    int timeAsInt = 0;
+    if (timeElement->GetText() != NULL && tryCastStringToInt(timeElement->GetText(), &timeAsInt) && timeAsInt >= 0) {
+        time = static_cast<unsigned int>(timeAsInt);
+        return true;
+    }
+
+    errorStream << object->Value() << ": '" << name << "' attribute is not an unsigned integer. " << getRowAndColumnStr(timeElement) << std::endl;
+    return false;
+}
+
+void FlightSchedule::advance() {
+    primed = true;
+    next = NULL;
+
+    std::string element;
+    unsigned long firstLine = 0;
+    while (next == NULL && readElement(element, firstLine)) {
+        TiXmlDocument document;
+        document.Parse(element.c_str());
+        if (document.Error()) {
+            errorStream << "Error loading schedule entry at line " << firstLine << ": " << document.ErrorDesc() << std::endl;
+            rejected++;
+            continue;
+        }
+
+        for (TiXmlElement* object = document.FirstChildElement(); object != NULL; object = object->NextSiblingElement()) {
+            std::string objectName = object->Value();
+            if (objectName != "AIRPLANE") {
+                errorStream << "Invalid object '" << objectName << "' in the schedule entry at line " << firstLine << "." << std::endl;
+                rejected++;
+                continue;
+            }
+
+            TiXmlElement* airportElement = object->FirstChildElement("airport");
+            if (!iata.empty() && airportElement != NULL && airportElement->GetText() != NULL && iata != airportElement->GetText()) continue;
+
+            bool hasArrival = false;
+            bool hasDeparture = false;
+            unsigned int arrival = 0;
+            unsigned int departure = 0;
+            bool invalidEntry = !readTime(object, "arrival", hasArrival, arrival);
+            invalidEntry = !readTime(object, "departure", hasDeparture, departure) || invalidEntry;
+
+            Airplane* airplane = parser.parseAirplane(object);
+            const unsigned int time = (hasArrival ? arrival : departure);
+
+            if (airplane != NULL && !invalidEntry) {
+                if (airplane->getStatus() == AirplaneEnums::kStatus_Approaching && !hasArrival) {
+                    invalidEntry = true;
+                    errorStream << objectName << ": 'arrival' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
+                } else if (airplane->getStatus() == AirplaneEnums::kStatus_StandingAtGate && !hasDeparture) {
+                    invalidEntry = true;
+                    errorStream << objectName << ": 'departure' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
+                } else if (hasDeparture && departure < time) {
+                    invalidEntry = true;
+                    errorStream << objectName << ": 'departure' is before 'arrival'. " << getRowAndColumnStr(object) << std::endl;
+                } else if (time < lastTime) {
+                    invalidEntry = true;
+                    errorStream << objectName << ": entry is placed before the previous entry, the schedule must be in time order. " << getRowAndColumnStr(object) << std::endl;
+                }
+            }
+
+            if (airplane == NULL || invalidEntry) {
+                delete airplane;
+                errorStream << "Schedule entry at line " << firstLine << " was rejected, the rows above are counted from that line." << std::endl;
+                rejected++;
+                continue;
+            }
+
+            if (hasDeparture) airplane->setDepartureTime(departure);
+            next = airplane;
+            nextTime = time;
+            lastTime = time;
+            break;
+        }
+    }
+
+    if (next == NULL && buffer.find_first_not_of(" \t\r\n") != std::string::npos) {
+        errorStream << "Error loading schedule entry at line " << line << ": the schedule ends inside an entry." << std::endl;
+        rejected++;
+        buffer.clear();
+    }
+}
+
+bool FlightSchedule::isExhausted() {
+    REQUIRE(properlyInitialized(), "FlightSchedule was not properly initialized.");
+    if (!primed) advance();
+    return next == NULL;
+}
+
+unsigned int FlightSchedule::getNextTime() {
+    REQUIRE(properlyInitialized(), "FlightSchedule was not properly initialized.");
+    REQUIRE(!isExhausted(), "FlightSchedule is exhausted.");
+    return nextTime;
+}
+
+Airplane* FlightSchedule::takeNext() {
+    REQUIRE(properlyInitialized(), "FlightSchedule was not properly initialized.");
+    REQUIRE(!isExhausted(), "FlightSchedule is exhausted.");
+
+    Airplane* airplane = next;
+    taken++;
+    advance();
+    return airplane;
+}
+
+unsigned long FlightSchedule::getTaken() const {
+    REQUIRE(properlyInitialized(), "FlightSchedule was not properly initialized.");
+    return taken;
+}
+
+unsigned long FlightSchedule::getRejected() const {
+    REQUIRE(properlyInitialized(), "FlightSchedule was not properly initialized.");
+    return rejected;
+}
+
+ParseEnum::EResult FlightSchedule::getResult() const {
+    REQUIRE(properlyInitialized(), "FlightSchedule was not properly initialized.");
+    return (rejected == 0 ? ParseEnum::kSuccess : ParseEnum::kPartial);
+}
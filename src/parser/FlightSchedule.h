@@ -0,0 +1,142 @@
+#ifndef INC_FLIGHTSCHEDULE_H
+#define INC_FLIGHTSCHEDULE_H
+
+#include "../lib/tinyxml/tinyxml.h"
+#include "../lib/DesignByContract.h"
+#include "Parser.h"
+
+#include <iostream>
+#include <string>
+
+/**
+ * Reads a flight schedule one AIRPLANE element at a time, only the next entry is held in memory. \n
+ * AIRPLANE: the elements of Parser::parseAirplane, arrival, departure, airport \n
+ * arrival is the tick an Approaching Airplane enters at 10000 ft, it is required for Approaching Airplanes. \n
+ * departure is the first tick an Airplane may request its IFR clearance at the gate, it is required for StandingAtGate
+ * Airplanes, which are placed at a gate at their arrival or at their departure when they have no arrival. \n
+ * airport is the IATA of the Airport the entry belongs to, entries without one belong to every Airport. \n
+ * The entries must be in the order of the tick they are placed at, the schedule is never sorted. Rejected entries are
+ * written to the error stream and skipped.
+ */
+class FlightSchedule {
+private:
+    std::istream& stream;
+    std::ostream& errorStream;
+    Parser parser;
+    std::string iata;
+
+    std::string buffer;
+    std::string::size_type searched;
+    unsigned long line;
+
+    bool primed;
+    Airplane* next;
+    unsigned int nextTime;
+    unsigned int lastTime;
+    unsigned long taken;
+    unsigned long rejected;
+
+    const FlightSchedule* init;
+
+    bool properlyInitialized() const;
+
+    /**
+     * Reads lines until the buffer holds a whole AIRPLANE element
+     * @return false at the end of the stream
+     */
+    bool readElement(std::string& element, unsigned long& firstLine);
+
+    /**
+     * Reads a tick from the child element
+     * @return false if the child exists but holds no unsigned integer
+     */
+    bool readTime(TiXmlElement* object, const char* name, bool& found, unsigned int& time);
+
+    /**
+     * Reads entries until the next one of the Airport or the end of the stream
+     */
+    void advance();
+
+    FlightSchedule(const FlightSchedule&);
+
+    FlightSchedule& operator=(const FlightSchedule&);
+
+public:
+    /**
+     * Nothing is read before the first entry is asked for \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "FlightSchedule was not properly initialized.");
+     * @param _iata Only the entries of this Airport are read, empty reads every entry
+     */
+    FlightSchedule(std::istream& _stream, std::ostream& _errorStream, const std::string& _iata = "");
+
+    /**
+     * Deletes the entry that was read but not taken
+     */
+    ~FlightSchedule();
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "FlightSchedule was not properly initialized."); \n
+     * REQUIRE(_performanceTable != NULL, "Referenced PerformanceTable is a nullpointer."); \n
+     * REQUIRE(!isPrimed(), "FlightSchedule was already read from.");
+     */
+    void setPerformanceTable(const PerformanceTable* _performanceTable);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "FlightSchedule was not properly initialized."); \n
+     * REQUIRE(!isPrimed(), "FlightSchedule was already read from.");
+     */
+    void setAircraftDatabase(AircraftDatabase* _aircraftDatabase);
+
+    /**
+     * @return true once the first entry was read
+     */
+    bool isPrimed() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "FlightSchedule was not properly initialized.");
+     * @return true if every entry was taken
+     */
+    bool isExhausted();
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "FlightSchedule was not properly initialized."); \n
+     * REQUIRE(!isExhausted(), "FlightSchedule is exhausted.");
+     * @return the tick the next entry is placed at
+     */
+    unsigned int getNextTime();
+
+    /**
+     * Hands over the next entry and reads the one after it, its departure time is set and it has no Airport or squawk yet \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "FlightSchedule was not properly initialized."); \n
+     * REQUIRE(!isExhausted(), "FlightSchedule is exhausted.");
+     * @return the Airplane, the caller becomes responsible for deleting it
+     */
+    Airplane* takeNext();
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "FlightSchedule was not properly initialized.");
+     */
+    unsigned long getTaken() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "FlightSchedule was not properly initialized.");
+     */
+    unsigned long getRejected() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "FlightSchedule was not properly initialized.");
+     * @return kSuccess, or kPartial if entries were rejected so far
+     */
+    ParseEnum::EResult getResult() const;
+};
+
+#endif
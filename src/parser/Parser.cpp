@@ -1,12 +1,27 @@
 #include "Parser.h"
 
-Parser::Parser(std::ostream& _errorStream) : errorStream(_errorStream) {};
+Parser::Parser(std::ostream& _errorStream) : errorStream(_errorStream), performanceTable(&PerformanceTable::getDefault()), aircraftDatabase(NULL), trace(NULL) {};
+
+void Parser::setPerformanceTable(const PerformanceTable* _performanceTable) {
+    REQUIRE(_performanceTable != NULL, "Referenced PerformanceTable is a nullpointer.");
+    performanceTable = _performanceTable;
+}
+
+void Parser::setAircraftDatabase(AircraftDatabase* _aircraftDatabase) {
+    aircraftDatabase = _aircraftDatabase;
+}
+
+void Parser::setTrace(TraceWriter* _trace) {
+    trace = _trace;
+}
 
 std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > Parser::parseFile(const char* fileName) {
     TiXmlDocument xmlFile;
 
     std::map<std::string, Airport*> allAirports;
 
+    const unsigned long long parseStart = (trace != NULL ? getMonotonicNanoseconds() : 0);
+
     if (!xmlFile.LoadFile(fileName)) {
         errorStream << "Error loading file: " << xmlFile.ErrorDesc() << std::endl;
         xmlFile.Clear();
@@ -19,11 +34,14 @@ std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > Parser::parseFil
         return std::pair<ParseEnum::EResult, std::map<std::string, Airport*> >(ParseEnum::kAborted, allAirports);
     }
 
+    if (trace != NULL) trace->span("load", "parse", parseStart, getMonotonicNanoseconds(), fileName);
+
     ParseEnum::EResult parseResult = ParseEnum::kSuccess;
 
     Airport* lastAirport = NULL;
 
     for (TiXmlElement* object = xmlFile.FirstChildElement(); object != NULL; object = object->NextSiblingElement()) {
+        const unsigned long long objectStart = (trace != NULL ? getMonotonicNanoseconds() : 0);
         std::string objectName = object->Value();
         if (objectName == "AIRPORT") {
             std::string airportName;
@@ -207,155 +225,46 @@ std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > Parser::parseFil
                 }
             }
         } else if (objectName == "AIRPLANE") {
-            std::string airplaneNumber = "";
-            std::string airplaneCallsign = "";
-            std::string airplaneModel = "";
-
-            unsigned int airplaneFuelCapacity = 0;
-            unsigned int airplanePassengerCapacity = 0;
-
-            AirplaneEnums::EStatus airplaneStatus = AirplaneEnums::kStatus_InvalidStatus;
-            AirplaneEnums::EType airplaneType = AirplaneEnums::kType_InvalidType;
-            AirplaneEnums::ESize airplaneSize = AirplaneEnums::kSize_InvalidSize;
-            AirplaneEnums::EEngine airplaneEngine = AirplaneEnums::kEngine_InvalidEngine;
+            Airplane* newAirplane = parseAirplane(object);
 
-            bool invalidAirplane = false;
-
-            std::map<std::string, std::string> airplaneMap = convertXmlNodeToMap(object);
-
-            if (airplaneMap.find("number") != airplaneMap.end()) {
-                airplaneNumber = airplaneMap.at("number");
-            } else {
-                invalidAirplane = true;
-                errorStream << objectName << ": 'number' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
-            }
-
-            if (airplaneMap.find("callsign") != airplaneMap.end()) {
-                airplaneCallsign = airplaneMap.at("callsign");
-            } else {
-                invalidAirplane = true;
-                errorStream << objectName << ": 'callsign' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
-            }
-
-            if (airplaneMap.find("model") != airplaneMap.end()) {
-                airplaneModel = airplaneMap.at("model");
-            } else {
-                invalidAirplane = true;
-                errorStream << objectName << ": 'model' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
-            }
-
-            if (airplaneMap.find("fuel") != airplaneMap.end()) {
-                int fuelCapacityAsInt = 0;
-                if (tryCastStringToInt(airplaneMap.at("fuel"), &fuelCapacityAsInt) && fuelCapacityAsInt > 0) {
-                    airplaneFuelCapacity = static_cast<unsigned int>(fuelCapacityAsInt);
-                } else {
-                    invalidAirplane = true;
-                    errorStream << objectName << ": 'fuel' attribute is not an unsigned positive integer. " << getRowAndColumnStr(object) << std::endl;
-                }
-            } else {
-                invalidAirplane = true;
-                errorStream << objectName << ": 'fuel' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
-            }
-
-            if (airplaneMap.find("passengers") != airplaneMap.end()) {
-                int passengerCapacityAsInt = 0;
-                if (tryCastStringToInt(airplaneMap.at("passengers"), &passengerCapacityAsInt) && passengerCapacityAsInt > 0) {
-                    airplanePassengerCapacity = static_cast<unsigned int>(passengerCapacityAsInt);
-                } else {
-                    invalidAirplane = true;
-                    errorStream << objectName << ": 'passengers' attribute is not an unsigned positive integer. " << getRowAndColumnStr(object) << std::endl;
-                }
-            } else {
-                invalidAirplane = true;
-                errorStream << objectName << ": 'passengers' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
-            }
-
-            if (airplaneMap.find("status") != airplaneMap.end()) {
-                AirplaneEnums::EStatus tempStatus = AirplaneEnums::StringToStatusEnum(airplaneMap.at("status").c_str());
-                if (tempStatus == AirplaneEnums::kStatus_Approaching || tempStatus == AirplaneEnums::kStatus_StandingAtGate) {
-                    airplaneStatus = tempStatus;
-                } else {
-                    invalidAirplane = true;
-                    errorStream << objectName << ": 'status' attribute does not contain a valid option. " << getRowAndColumnStr(object) << std::endl;
-                }
-            } else {
-                invalidAirplane = true;
-                errorStream << objectName << ": 'status' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
-            }
-
-            if (airplaneMap.find("type") != airplaneMap.end()) {
-                AirplaneEnums::EType tempType = AirplaneEnums::StringToTypeEnum(airplaneMap.at("type").c_str());
-                if (tempType != AirplaneEnums::kType_InvalidType) {
-                    airplaneType = tempType;
-                } else {
-                    invalidAirplane = true;
-                    errorStream << objectName << ": 'type' attribute does not contain a valid option. " << getRowAndColumnStr(object) << std::endl;
-                }
-            } else {
-                invalidAirplane = true;
-                errorStream << objectName << ": 'type' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
-            }
-
-            if (airplaneMap.find("size") != airplaneMap.end()) {
-                AirplaneEnums::ESize tempSize = AirplaneEnums::StringToSizeEnum(airplaneMap.at("size").c_str());
-                if (tempSize != AirplaneEnums::kSize_InvalidSize) {
-                    airplaneSize = tempSize;
-                } else {
-                    invalidAirplane = true;
-                    errorStream << objectName << ": 'size' attribute does not contain a valid option. " << getRowAndColumnStr(object) << std::endl;
-                }
-            } else {
-                invalidAirplane = true;
-                errorStream << objectName << ": 'size' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
-            }
-
-            if (airplaneMap.find("engine") != airplaneMap.end()) {
-                AirplaneEnums::EEngine tempType = AirplaneEnums::StringToEngineEnum(airplaneMap.at("engine").c_str());
-                if (tempType != AirplaneEnums::kEngine_InvalidEngine) {
-                    airplaneEngine = tempType;
-                } else {
-                    invalidAirplane = true;
-                    errorStream << objectName << ": 'engine' attribute does not contain a valid option. " << getRowAndColumnStr(object) << std::endl;
-                }
-            } else {
-                invalidAirplane = true;
-                errorStream << objectName << ": 'engine' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
-            }
-
-            if (invalidAirplane) {
+            if (newAirplane == NULL) {
                 parseResult = ParseEnum::kPartial;
             } else if (lastAirport != NULL) {
-                unsigned int altitude = (airplaneStatus == AirplaneEnums::kStatus_Approaching ? 10000 : 0);
-
-                Airplane* newAirplane = new Airplane(airplaneNumber, airplaneCallsign, airplaneModel, 0, altitude, airplaneFuelCapacity, airplaneFuelCapacity, airplanePassengerCapacity,
-                                                     airplanePassengerCapacity, airplaneStatus, airplaneType, airplaneSize, airplaneEngine);
-
                 newAirplane->setAirport(lastAirport);
                 lastAirport->addAirplane(newAirplane);
 
-                if (airplaneStatus == AirplaneEnums::kStatus_StandingAtGate) {
+                if (newAirplane->getStatus() == AirplaneEnums::kStatus_StandingAtGate) {
                     AirplaneVector::iterator it_freeGate = std::find(lastAirport->getGates().begin(), lastAirport->getGates().end(), static_cast<Airplane*>(NULL));
                     if (it_freeGate != lastAirport->getGates().end()) {
                         *it_freeGate = newAirplane;
                         newAirplane->setGate(std::distance(lastAirport->getGates().begin(), it_freeGate));
                     } else {
                         errorStream << objectName << ": no free gate for new airplane. " << getRowAndColumnStr(object) << std::endl;
+                        lastAirport->removeAirplane(newAirplane);
                         delete newAirplane;
                     }
                 }
             } else {
                 errorStream << objectName << ": No airport defined before this airplane. " << getRowAndColumnStr(object) << std::endl;
+                delete newAirplane;
             }
         } else {
             errorStream << "Invalid object '" << objectName << "'. " << getRowAndColumnStr(object) << std::endl;
             parseResult = ParseEnum::kPartial;
         }
+
+        if (trace != NULL) trace->span(objectName, "parse", objectStart, getMonotonicNanoseconds(), getRowAndColumnStr(object));
     }
 
+    const unsigned long long validateStart = (trace != NULL ? getMonotonicNanoseconds() : 0);
+
     for (AirportMap::const_iterator it_airport = allAirports.begin(); it_airport != allAirports.end(); it_airport++) {
         Airport* airport = it_airport->second;
 
-        for (AirplaneMap::iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); ) {
+        unsigned long airplaneIndex = 0;
+        std::vector<Airplane*> rejectedAirplanes;
+
+        for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
             Airplane* airplane = it_airplane->second;
 
             if (airport->getFreeCompatibleRunway(airplane) == NULL) {
@@ -367,55 +276,344 @@ std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > Parser::parseFil
                 }
             };
 
-            AirplaneEnums::EType airplaneType = airplane->getType();
-            AirplaneEnums::ESize airplaneSize = airplane->getSize();
-            AirplaneEnums::EEngine airplaneEngine = airplane->getEngine();
+            const unsigned int offset = airplane->getSquawkBlock();
+
+            if (offset == 00) {
+                errorStream << "Invalid airplane combination: " << airplane->getCallsign() << " (" << airplane->getNumber() << ") " << std::endl;
+                airplane->printInfo(errorStream);
+                parseResult = ParseEnum::kPartial;
+                rejectedAirplanes.push_back(airplane);
+            } else {
+                // every combination owns a block of 01000 codes, large airports reuse codes within their block
+                airplane->setSquawk(offset + airplaneIndex % 01000);
+                airplaneIndex++;
+            }
+        }
+
+        // removing rebuilds the ordered view of the Airport, that may not happen while it is iterated
+        for (std::vector<Airplane*>::iterator it_airplane = rejectedAirplanes.begin(); it_airplane != rejectedAirplanes.end(); it_airplane++) {
+            airport->removeAirplane(*it_airplane);
+            delete *it_airplane;
+        }
+    }
+
+    xmlFile.Clear();
+
+    if (trace != NULL) {
+        const unsigned long long parseEnd = getMonotonicNanoseconds();
+        trace->span("validate", "parse", validateStart, parseEnd);
+        trace->span("parseFile", "parse", parseStart, parseEnd, fileName);
+    }
+
+    return std::pair<ParseEnum::EResult, std::map<std::string, Airport*> >(parseResult, allAirports);
+}
+
+
+Airplane* Parser::parseAirplane(TiXmlElement* object) {
+    std::string objectName = object->Value();
+    std::string airplaneNumber = "";
+    std::string airplaneCallsign = "";
+    std::string airplaneModel = "";
+
+    unsigned int airplaneFuelCapacity = 0;
+    unsigned int airplanePassengerCapacity = 0;
+
+    AirplaneEnums::EStatus airplaneStatus = AirplaneEnums::kStatus_InvalidStatus;
+    AirplaneEnums::EType airplaneType = AirplaneEnums::kType_InvalidType;
+    AirplaneEnums::ESize airplaneSize = AirplaneEnums::kSize_InvalidSize;
+    AirplaneEnums::EEngine airplaneEngine = AirplaneEnums::kEngine_InvalidEngine;
+
+    bool invalidAirplane = false;
+
+    std::map<std::string, std::string> airplaneMap = convertXmlNodeToMap(object);
+
+    if (airplaneMap.find("number") != airplaneMap.end()) {
+        airplaneNumber = airplaneMap.at("number");
+    } else {
+        invalidAirplane = true;
+        errorStream << objectName << ": 'number' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
+    }
+
+    if (airplaneMap.find("callsign") != airplaneMap.end()) {
+        airplaneCallsign = airplaneMap.at("callsign");
+    } else {
+        invalidAirplane = true;
+        errorStream << objectName << ": 'callsign' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
+    }
+
+    if (airplaneMap.find("model") != airplaneMap.end()) {
+        airplaneModel = airplaneMap.at("model");
+    } else {
+        invalidAirplane = true;
+        errorStream << objectName << ": 'model' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
+    }
+
+    if (airplaneMap.find("fuel") != airplaneMap.end()) {
+        int fuelCapacityAsInt = 0;
+        if (tryCastStringToInt(airplaneMap.at("fuel"), &fuelCapacityAsInt) && fuelCapacityAsInt > 0) {
+            airplaneFuelCapacity = static_cast<unsigned int>(fuelCapacityAsInt);
+        } else {
+            invalidAirplane = true;
+            errorStream << objectName << ": 'fuel' attribute is not an unsigned positive integer. " << getRowAndColumnStr(object) << std::endl;
+        }
+    } else {
+        invalidAirplane = true;
+        errorStream << objectName << ": 'fuel' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
+    }
+
+    if (airplaneMap.find("passengers") != airplaneMap.end()) {
+        int passengerCapacityAsInt = 0;
+        if (tryCastStringToInt(airplaneMap.at("passengers"), &passengerCapacityAsInt) && passengerCapacityAsInt > 0) {
+            airplanePassengerCapacity = static_cast<unsigned int>(passengerCapacityAsInt);
+        } else {
+            invalidAirplane = true;
+            errorStream << objectName << ": 'passengers' attribute is not an unsigned positive integer. " << getRowAndColumnStr(object) << std::endl;
+        }
+    } else {
+        invalidAirplane = true;
+        errorStream << objectName << ": 'passengers' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
+    }
+
+    if (airplaneMap.find("status") != airplaneMap.end()) {
+        AirplaneEnums::EStatus tempStatus = AirplaneEnums::StringToStatusEnum(airplaneMap.at("status").c_str());
+        if (tempStatus == AirplaneEnums::kStatus_Approaching || tempStatus == AirplaneEnums::kStatus_StandingAtGate) {
+            airplaneStatus = tempStatus;
+        } else {
+            invalidAirplane = true;
+            errorStream << objectName << ": 'status' attribute does not contain a valid option. " << getRowAndColumnStr(object) << std::endl;
+        }
+    } else {
+        invalidAirplane = true;
+        errorStream << objectName << ": 'status' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
+    }
 
-            unsigned int offset = 00;
+    if (airplaneMap.find("type") != airplaneMap.end()) {
+        AirplaneEnums::EType tempType = AirplaneEnums::StringToTypeEnum(airplaneMap.at("type").c_str());
+        if (tempType != AirplaneEnums::kType_InvalidType) {
+            airplaneType = tempType;
+        } else {
+            invalidAirplane = true;
+            errorStream << objectName << ": 'type' attribute does not contain a valid option. " << getRowAndColumnStr(object) << std::endl;
+        }
+    } else {
+        invalidAirplane = true;
+        errorStream << objectName << ": 'type' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
+    }
+
+    if (airplaneMap.find("size") != airplaneMap.end()) {
+        AirplaneEnums::ESize tempSize = AirplaneEnums::StringToSizeEnum(airplaneMap.at("size").c_str());
+        if (tempSize != AirplaneEnums::kSize_InvalidSize) {
+            airplaneSize = tempSize;
+        } else {
+            invalidAirplane = true;
+            errorStream << objectName << ": 'size' attribute does not contain a valid option. " << getRowAndColumnStr(object) << std::endl;
+        }
+    } else {
+        invalidAirplane = true;
+        errorStream << objectName << ": 'size' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
+    }
 
-            if (airplaneType == AirplaneEnums::kType_Private) {
-                if (airplaneSize == AirplaneEnums::kSize_Small) {
-                    offset = 01;
-                } else if (airplaneSize == AirplaneEnums::kSize_Medium) {
-                    if (airplaneEngine == AirplaneEnums::kEngine_Jet) { offset = 01000; }
+    if (airplaneMap.find("engine") != airplaneMap.end()) {
+        AirplaneEnums::EEngine tempType = AirplaneEnums::StringToEngineEnum(airplaneMap.at("engine").c_str());
+        if (tempType != AirplaneEnums::kEngine_InvalidEngine) {
+            airplaneEngine = tempType;
+        } else {
+            invalidAirplane = true;
+            errorStream << objectName << ": 'engine' attribute does not contain a valid option. " << getRowAndColumnStr(object) << std::endl;
+        }
+    } else {
+        invalidAirplane = true;
+        errorStream << objectName << ": 'engine' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
+    }
+
+    if (invalidAirplane) return NULL;
+
+    unsigned int altitude = (airplaneStatus == AirplaneEnums::kStatus_Approaching ? 10000 : 0);
+
+    Airplane* newAirplane = new Airplane(airplaneNumber, airplaneCallsign, airplaneModel, 0, altitude, airplaneFuelCapacity, airplaneFuelCapacity, airplanePassengerCapacity,
+                                         airplanePassengerCapacity, airplaneStatus, airplaneType, airplaneSize, airplaneEngine);
+
+    if (aircraftDatabase != NULL) {
+        newAirplane->setAircraftType(aircraftDatabase->resolve(airplaneModel, airplaneSize, airplaneEngine, *performanceTable));
+    } else {
+        newAirplane->setAircraftType(performanceTable->getAircraftType(airplaneSize, airplaneEngine));
+    }
+
+    return newAirplane;
+}
+
+ParseEnum::EResult Parser::parsePerformanceFile(const char* fileName, PerformanceTable& table) {
+    TiXmlDocument xmlFile;
+
+    if (!xmlFile.LoadFile(fileName)) {
+        errorStream << "Error loading file: " << xmlFile.ErrorDesc() << std::endl;
+        xmlFile.Clear();
+        return ParseEnum::kAborted;
+    }
+
+    ParseEnum::EResult parseResult = ParseEnum::kSuccess;
+
+    for (TiXmlElement* object = xmlFile.FirstChildElement(); object != NULL; object = object->NextSiblingElement()) {
+        std::string objectName = object->Value();
+        std::map<std::string, std::string> objectMap = convertXmlNodeToMap(object);
+
+        if (objectName == "ACTION" || objectName == "FUEL") {
+            bool invalidObject = false;
+
+            AirplaneEnums::EStatus status = AirplaneEnums::kStatus_InvalidStatus;
+            unsigned int firstSize = AirplaneEnums::kSize_Small;
+            unsigned int lastSize = AirplaneEnums::kSize_Large;
+            unsigned int firstEngine = AirplaneEnums::kEngine_Propeller;
+            unsigned int lastEngine = AirplaneEnums::kEngine_Jet;
+            int value = 0;
+
+            const std::string valueName = (objectName == "ACTION" ? "minutes" : "consumption");
+
+            if (objectName == "ACTION") {
+                if (objectMap.find("status") != objectMap.end()) {
+                    status = AirplaneEnums::StringToStatusEnum(objectMap.at("status").c_str());
+                    if (status == AirplaneEnums::kStatus_InvalidStatus) {
+                        invalidObject = true;
+                        errorStream << objectName << ": 'status' attribute does not contain a valid option. " << getRowAndColumnStr(object) << std::endl;
+                    } else if (status == AirplaneEnums::kStatus_Refueling || status == AirplaneEnums::kStatus_EmergencyRefueling) {
+                        // the table would store it, but the Simulator derives refueling from the missing fuel and the REFUEL rate
+                        invalidObject = true;
+                        errorStream << objectName << ": 'status' attribute has no fixed duration, refueling follows from REFUEL. " << getRowAndColumnStr(object) << std::endl;
+                    }
+                } else {
+                    invalidObject = true;
+                    errorStream << objectName << ": 'status' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
                 }
-            } else if (airplaneType == AirplaneEnums::kType_Airline) {
-                if (airplaneSize == AirplaneEnums::kSize_Medium) {
-                    if (airplaneEngine == AirplaneEnums::kEngine_Propeller) { offset = 02000; }
-                    else if (airplaneEngine == AirplaneEnums::kEngine_Jet) { offset = 03000; }
-                } else if (airplaneSize == AirplaneEnums::kSize_Large) {
-                    if (airplaneEngine == AirplaneEnums::kEngine_Jet) { offset = 04000; }
+            }
+
+            if (objectMap.find("size") != objectMap.end()) {
+                AirplaneEnums::ESize size = AirplaneEnums::StringToSizeEnum(objectMap.at("size").c_str());
+                if (size != AirplaneEnums::kSize_InvalidSize) {
+                    firstSize = lastSize = size;
+                } else {
+                    invalidObject = true;
+                    errorStream << objectName << ": 'size' attribute does not contain a valid option. " << getRowAndColumnStr(object) << std::endl;
                 }
-            } else if (airplaneType == AirplaneEnums::kType_Military) {
-                if (airplaneSize == AirplaneEnums::kSize_Small) {
-                    if (airplaneEngine == AirplaneEnums::kEngine_Jet) { offset = 05000; }
-                } else if (airplaneSize == AirplaneEnums::kSize_Large) {
-                    if (airplaneEngine == AirplaneEnums::kEngine_Propeller) { offset = 05000; }
+            }
+
+            if (objectMap.find("engine") != objectMap.end()) {
+                AirplaneEnums::EEngine engine = AirplaneEnums::StringToEngineEnum(objectMap.at("engine").c_str());
+                if (engine != AirplaneEnums::kEngine_InvalidEngine) {
+                    firstEngine = lastEngine = engine;
+                } else {
+                    invalidObject = true;
+                    errorStream << objectName << ": 'engine' attribute does not contain a valid option. " << getRowAndColumnStr(object) << std::endl;
                 }
-            } else if (airplaneType == AirplaneEnums::kType_Emergency) {
-                if (airplaneSize == AirplaneEnums::kSize_Small) {
-                    if (airplaneEngine == AirplaneEnums::kEngine_Propeller) { offset = 06000; }
+            }
+
+            if (objectMap.find(valueName) != objectMap.end()) {
+                if (!tryCastStringToInt(objectMap.at(valueName), &value) || value < 0) {
+                    invalidObject = true;
+                    errorStream << objectName << ": '" << valueName << "' attribute is not an unsigned integer. " << getRowAndColumnStr(object) << std::endl;
                 }
+            } else {
+                invalidObject = true;
+                errorStream << objectName << ": '" << valueName << "' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
             }
 
-            if (offset == 00) {
-                errorStream << "Invalid airplane combination: " << airplane->getCallsign() << " (" << airplane->getNumber() << ") " << std::endl;
-                airplane->printInfo(errorStream);
+            if (invalidObject) {
                 parseResult = ParseEnum::kPartial;
-                delete it_airplane->second;
-                airport->getAirplanes().erase(it_airplane++);
+                continue;
+            }
+
+            for (unsigned int size = firstSize; size <= lastSize; size++) {
+                for (unsigned int engine = firstEngine; engine <= lastEngine; engine++) {
+                    if (objectName == "ACTION") {
+                        table.setActionTime(status, static_cast<AirplaneEnums::ESize>(size), static_cast<AirplaneEnums::EEngine>(engine), static_cast<unsigned int>(value));
+                    } else {
+                        table.setFuelConsumption(static_cast<AirplaneEnums::ESize>(size), static_cast<AirplaneEnums::EEngine>(engine), static_cast<unsigned int>(value));
+                    }
+                }
+            }
+        } else if (objectName == "REFUEL") {
+            int rate = 0;
+            if (objectMap.find("rate") != objectMap.end() && tryCastStringToInt(objectMap.at("rate"), &rate) && rate > 0) {
+                table.setRefuelRate(static_cast<unsigned int>(rate));
             } else {
-                airplane->setSquawk(offset + std::distance(airport->getAirplanes().begin(), it_airplane));
-                it_airplane++;
+                errorStream << objectName << ": 'rate' attribute is missing or not an unsigned positive integer. " << getRowAndColumnStr(object) << std::endl;
+                parseResult = ParseEnum::kPartial;
             }
+        } else {
+            errorStream << "Invalid object '" << objectName << "'. " << getRowAndColumnStr(object) << std::endl;
+            parseResult = ParseEnum::kPartial;
         }
     }
 
     xmlFile.Clear();
 
-    return std::pair<ParseEnum::EResult, std::map<std::string, Airport*> >(parseResult, allAirports);
+    return parseResult;
 }
 
+ParseEnum::EResult Parser::parseAircraftFile(const char* fileName, AircraftDatabase& database) {
+    TiXmlDocument xmlFile;
+
+    if (!xmlFile.LoadFile(fileName)) {
+        errorStream << "Error loading file: " << xmlFile.ErrorDesc() << std::endl;
+        xmlFile.Clear();
+        return ParseEnum::kAborted;
+    }
+
+    ParseEnum::EResult parseResult = ParseEnum::kSuccess;
+
+    const char* const specNames[] = {"fuel", "climb", "descent", "boarding", "pushback"};
+    const unsigned int specCount = sizeof(specNames) / sizeof(specNames[0]);
+
+    for (TiXmlElement* object = xmlFile.FirstChildElement(); object != NULL; object = object->NextSiblingElement()) {
+        std::string objectName = object->Value();
+        std::map<std::string, std::string> objectMap = convertXmlNodeToMap(object);
+
+        if (objectName != "AIRCRAFT") {
+            errorStream << "Invalid object '" << objectName << "'. " << getRowAndColumnStr(object) << std::endl;
+            parseResult = ParseEnum::kPartial;
+            continue;
+        }
+
+        bool invalidObject = false;
+        std::string model;
+        unsigned int specValues[specCount] = {0, 0, 0, 0, 0};
+
+        if (objectMap.find("model") != objectMap.end() && !objectMap.at("model").empty()) {
+            model = objectMap.at("model");
+        } else {
+            invalidObject = true;
+            errorStream << objectName << ": 'model' required attribute is missing. " << getRowAndColumnStr(object) << std::endl;
+        }
+
+        for (unsigned int i = 0; i < specCount; i++) {
+            if (objectMap.find(specNames[i]) == objectMap.end()) continue;
+
+            int value = 0;
+            if (tryCastStringToInt(objectMap.at(specNames[i]), &value) && value > 0) {
+                specValues[i] = static_cast<unsigned int>(value);
+            } else {
+                invalidObject = true;
+                errorStream << objectName << ": '" << specNames[i] << "' attribute is not an unsigned positive integer. " << getRowAndColumnStr(object) << std::endl;
+            }
+        }
+
+        if (invalidObject) {
+            parseResult = ParseEnum::kPartial;
+            continue;
+        }
+
+        AircraftSpec spec;
+        spec.fuelConsumption = specValues[0];
+        spec.climbRate = specValues[1];
+        spec.descentRate = specValues[2];
+        spec.boardingRate = specValues[3];
+        spec.pushbackTime = specValues[4];
+        database.setSpec(model, spec);
+    }
+
+    xmlFile.Clear();
+
+    return parseResult;
+}
 
 std::map<std::string, std::string> Parser::convertXmlNodeToMap(TiXmlElement* object) {
     std::map<std::string, std::string> xmltomap;
@@ -482,4 +680,4 @@ std::vector<std::pair<bool, std::string> > Parser::extractTaxiRoute(TiXmlElement
     }
 
     return taxiroute;
-}
\ No newline at end of file
+}
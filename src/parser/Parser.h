@@ -9,6 +9,9 @@
 #include "../classes/Airport.h"
 #include "../classes/Runway.h"
 #include "../classes/Airplane.h"
+#include "../classes/PerformanceTable.h"
+#include "../classes/AircraftDatabase.h"
+#include "../classes/TraceWriter.h"
 
 #include <string>
 #include <iostream>
@@ -28,11 +31,59 @@ namespace ParseEnum {
 class Parser {
 private:
     std::ostream& errorStream;
+
+    const PerformanceTable* performanceTable;
+    AircraftDatabase* aircraftDatabase;
+
+    TraceWriter* trace;
 public:
     Parser(std::ostream& _errorStream);
 
     std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > parseFile(const char* fileName);
 
+    /**
+     * Overrides entries of the referenced table with the ACTION, FUEL and REFUEL elements of the file \n
+     * ACTION: status (required), size, engine (all sizes/engines when omitted), minutes \n
+     * FUEL: size, engine (all sizes/engines when omitted), consumption \n
+     * REFUEL: rate
+     * @return kAborted if the file could not be loaded, kPartial if some elements were rejected
+     */
+    ParseEnum::EResult parsePerformanceFile(const char* fileName, PerformanceTable& table);
+
+    /**
+     * Airplanes created by parseFile read their action times and fuel consumption from this table \n
+     * PRE: \n
+     * REQUIRE(_performanceTable != NULL, "Referenced PerformanceTable is a nullpointer.");
+     */
+    void setPerformanceTable(const PerformanceTable* _performanceTable);
+
+    /**
+     * Adds the AIRCRAFT elements of the file to the referenced database \n
+     * AIRCRAFT: model (required), fuel, climb, descent, boarding, pushback
+     * @return kAborted if the file could not be loaded, kPartial if some elements were rejected
+     */
+    ParseEnum::EResult parseAircraftFile(const char* fileName, AircraftDatabase& database);
+
+    /**
+     * Airplanes created by parseFile whose model is in this database read their performance from the model's record \n
+     * NULL resolves every Airplane to its size/engine class
+     */
+    void setAircraftDatabase(AircraftDatabase* _aircraftDatabase);
+
+    /**
+     * parseFile writes spans for loading, every element and the validation of the airports to this trace \n
+     * NULL disables tracing, the Parser does not take ownership
+     */
+    void setTrace(TraceWriter* _trace);
+
+    /**
+     * Validates the attributes of an AIRPLANE element and creates the Airplane with its aircraft type resolved, the
+     * Airplane is not linked to an Airport and has no squawk yet \n
+     * AIRPLANE: number, callsign, model, fuel, passengers, status (Approaching or StandingAtGate), type, size, engine (all required)
+     * @return NULL if the element was rejected, the errors are written to the error stream
+     */
+    Airplane* parseAirplane(TiXmlElement* object);
+
     std::map<std::string, std::string> convertXmlNodeToMap(TiXmlElement* object);
 
     std::vector<std::pair<bool, std::string> > extractTaxiRoute(TiXmlElement* object);
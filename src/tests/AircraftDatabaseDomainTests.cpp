@@ -0,0 +1,62 @@
+#include "../classes/Airplane.h"
+#include "../classes/PerformanceTable.h"
+#include "../classes/AircraftDatabase.h"
+
+#include <gtest/gtest.h>
+
+class AircraftDatabaseDomainTests: public ::testing::Test {
+protected:
+    friend class AircraftDatabase;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(AircraftDatabaseDomainTests, resolve) {
+    PerformanceTable table;
+    AircraftDatabase database;
+
+    AircraftSpec spec;
+    spec.fuelConsumption = 300;
+    spec.climbRate = 400;
+    spec.descentRate = 1000;
+    spec.boardingRate = 40;
+
+    EXPECT_DEATH(database.setSpec("", spec), "Aircraft model is empty.");
+    EXPECT_NO_THROW(database.setSpec("Boeing 747", spec));
+    EXPECT_TRUE(database.hasModel("Boeing 747"));
+    EXPECT_FALSE(database.hasModel("Cessna 172"));
+
+    const AircraftType* classType = table.getAircraftType(AirplaneEnums::kSize_Large, AirplaneEnums::kEngine_Jet);
+    EXPECT_EQ(database.resolve("Cessna 172", AirplaneEnums::kSize_Large, AirplaneEnums::kEngine_Jet, table), classType);
+
+    const AircraftType* modelType = database.resolve("Boeing 747", AirplaneEnums::kSize_Large, AirplaneEnums::kEngine_Jet, table);
+    EXPECT_NE(modelType, classType);
+    EXPECT_EQ(database.resolve("Boeing 747", AirplaneEnums::kSize_Large, AirplaneEnums::kEngine_Jet, table), modelType);
+    EXPECT_NE(database.resolve("Boeing 747", AirplaneEnums::kSize_Medium, AirplaneEnums::kEngine_Jet, table), modelType);
+
+    EXPECT_EQ(modelType->fuelConsumption, static_cast<unsigned int>(300));
+    EXPECT_EQ(modelType->boardingRate, static_cast<unsigned int>(40));
+    EXPECT_EQ(modelType->actionTimes[AirplaneEnums::kStatus_Ascending], static_cast<unsigned int>(3));
+    EXPECT_EQ(modelType->actionTimes[AirplaneEnums::kStatus_FinalApproach], static_cast<unsigned int>(1));
+    EXPECT_EQ(modelType->actionTimes[AirplaneEnums::kStatus_PushingBack], classType->actionTimes[AirplaneEnums::kStatus_PushingBack]);
+    EXPECT_EQ(modelType->refuelRate, classType->refuelRate);
+
+    // the resolved records are shared, the figures of their model are fixed
+    EXPECT_TRUE(database.isResolved("Boeing 747"));
+    EXPECT_FALSE(database.isResolved("Cessna 172"));
+    EXPECT_DEATH(database.setSpec("Boeing 747", spec), "Aircraft model was already resolved.");
+
+    Airplane airplane = Airplane("N123", "Dummy Airplane", "Boeing 747", 01, 10000, 10000, 10000, 4, 4, AirplaneEnums::kStatus_Approaching, AirplaneEnums::kType_Airline, AirplaneEnums::kSize_Large, AirplaneEnums::kEngine_Jet);
+    EXPECT_EQ(airplane.getFuelConsumption(), static_cast<unsigned int>(250));
+    EXPECT_NO_THROW(airplane.setAircraftType(modelType));
+    EXPECT_EQ(airplane.getFuelConsumption(), static_cast<unsigned int>(300));
+
+    PerformanceTable otherTable;
+    EXPECT_DEATH(database.resolve("Boeing 747", AirplaneEnums::kSize_Large, AirplaneEnums::kEngine_Jet, otherTable), "AircraftDatabase can only resolve against one PerformanceTable.");
+}
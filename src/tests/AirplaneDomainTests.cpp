@@ -313,4 +313,33 @@ TEST_F(AirplaneDomainTests, fuelConsumption) {
     Airplane largeJet = Airplane(airplaneNumber, airplaneCallsign, airplaneModel, airplaneSquawk, airplaneAltitude, fuelCapacity, fuelCapacity, passengerCapacity, passengerCapacity,
                                   airplaneStatus, airplaneType, large, jet);
     EXPECT_EQ(largeJet.getFuelConsumption(), static_cast<unsigned int>(250));
-}
\ No newline at end of file
+}
+TEST_F(AirplaneDomainTests, squawkAllocator) {
+    SquawkAllocator squawks;
+    EXPECT_DEATH(squawks.take(0), "Squawk block does not exist.");
+
+    // held codes are skipped, every block keeps its own position
+    squawks.hold(02001);
+    EXPECT_EQ(squawks.take(02000), 02000u);
+    EXPECT_EQ(squawks.take(02000), 02002u);
+    EXPECT_EQ(squawks.take(03000), 03000u);
+    EXPECT_TRUE(squawks.isHeld(02002));
+
+    // a released code is handed out again once the block wraps around
+    squawks.release(02000);
+    EXPECT_FALSE(squawks.isHeld(02000));
+    for (unsigned int i = 02003; i < 03000; i++) {
+        EXPECT_EQ(squawks.take(02000), i);
+    }
+    EXPECT_EQ(squawks.take(02000), 02000u);
+
+    // the block of small private airplanes stops before the next block
+    for (unsigned int i = 01; i < 01000; i++) {
+        EXPECT_EQ(squawks.take(01), i);
+    }
+    EXPECT_EQ(squawks.take(01), 01u);
+
+    squawks.clear();
+    EXPECT_FALSE(squawks.isHeld(02001));
+    EXPECT_EQ(squawks.take(02000), 02000u);
+}
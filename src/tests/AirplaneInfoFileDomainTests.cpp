@@ -0,0 +1,100 @@
+#include "../classes/Airport.h"
+#include "../classes/AirplaneInfoFile.h"
+#include "../parser/Parser.h"
+#include "../utils/Utils.h"
+
+#include <gtest/gtest.h>
+
+class AirplaneInfoFileDomainTests: public ::testing::Test {
+protected:
+    friend class AirplaneInfoWriter;
+    friend class AirplaneInfoReader;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(AirplaneInfoFileDomainTests, randomAccess) {
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/2/input.xml");
+    ASSERT_EQ(pairResult.first, ParseEnum::kSuccess);
+    Airport* airport = pairResult.second.begin()->second;
+    const std::string airplanePath = "./outputTests/2/" + airport->getIata() + "/airplanes/";
+
+    std::ostringstream file;
+    AirplaneInfoWriter writer(file);
+    for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
+        writer.add(it_airplane->second);
+    }
+    writer.close();
+    EXPECT_TRUE(writer.isClosed());
+    EXPECT_DEATH(writer.add(airport->getAirplanes().begin()->second), "AirplaneInfoWriter is already closed.");
+
+    std::istringstream stream(file.str());
+    AirplaneInfoReader reader(stream);
+    ASSERT_TRUE(reader.isValid());
+    EXPECT_EQ(reader.getCount(), airport->getAirplanes().size());
+
+    // read back to front, every record has to match the golden file of the separate layout
+    std::vector<std::string> numbers = reader.getNumbers();
+    ASSERT_EQ(numbers.size(), airport->getAirplanes().size());
+    for (std::vector<std::string>::reverse_iterator it_number = numbers.rbegin(); it_number != numbers.rend(); it_number++) {
+        std::string record;
+        ASSERT_TRUE(reader.read(*it_number, record));
+        EXPECT_TRUE(CompareWithFile(airplanePath + "expected_" + *it_number + ".txt", record));
+    }
+
+    std::string record;
+    EXPECT_FALSE(reader.read("unknown", record));
+
+    delete airport;
+}
+
+TEST_F(AirplaneInfoFileDomainTests, invalidFiles) {
+    std::istringstream empty("");
+    AirplaneInfoReader emptyReader(empty);
+    EXPECT_FALSE(emptyReader.isValid());
+    EXPECT_EQ(emptyReader.getCount(), static_cast<unsigned long>(0));
+
+    std::istringstream truncated("airplanes 1\n0 10 N1\nindex 00000000000000000000\n");
+    AirplaneInfoReader truncatedReader(truncated);
+    EXPECT_FALSE(truncatedReader.isValid());
+
+    std::ostringstream file;
+    {
+        AirplaneInfoWriter writer(file);
+    }
+    // the registration is not validated by the parser, whitespace in it must not shift the other fields
+    std::ostringstream spacedFile;
+    Airplane spaced("N 12 3", "Dummy Airplane", "Dummy", 01, 10000, 10000, 10000, 4, 4, AirplaneEnums::kStatus_Approaching, AirplaneEnums::kType_Private, AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Propeller);
+    Airplane plain("N100", "Dummy Airplane", "Dummy", 01, 10000, 10000, 10000, 4, 4, AirplaneEnums::kStatus_Approaching, AirplaneEnums::kType_Private, AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Propeller);
+    {
+        AirplaneInfoWriter writer(spacedFile);
+        writer.add(&spaced);
+        writer.add(&plain);
+    }
+    std::istringstream spacedStream(spacedFile.str());
+    AirplaneInfoReader spacedReader(spacedStream);
+    ASSERT_TRUE(spacedReader.isValid());
+    EXPECT_EQ(spacedReader.getCount(), static_cast<unsigned long>(2));
+    std::string spacedRecord;
+    std::ostringstream expectedRecord;
+    ASSERT_TRUE(spacedReader.read("N 12 3", spacedRecord));
+    spaced.printInfo(expectedRecord);
+    EXPECT_EQ(spacedRecord, expectedRecord.str());
+    ASSERT_TRUE(spacedReader.read("N100", spacedRecord));
+    expectedRecord.str("");
+    plain.printInfo(expectedRecord);
+    EXPECT_EQ(spacedRecord, expectedRecord.str());
+
+    std::istringstream noAirplanes(file.str());
+    AirplaneInfoReader reader(noAirplanes);
+    EXPECT_TRUE(reader.isValid());
+    EXPECT_EQ(reader.getCount(), static_cast<unsigned long>(0));
+}
@@ -0,0 +1,97 @@
+#include "../classes/Airplane.h"
+#include "../classes/AirplaneRegistry.h"
+
+#include <gtest/gtest.h>
+#include <sstream>
+
+class AirplaneRegistryDomainTests: public ::testing::Test {
+protected:
+    friend class AirplaneRegistry;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(AirplaneRegistryDomainTests, insertAndLookup) {
+    AirplaneRegistry registry;
+
+    EXPECT_TRUE(registry.empty());
+    EXPECT_EQ(registry.find("N123"), AirplaneRegistry::kInvalidHandle);
+    EXPECT_EQ(registry.lookup("N123"), static_cast<Airplane*>(NULL));
+    EXPECT_DEATH(registry.insert(NULL), "Referenced Airplane is a nullpointer.");
+
+    Airplane* airplaneA = new Airplane("N123", "Dummy Airplane", "Dummy", 01, 10000, 10000, 10000, 4, 4, AirplaneEnums::kStatus_Approaching, AirplaneEnums::kType_Private, AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Propeller);
+    Airplane* airplaneB = new Airplane("N100", "Dummy Airplane", "Dummy", 01, 10000, 10000, 10000, 4, 4, AirplaneEnums::kStatus_Approaching, AirplaneEnums::kType_Private, AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Propeller);
+    Airplane* airplaneDuplicate = new Airplane("N123", "Dummy Airplane", "Dummy", 01, 10000, 10000, 10000, 4, 4, AirplaneEnums::kStatus_Approaching, AirplaneEnums::kType_Private, AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Propeller);
+
+    AirplaneRegistry::Handle handleA = registry.insert(airplaneA);
+    AirplaneRegistry::Handle handleB = registry.insert(airplaneB);
+
+    EXPECT_DEATH(registry.insert(airplaneDuplicate), "Found Airplanes with duplicate registration.");
+
+    EXPECT_EQ(registry.size(), static_cast<unsigned long>(2));
+    EXPECT_EQ(registry.find("N123"), handleA);
+    EXPECT_EQ(registry.find("N100"), handleB);
+    EXPECT_EQ(registry.get(handleA), airplaneA);
+    EXPECT_EQ(registry.lookup("N100"), airplaneB);
+    EXPECT_TRUE(registry.contains(airplaneA));
+    EXPECT_FALSE(registry.contains(airplaneDuplicate));
+
+    EXPECT_EQ(registry.getOrdered().begin()->second, airplaneB);
+
+    EXPECT_TRUE(registry.remove("N123"));
+    EXPECT_FALSE(registry.remove("N123"));
+    EXPECT_EQ(registry.get(handleA), static_cast<Airplane*>(NULL));
+    EXPECT_EQ(registry.find("N100"), handleB);
+    EXPECT_EQ(registry.size(), static_cast<unsigned long>(1));
+
+    AirplaneRegistry::Handle handleDuplicate = registry.insert(airplaneDuplicate);
+    EXPECT_EQ(handleDuplicate, handleA);
+    EXPECT_EQ(registry.lookup("N123"), airplaneDuplicate);
+    EXPECT_EQ(registry.getHandleCount(), static_cast<unsigned long>(2));
+    EXPECT_EQ(registry.getOrdered().size(), static_cast<unsigned long>(2));
+    EXPECT_EQ(registry.getOrdered().rbegin()->second, airplaneDuplicate);
+
+    delete airplaneA;
+    delete airplaneB;
+    delete airplaneDuplicate;
+}
+
+TEST_F(AirplaneRegistryDomainTests, growth) {
+    AirplaneRegistry registry;
+    AirplaneVector airplanes;
+
+    for (unsigned int i = 0; i < 1000; i++) {
+        std::ostringstream number;
+        number << 'N' << i;
+        airplanes.push_back(new Airplane(number.str(), "Dummy Airplane", "Dummy", 01, 10000, 10000, 10000, 4, 4, AirplaneEnums::kStatus_Approaching, AirplaneEnums::kType_Private, AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Propeller));
+        EXPECT_EQ(registry.insert(airplanes.back()), static_cast<AirplaneRegistry::Handle>(i));
+    }
+
+    for (unsigned int i = 0; i < 1000; i += 2) {
+        EXPECT_TRUE(registry.remove(airplanes[i]->getNumber()));
+    }
+
+    EXPECT_EQ(registry.size(), static_cast<unsigned long>(500));
+    EXPECT_EQ(registry.getOrdered().size(), static_cast<unsigned long>(500));
+
+    for (unsigned int i = 0; i < 1000; i++) {
+        EXPECT_EQ(registry.lookup(airplanes[i]->getNumber()), (i % 2 == 0 ? static_cast<Airplane*>(NULL) : airplanes[i]));
+    }
+
+    // the removed Airplanes free their handles, inserting them again does not grow the handles
+    for (unsigned int i = 0; i < 1000; i += 2) {
+        EXPECT_LT(registry.insert(airplanes[i]), static_cast<AirplaneRegistry::Handle>(1000));
+    }
+    EXPECT_EQ(registry.getHandleCount(), static_cast<unsigned long>(1000));
+    EXPECT_EQ(registry.getOrdered().size(), static_cast<unsigned long>(1000));
+
+    for (unsigned int i = 0; i < 1000; i++) {
+        delete airplanes[i];
+    }
+}
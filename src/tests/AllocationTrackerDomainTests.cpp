@@ -0,0 +1,84 @@
+#include "../classes/Airport.h"
+#include "../classes/Simulator.h"
+#include "../classes/AllocationTracker.h"
+#include "../parser/Parser.h"
+
+#include <gtest/gtest.h>
+
+class AllocationTrackerDomainTests: public ::testing::Test {
+protected:
+    friend class AllocationTracker;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(AllocationTrackerDomainTests, counting) {
+    EXPECT_TRUE(AllocationTracker::getActive() == NULL);
+
+    int* volatile value = NULL;
+    {
+        AllocationTracker tracker;
+        EXPECT_TRUE(AllocationTracker::getActive() == &tracker);
+
+        tracker.setPhase(ProfileEnums::kPhase_Dispatch);
+        value = new int(1);
+        delete value;
+        tracker.endTick();
+
+        tracker.clearPhase();
+        value = new int[4];
+        delete[] value;
+
+        EXPECT_EQ(tracker.getAllocations(ProfileEnums::kPhase_Dispatch), static_cast<unsigned long>(1));
+        EXPECT_EQ(tracker.getBytes(ProfileEnums::kPhase_Dispatch), static_cast<unsigned long long>(sizeof(int)));
+        EXPECT_EQ(tracker.getOtherAllocations(), static_cast<unsigned long>(1));
+        EXPECT_EQ(tracker.getFrees(), static_cast<unsigned long>(2));
+        ASSERT_EQ(tracker.getTickAllocations().size(), static_cast<unsigned long>(1));
+        EXPECT_EQ(tracker.getTickAllocations()[0], static_cast<unsigned long>(1));
+
+        std::ostringstream report;
+        tracker.report(report);
+        EXPECT_NE(report.str().find("Dispatch"), std::string::npos);
+        EXPECT_NE(report.str().find("call site"), std::string::npos);
+
+        EXPECT_DEATH(AllocationTracker second, "Only one AllocationTracker can be active per thread.");
+    }
+
+    EXPECT_TRUE(AllocationTracker::getActive() == NULL);
+}
+
+TEST_F(AllocationTrackerDomainTests, trackedSimulation) {
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/1/input.xml");
+    ASSERT_EQ(pairResult.first, ParseEnum::kSuccess);
+    Airport* airport = pairResult.second.begin()->second;
+
+    std::ostringstream plainOutput, plainError, plainTower, plainFloorplan;
+    Simulator plainSimulator(airport, plainOutput, plainError, plainTower, plainFloorplan);
+    plainSimulator.Simulate();
+
+    SimulationProfile profile;
+    std::ostringstream trackedOutput, trackedError, trackedTower, trackedFloorplan;
+    {
+        AllocationTracker tracker(false);
+        Simulator trackedSimulator(airport, trackedOutput, trackedError, trackedTower, trackedFloorplan);
+        trackedSimulator.setAllocationTracker(&tracker);
+        trackedSimulator.setProfile(&profile);
+        trackedSimulator.Simulate();
+
+        EXPECT_EQ(tracker.getTickAllocations().size(), profile.getTicks());
+        EXPECT_GT(tracker.getOtherAllocations(), static_cast<unsigned long>(0));
+    }
+
+    EXPECT_EQ(trackedOutput.str(), plainOutput.str());
+    EXPECT_EQ(trackedTower.str(), plainTower.str());
+
+    delete airport;
+}
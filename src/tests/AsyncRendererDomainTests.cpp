@@ -0,0 +1,62 @@
+#include "../classes/Airport.h"
+#include "../classes/Simulator.h"
+#include "../classes/EventRenderer.h"
+#include "../classes/AsyncRenderer.h"
+#include "../parser/Parser.h"
+
+#include <gtest/gtest.h>
+
+class AsyncRendererDomainTests: public ::testing::Test {
+protected:
+    friend class AsyncRenderer;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(AsyncRendererDomainTests, matchesSynchronousOutput) {
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/2/input.xml");
+    ASSERT_EQ(pairResult.first, ParseEnum::kSuccess);
+    Airport* airport = pairResult.second.begin()->second;
+
+    std::ostringstream syncOutput, syncError, syncTower, syncFloorplan;
+    Simulator syncSimulator(airport, syncOutput, syncError, syncTower, syncFloorplan);
+    syncSimulator.Simulate();
+
+    std::ostringstream asyncOutput, asyncError, asyncTower;
+    Simulator asyncSimulator(airport, asyncError);
+
+    OutputRenderer outputRenderer(asyncSimulator.getAirport(), asyncOutput);
+    TowerRenderer towerRenderer(asyncSimulator.getAirport(), asyncTower);
+
+    // a tiny ring makes the Simulator thread wait on the writer thread
+    AsyncRenderer asyncOutputRenderer(&outputRenderer, 4);
+    AsyncRenderer asyncTowerRenderer(&towerRenderer, 4);
+    EXPECT_TRUE(asyncOutputRenderer.isRunning());
+
+    asyncSimulator.addRenderer(&asyncOutputRenderer);
+    asyncSimulator.addRenderer(&asyncTowerRenderer);
+    asyncSimulator.Simulate();
+
+    EXPECT_EQ(asyncOutput.str(), syncOutput.str());
+    EXPECT_EQ(asyncTower.str(), syncTower.str());
+    EXPECT_TRUE(asyncSimulator.getEventLog().empty());
+
+    delete airport;
+}
+
+TEST_F(AsyncRendererDomainTests, capacity) {
+    Airport airport = Airport("Antwerp International Airport", "ANR", "Antwerp Tower", 4);
+    std::ostringstream stream;
+    OutputRenderer outputRenderer(&airport, stream);
+
+    EXPECT_DEATH(AsyncRenderer(&outputRenderer, 3), "Ring capacity must be a power of two.");
+    EXPECT_DEATH(AsyncRenderer(NULL), "Referenced EventRenderer is a nullpointer.");
+}
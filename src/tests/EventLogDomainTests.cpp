@@ -0,0 +1,78 @@
+#include "../classes/Airport.h"
+#include "../classes/Simulator.h"
+#include "../classes/SimulationEvent.h"
+#include "../classes/EventRenderer.h"
+#include "../parser/Parser.h"
+
+#include <gtest/gtest.h>
+
+class EventLogDomainTests: public ::testing::Test {
+protected:
+    friend class EventLog;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(EventLogDomainTests, appendAndClear) {
+    EventLog log;
+    EXPECT_TRUE(log.empty());
+
+    SimulationEvent event;
+    event.type = EventEnums::kEvent_TickEnd;
+    event.timer = 3;
+    event.airplane = NULL;
+    event.location = NULL;
+    event.via = NULL;
+    event.value = 0;
+    event.gate = 0;
+
+    log.append(event);
+    EXPECT_EQ(log.size(), static_cast<unsigned long>(1));
+    EXPECT_EQ(log.at(0).timer, static_cast<unsigned int>(3));
+    EXPECT_DEATH(log.at(1), "Event index is out of range.");
+    EXPECT_STREQ(EventEnums::EnumToString(log.at(0).type), "TickEnd");
+
+    log.clear();
+    EXPECT_TRUE(log.empty());
+}
+
+TEST_F(EventLogDomainTests, deferredRendering) {
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/1/input.xml");
+    ASSERT_EQ(pairResult.first, ParseEnum::kSuccess);
+    Airport* airport = pairResult.second.begin()->second;
+
+    std::ostringstream liveOutput, liveError, liveTower, liveFloorplan;
+    Simulator liveSimulator(airport, liveOutput, liveError, liveTower, liveFloorplan);
+    liveSimulator.Simulate();
+    EXPECT_TRUE(liveSimulator.getEventLog().empty());
+
+    std::ostringstream deferredError;
+    Simulator deferredSimulator(airport, deferredError);
+    deferredSimulator.Simulate();
+    EXPECT_FALSE(deferredSimulator.getEventLog().empty());
+
+    std::ostringstream deferredOutput, deferredTower;
+    OutputRenderer outputRenderer(deferredSimulator.getAirport(), deferredOutput);
+    TowerRenderer towerRenderer(deferredSimulator.getAirport(), deferredTower);
+    outputRenderer.renderLog(deferredSimulator.getEventLog());
+    towerRenderer.renderLog(deferredSimulator.getEventLog());
+
+    EXPECT_EQ(deferredOutput.str(), liveOutput.str());
+    EXPECT_EQ(deferredTower.str(), liveTower.str());
+
+    std::ostringstream silentError;
+    Simulator silentSimulator(airport, silentError);
+    silentSimulator.setRecordEvents(false);
+    silentSimulator.Simulate();
+    EXPECT_TRUE(silentSimulator.getEventLog().empty());
+
+    delete airport;
+}
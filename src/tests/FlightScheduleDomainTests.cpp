@@ -0,0 +1,249 @@
+#include "../classes/Airport.h"
+#include "../classes/Simulator.h"
+#include "../parser/FlightSchedule.h"
+#include "../utils/ScenarioInput.h"
+
+#include <gtest/gtest.h>
+#include <set>
+
+class FlightScheduleDomainTests: public ::testing::Test {
+protected:
+    friend class FlightSchedule;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+namespace {
+    /**
+     * A schedule entry of a medium airline propeller, the times are left out when they are empty
+     */
+    std::string entry(const std::string& number, const std::string& status, const std::string& arrival, const std::string& departure, const std::string& airport = "") {
+        std::ostringstream stream;
+        stream << "<AIRPLANE>\n"
+               << "    <number>" << number << "</number>\n"
+               << "    <callsign>Scheduled " << number << "</callsign>\n"
+               << "    <model>Cessna 340</model>\n"
+               << "    <fuel>50000</fuel>\n"
+               << "    <passengers>100</passengers>\n"
+               << "    <status>" << status << "</status>\n"
+               << "    <type>airline</type>\n"
+               << "    <size>medium</size>\n"
+               << "    <engine>propeller</engine>\n";
+        if (!arrival.empty()) stream << "    <arrival>" << arrival << "</arrival>\n";
+        if (!departure.empty()) stream << "    <departure>" << departure << "</departure>\n";
+        if (!airport.empty()) stream << "    <airport>" << airport << "</airport>\n";
+        stream << "</AIRPLANE>\n";
+        return stream.str();
+    }
+
+    /**
+     * Simulates the Airport with the schedule and returns the output and tower renders
+     */
+    std::string simulate(const Airport* airport, const std::string& text, const bool retire, unsigned long& retiredCount, unsigned int& ticks) {
+        std::istringstream scheduleStream(text);
+        std::ostringstream outputStream;
+        std::ostringstream errorStream;
+        std::ostringstream towerStream;
+        std::ostringstream floorplanStream;
+
+        FlightSchedule schedule(scheduleStream, errorStream);
+        Simulator simulator(airport, outputStream, errorStream, towerStream, floorplanStream);
+        simulator.setSchedule(&schedule);
+        simulator.setRetireAirplanes(retire);
+        simulator.Simulate();
+
+        retiredCount = simulator.getRetiredCount();
+        ticks = simulator.getTimer();
+        return outputStream.str() + towerStream.str();
+    }
+}
+
+TEST_F(FlightScheduleDomainTests, reading) {
+    const std::string text = entry("S1", "Approaching", "5", "") +
+                             entry("S2", "Approaching", "", "") +
+                             entry("S3", "Approaching", "3", "") +
+                             entry("S4", "StandingAtGate", "", "20", "XXX") +
+                             entry("S5", "StandingAtGate", "8", "6") +
+                             entry("S6", "StandingAtGate", "", "20", "ANR") +
+                             entry("S7", "StandingAtGate", "21", "") +
+                             "<AIRPLANE>\n    <number>S8</number>\n";
+    std::istringstream stream(text);
+    std::ostringstream errorStream;
+    FlightSchedule schedule(stream, errorStream, "ANR");
+
+    // nothing is read before the first entry is asked for, then only up to that entry
+    EXPECT_FALSE(schedule.isPrimed());
+    EXPECT_EQ(stream.tellg(), static_cast<std::streampos>(0));
+    ASSERT_FALSE(schedule.isExhausted());
+    EXPECT_LT(stream.tellg(), static_cast<std::streampos>(text.size() / 4));
+    EXPECT_DEATH(schedule.setPerformanceTable(&PerformanceTable::getDefault()), "FlightSchedule was already read from.");
+
+    EXPECT_EQ(schedule.getNextTime(), 5u);
+    Airplane* first = schedule.takeNext();
+    EXPECT_EQ(first->getNumber(), "S1");
+    EXPECT_EQ(first->getDepartureTime(), 0u);
+    EXPECT_TRUE(first->getAirport() == NULL);
+    delete first;
+
+    // missing arrival, out of order, other airport and departure before arrival are all skipped
+    ASSERT_FALSE(schedule.isExhausted());
+    EXPECT_EQ(schedule.getNextTime(), 20u);
+    Airplane* second = schedule.takeNext();
+    EXPECT_EQ(second->getNumber(), "S6");
+    EXPECT_EQ(second->getStatus(), AirplaneEnums::kStatus_StandingAtGate);
+    EXPECT_EQ(second->getDepartureTime(), 20u);
+    delete second;
+
+    // a missing departure and the unterminated last entry
+    EXPECT_TRUE(schedule.isExhausted());
+    EXPECT_EQ(schedule.getTaken(), 2u);
+    EXPECT_EQ(schedule.getRejected(), 5u);
+    EXPECT_EQ(schedule.getResult(), ParseEnum::kPartial);
+    EXPECT_NE(errorStream.str().find("'arrival' required attribute is missing."), std::string::npos);
+    EXPECT_NE(errorStream.str().find("the schedule must be in time order."), std::string::npos);
+    EXPECT_NE(errorStream.str().find("'departure' is before 'arrival'."), std::string::npos);
+    EXPECT_NE(errorStream.str().find("Schedule entry at line 13 was rejected"), std::string::npos);
+    EXPECT_NE(errorStream.str().find("the schedule ends inside an entry."), std::string::npos);
+    EXPECT_DEATH(schedule.takeNext(), "FlightSchedule is exhausted.");
+    EXPECT_DEATH(schedule.getNextTime(), "FlightSchedule is exhausted.");
+
+    std::istringstream empty("");
+    FlightSchedule none(empty, errorStream);
+    EXPECT_TRUE(none.isExhausted());
+    EXPECT_EQ(none.getResult(), ParseEnum::kSuccess);
+}
+
+TEST_F(FlightScheduleDomainTests, simulation) {
+    ScenarioInput input;
+    ASSERT_EQ(input.load("./outputTests/2/", std::cerr), ParseEnum::kSuccess);
+    Airport airport(input.getAirports().begin()->second);
+    airport.setGateCount(airport.getGateCount() + 1);
+    const unsigned long parsed = airport.getAirplanes().size();
+
+    const std::string text = entry("S1", "StandingAtGate", "0", "60") +
+                             entry("S2", "Approaching", "10", "") +
+                             entry("S3", "StandingAtGate", "", "30") +
+                             entry("N11200", "Approaching", "40", "");
+    std::istringstream stream(text);
+    std::ostringstream errorStream;
+    FlightSchedule schedule(stream, errorStream);
+    Simulator simulator(&airport, errorStream);
+    simulator.setRecordEvents(false);
+    simulator.setSchedule(&schedule);
+
+    // the entries of tick 0 are placed with the parsed airplanes, the free gate is taken
+    simulator.runUntilTime(10);
+    const Airplane* standing = simulator.getAirport()->getAirplanesByRegistrationNumber("S1");
+    ASSERT_TRUE(standing != NULL);
+    EXPECT_NE(standing->getGate(), -1);
+    EXPECT_EQ(standing->getSquawk() / 01000 * 01000, 02000u);
+    EXPECT_TRUE(simulator.getAirport()->getAirplanesByRegistrationNumber("S2") == NULL);
+    simulator.step();
+    const Airplane* arriving = simulator.getAirport()->getAirplanesByRegistrationNumber("S2");
+    ASSERT_TRUE(arriving != NULL);
+    EXPECT_NE(arriving->getSquawk(), standing->getSquawk());
+
+    // the departure time holds the clearance request
+    simulator.runUntilTime(60);
+    EXPECT_EQ(standing->getStatus(), AirplaneEnums::kStatus_StandingAtGate);
+    EXPECT_EQ(standing->getCommunicationTimer(), 0u);
+
+    // the airplanes of the schedule keep the simulation going, the duplicate registration is rejected
+    simulator.Simulate();
+    EXPECT_TRUE(schedule.isExhausted());
+    EXPECT_TRUE(simulator.SimulationFinished());
+    EXPECT_EQ(simulator.getAirport()->getAirplanes().size(), parsed + 3);
+    EXPECT_NE(errorStream.str().find("Scheduled airplane is already at the airport"), std::string::npos);
+    for (AirplaneMap::const_iterator it_airplane = simulator.getAirport()->getAirplanes().begin(); it_airplane != simulator.getAirport()->getAirplanes().end(); it_airplane++) {
+        EXPECT_TRUE(it_airplane->second->getStatus() == AirplaneEnums::kStatus_LeftAirport || it_airplane->second->getStatus() == AirplaneEnums::kStatus_Crashed);
+    }
+    EXPECT_EQ(simulator.getRetiredCount(), 0u);
+}
+
+TEST_F(FlightScheduleDomainTests, retirement) {
+    ScenarioInput input;
+    ASSERT_EQ(input.load("./outputTests/2/", std::cerr), ParseEnum::kSuccess);
+    const Airport* airport = input.getAirports().begin()->second;
+
+    std::string text;
+    for (unsigned int i = 0; i < 12; i++) {
+        std::ostringstream number;
+        number << "S" << i;
+        text += entry(number.str(), (i % 3 == 0 ? "StandingAtGate" : "Approaching"), "", "");
+        std::ostringstream time;
+        time << i * 15;
+        text.insert(text.rfind("</AIRPLANE>"), (i % 3 == 0 ? "    <departure>" + time.str() + "</departure>\n" : "    <arrival>" + time.str() + "</arrival>\n"));
+    }
+
+    // retiring changes nothing about the simulation, the renderers see every airplane before it is deleted
+    unsigned long kept = 0;
+    unsigned int keptTicks = 0;
+    const std::string expected = simulate(airport, text, false, kept, keptTicks);
+    unsigned long retiredCount = 0;
+    unsigned int ticks = 0;
+    EXPECT_EQ(simulate(airport, text, true, retiredCount, ticks), expected);
+    EXPECT_EQ(kept, 0u);
+    EXPECT_EQ(ticks, keptTicks);
+    EXPECT_EQ(retiredCount, airport->getAirplanes().size() + 12);
+
+    // retired airplanes are no longer at the airport while the simulation runs
+    std::istringstream stream(text);
+    std::ostringstream errorStream;
+    FlightSchedule schedule(stream, errorStream);
+    Simulator simulator(airport, errorStream);
+    simulator.setRecordEvents(false);
+    simulator.setSchedule(&schedule);
+    simulator.setRetireAirplanes(true);
+    unsigned long highest = 0;
+    while (!simulator.isStopped()) {
+        simulator.step();
+        highest = std::max(highest, static_cast<unsigned long>(simulator.getAirport()->getAirplanes().size()));
+        EXPECT_LE(simulator.getAirport()->getAirplanes().size() + simulator.getRetiredCount(), airport->getAirplanes().size() + schedule.getTaken());
+    }
+    EXPECT_LT(highest, airport->getAirplanes().size() + 12);
+    EXPECT_TRUE(simulator.getAirport()->getAirplanes().empty());
+    EXPECT_EQ(simulator.getRetiredCount(), airport->getAirplanes().size() + 12);
+}
+
+TEST_F(FlightScheduleDomainTests, squawks) {
+    ScenarioInput input;
+    ASSERT_EQ(input.load("./outputTests/2/", std::cerr), ParseEnum::kSuccess);
+    Airport airport(input.getAirports().begin()->second);
+    ASSERT_FALSE(airport.getAirplanes().empty());
+    // a parsed airplane holds a code of the block the scheduled airplanes draw from
+    airport.getAirplanes().begin()->second->setSquawk(02000 + airport.getAirplanes().size());
+
+    std::string text;
+    for (unsigned int i = 0; i < 12; i++) {
+        std::ostringstream number;
+        number << "S" << i;
+        std::ostringstream time;
+        time << i * 5;
+        text += entry(number.str(), "Approaching", time.str(), "");
+    }
+    std::istringstream stream(text);
+    std::ostringstream errorStream;
+    FlightSchedule schedule(stream, errorStream);
+    Simulator simulator(&airport, errorStream);
+    simulator.setRecordEvents(false);
+    simulator.setSchedule(&schedule);
+
+    // no two airplanes that have not left or crashed hold the same code
+    while (!simulator.isStopped()) {
+        simulator.step();
+        std::set<unsigned int> squawks;
+        for (AirplaneMap::const_iterator it_airplane = simulator.getAirport()->getAirplanes().begin(); it_airplane != simulator.getAirport()->getAirplanes().end(); it_airplane++) {
+            const Airplane* airplane = it_airplane->second;
+            if (airplane->getStatus() == AirplaneEnums::kStatus_LeftAirport || airplane->getStatus() == AirplaneEnums::kStatus_Crashed) continue;
+            EXPECT_TRUE(squawks.insert(airplane->getAssignedSquawk()).second);
+        }
+    }
+    EXPECT_EQ(simulator.getAirport()->getAirplanesByRegistrationNumber("S0")->getAssignedSquawk() / 01000 * 01000, 02000u);
+    EXPECT_TRUE(schedule.isExhausted());
+}
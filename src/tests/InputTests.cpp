@@ -107,4 +107,69 @@ TEST_F(InputTests, success) {
     } else {
         EXPECT_TRUE(false);
     }
-}
\ No newline at end of file
+}
+
+TEST_F(InputTests, performance) {
+    std::string path = "./inputTests/Performance/";
+
+    if (DirectoryExists(path)) {
+        EXPECT_TRUE(FileExists(path + "test.xml"));
+        EXPECT_TRUE(FileExists(path + "expected.txt"));
+        std::ofstream parserOutputStream;
+        std::string paserOutputName = path + "output.txt";
+
+        parserOutputStream.open(paserOutputName.c_str());
+
+        Parser parser = Parser(parserOutputStream);
+        PerformanceTable table;
+
+        std::string completefilename = path + "test.xml";
+        EXPECT_EQ(parser.parsePerformanceFile(completefilename.c_str(), table), ParseEnum::kPartial);
+
+        parserOutputStream.close();
+
+        EXPECT_TRUE(FileCompare(path + "expected.txt", path + "output.txt"));
+
+        EXPECT_EQ(table.getActionTime(AirplaneEnums::kStatus_Boarding, AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Propeller), static_cast<unsigned int>(20));
+        EXPECT_EQ(table.getActionTime(AirplaneEnums::kStatus_Boarding, AirplaneEnums::kSize_Large, AirplaneEnums::kEngine_Jet), static_cast<unsigned int>(20));
+        EXPECT_EQ(table.getActionTime(AirplaneEnums::kStatus_TakingOff, AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Jet), static_cast<unsigned int>(4));
+        EXPECT_EQ(table.getActionTime(AirplaneEnums::kStatus_TakingOff, AirplaneEnums::kSize_Medium, AirplaneEnums::kEngine_Jet), static_cast<unsigned int>(2));
+        EXPECT_EQ(table.getFuelConsumption(AirplaneEnums::kSize_Large, AirplaneEnums::kEngine_Propeller), static_cast<unsigned int>(300));
+        EXPECT_EQ(table.getFuelConsumption(AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Jet), static_cast<unsigned int>(25));
+        EXPECT_EQ(table.getRefuelRate(), static_cast<unsigned int>(5000));
+    } else {
+        EXPECT_TRUE(false);
+    }
+}
+
+TEST_F(InputTests, aircraft) {
+    std::string path = "./inputTests/Aircraft/";
+
+    if (DirectoryExists(path)) {
+        EXPECT_TRUE(FileExists(path + "test.xml"));
+        EXPECT_TRUE(FileExists(path + "expected.txt"));
+        std::ofstream parserOutputStream;
+        std::string paserOutputName = path + "output.txt";
+
+        parserOutputStream.open(paserOutputName.c_str());
+
+        Parser parser = Parser(parserOutputStream);
+        AircraftDatabase database;
+
+        std::string completefilename = path + "test.xml";
+        EXPECT_EQ(parser.parseAircraftFile(completefilename.c_str(), database), ParseEnum::kPartial);
+
+        parserOutputStream.close();
+
+        EXPECT_TRUE(FileCompare(path + "expected.txt", path + "output.txt"));
+
+        EXPECT_EQ(database.size(), static_cast<unsigned long>(2));
+        EXPECT_FALSE(database.hasModel("Airbus A320"));
+        EXPECT_EQ(database.getSpec("Boeing 747").climbRate, static_cast<unsigned int>(500));
+        EXPECT_EQ(database.getSpec("Boeing 747").pushbackTime, static_cast<unsigned int>(4));
+        EXPECT_EQ(database.getSpec("Cessna 172").fuelConsumption, static_cast<unsigned int>(8));
+        EXPECT_EQ(database.getSpec("Cessna 172").descentRate, static_cast<unsigned int>(0));
+    } else {
+        EXPECT_TRUE(false);
+    }
+}
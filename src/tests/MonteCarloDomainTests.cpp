@@ -0,0 +1,109 @@
+#include "../classes/Airport.h"
+#include "../classes/Simulator.h"
+#include "../classes/TimingPerturbation.h"
+#include "../utils/MonteCarlo.h"
+#include "../utils/ScenarioInput.h"
+
+#include <gtest/gtest.h>
+
+class MonteCarloDomainTests: public ::testing::Test {
+protected:
+    friend class TimingPerturbation;
+    friend class MonteCarloRunner;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(MonteCarloDomainTests, perturbation) {
+    EXPECT_DEATH(TimingPerturbation(1, -0.1), "Spread must be at least 0 and below 1.");
+    EXPECT_DEATH(TimingPerturbation(1, 1), "Spread must be at least 0 and below 1.");
+
+    ScenarioInput input;
+    ASSERT_EQ(input.load("./outputTests/2/", std::cerr), ParseEnum::kSuccess);
+    const Airplane* airplane = input.getAirports().begin()->second->getAirplanes().begin()->second;
+
+    TimingPerturbation none(7, 0);
+    TimingPerturbation perturbation(7, 0.25);
+    TimingPerturbation other(8, 0.25);
+    EXPECT_EQ(perturbation.getSeed(), 7u);
+    EXPECT_DOUBLE_EQ(perturbation.getSpread(), 0.25);
+
+    unsigned long total = 0;
+    unsigned int differences = 0;
+    for (unsigned int tick = 0; tick < 2000; tick++) {
+        EXPECT_EQ(none.perturbAction(airplane, 40, tick), 40u);
+        EXPECT_EQ(perturbation.perturbAction(airplane, 0, tick), 0u);
+        EXPECT_GE(perturbation.perturbAction(airplane, 1, tick), 1u);
+
+        // the same key gives the same draw, the result stays within the spread
+        const unsigned int ticks = perturbation.perturbAction(airplane, 40, tick);
+        EXPECT_EQ(perturbation.perturbAction(airplane, 40, tick), ticks);
+        EXPECT_GE(ticks, 30u);
+        EXPECT_LE(ticks, 50u);
+        total += ticks;
+
+        if (other.perturbAction(airplane, 40, tick) != ticks) differences++;
+        EXPECT_GE(perturbation.perturbFuel(airplane, 1, tick), 1u);
+    }
+    // the rounding keeps the mean
+    EXPECT_NEAR(total / 2000.0, 40.0, 0.5);
+    EXPECT_GT(differences, 1000u);
+
+    EXPECT_DEATH(perturbation.perturbAction(NULL, 1, 0), "Airplane can not be NULL.");
+    EXPECT_DEATH(perturbation.perturbFuel(NULL, 1, 0), "Airplane can not be NULL.");
+}
+
+TEST_F(MonteCarloDomainTests, replications) {
+    ScenarioInput input;
+    ASSERT_EQ(input.load("./outputTests/2/", std::cerr), ParseEnum::kSuccess);
+    const Airport* airport = input.getAirports().begin()->second;
+
+    // without spread a replication is the deterministic simulation
+    std::ostringstream errorStream;
+    Simulator simulator(airport, errorStream);
+    simulator.setRecordEvents(false);
+    simulator.Simulate();
+    const ReplicationResult deterministic = MonteCarloRunner::replicate(airport, 3, 0, 11520);
+    EXPECT_EQ(deterministic.ticks, simulator.getTimer() - 1);
+    EXPECT_TRUE(deterministic.finished);
+    EXPECT_EQ(deterministic.crashed + deterministic.left, airport->getAirplanes().size());
+
+    MonteCarloOptions options;
+    options.replications = 12;
+    options.seed = 40;
+    options.spread = 0.3;
+    options.threads = 3;
+    MonteCarloRunner runner(options);
+    const std::vector<ReplicationResult> results = runner.run(airport);
+    ASSERT_EQ(results.size(), 12u);
+
+    // every replication replays from its seed, whatever thread ran it
+    bool varies = false;
+    for (unsigned int i = 0; i < results.size(); i++) {
+        EXPECT_EQ(results[i].seed, 40u + i);
+        const ReplicationResult replay = MonteCarloRunner::replicate(airport, results[i].seed, options.spread, options.tickLimit);
+        EXPECT_EQ(replay.ticks, results[i].ticks);
+        EXPECT_EQ(replay.crashed, results[i].crashed);
+        EXPECT_DOUBLE_EQ(replay.holding, results[i].holding);
+        EXPECT_DOUBLE_EQ(replay.taxiWait, results[i].taxiWait);
+        EXPECT_DOUBLE_EQ(replay.gateTime, results[i].gateTime);
+        if (results[i].ticks != results[0].ticks || results[i].gateTime != results[0].gateTime) varies = true;
+    }
+    EXPECT_TRUE(varies);
+
+    std::ostringstream report;
+    MonteCarloRunner::report(results, report);
+    EXPECT_EQ(report.str().find("Monte Carlo over 12 replications, seeds 40 to 51"), static_cast<std::string::size_type>(0));
+    EXPECT_NE(report.str().find("taxi wait"), std::string::npos);
+
+    EXPECT_DEATH(MonteCarloRunner::report(std::vector<ReplicationResult>(), report), "There are no replications to report.");
+    options.replications = 0;
+    EXPECT_DEATH(MonteCarloRunner runner(options), "At least one replication is needed.");
+    EXPECT_DEATH(MonteCarloRunner::replicate(NULL, 1, 0, 10), "Airport can not be NULL.");
+}
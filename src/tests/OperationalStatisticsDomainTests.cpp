@@ -0,0 +1,78 @@
+#include "../classes/Airport.h"
+#include "../classes/Simulator.h"
+#include "../classes/OperationalStatistics.h"
+#include "../parser/Parser.h"
+
+#include <gtest/gtest.h>
+
+class OperationalStatisticsDomainTests: public ::testing::Test {
+protected:
+    friend class OperationalStatistics;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(OperationalStatisticsDomainTests, sampling) {
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/2/input.xml");
+    ASSERT_EQ(pairResult.first, ParseEnum::kSuccess);
+    Airport* airport = pairResult.second.begin()->second;
+
+    OperationalStatistics statistics;
+    EXPECT_DEATH(statistics.sample(NULL), "Airport can not be NULL.");
+
+    std::ostringstream errorStream;
+    Simulator simulator(airport, errorStream);
+    simulator.setStatistics(&statistics);
+    simulator.Simulate();
+
+    ASSERT_GT(statistics.getTicks(), static_cast<unsigned int>(0));
+    EXPECT_EQ(statistics.getTicks(), simulator.getTimer() - 1);
+
+    // every airplane is in exactly one status every minute
+    unsigned int airplaneGateTime = 0;
+    for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
+        const AirplaneStatistics* airplane = statistics.getAirplane(it_airplane->first);
+        ASSERT_TRUE(airplane != NULL);
+
+        unsigned int minutes = 0;
+        for (unsigned int status = 0; status < AirplaneEnums::kStatusCount; status++) minutes += airplane->statusTime[status];
+        EXPECT_EQ(minutes, statistics.getTicks());
+        EXPECT_EQ(airplane->getHoldingTime(), airplane->statusTime[AirplaneEnums::kStatus_FlyingWaitPattern]);
+        airplaneGateTime += airplane->gateTime;
+    }
+    EXPECT_TRUE(statistics.getAirplane("unknown") == NULL);
+
+    unsigned int gateTime = 0;
+    for (unsigned long gate = 0; gate < airport->getGateCount(); gate++) {
+        EXPECT_LE(statistics.getGateTime(gate), statistics.getTicks());
+        gateTime += statistics.getGateTime(gate);
+    }
+    EXPECT_EQ(gateTime, airplaneGateTime);
+    EXPECT_GT(gateTime, static_cast<unsigned int>(0));
+    EXPECT_EQ(statistics.getGateTime(airport->getGateCount()), static_cast<unsigned int>(0));
+
+    unsigned int runwayTime = 0;
+    for (RunwayMap::const_iterator it_runway = airport->getRunways().begin(); it_runway != airport->getRunways().end(); it_runway++) {
+        EXPECT_LE(statistics.getRunwayTime(it_runway->first), statistics.getTicks());
+        runwayTime += statistics.getRunwayTime(it_runway->first);
+    }
+    EXPECT_GT(runwayTime, static_cast<unsigned int>(0));
+    EXPECT_GT(statistics.get5000ftTime(), static_cast<unsigned int>(0));
+    EXPECT_LE(statistics.get3000ftTime(), statistics.getTicks());
+
+    std::ostringstream report;
+    statistics.report(report);
+    EXPECT_EQ(report.str().find("Operational statistics over "), static_cast<std::string::size_type>(0));
+    EXPECT_NE(report.str().find("slot 5000ft"), std::string::npos);
+    EXPECT_NE(report.str().find(airport->getAirplanes().begin()->first + ":"), std::string::npos);
+
+    delete airport;
+}
@@ -6,107 +6,143 @@
 #include "../parser/Parser.h"
 
 #include <gtest/gtest.h>
+#include <pthread.h>
+#include <unistd.h>
 
-class OutputTests: public ::testing::Test {
-protected:
-    friend class Airport;
+namespace {
+    struct FixtureRun {
+        std::string path;
+        std::vector<std::string> failures;
+    };
 
-    virtual void SetUp() {
-        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    struct FixtureQueue {
+        std::vector<FixtureRun>* runs;
+        unsigned long next;
     };
 
-    virtual void TearDown() {
+    /**
+     * Compares the output with the golden file, a mismatching output is written next to the golden file for inspection
+     */
+    void expectGolden(FixtureRun& run, const std::string& expectedName, const std::string& outputName, const std::string& contents) {
+        std::string difference;
+        if (CompareWithFile(expectedName, contents, &difference)) return;
 
-    };
-};
+        run.failures.push_back(expectedName + ": " + difference);
 
-TEST_F(OutputTests, outputs) {
-    std::string path = "./outputTests/";
-    std::vector<std::string> testNames = std::vector<std::string>();
-    testNames.push_back("1/");
-    testNames.push_back("2/");
+        std::ofstream outputStream(outputName.c_str());
+        outputStream << contents;
+    }
 
-    for (unsigned int i = 0; i < testNames.size(); i++) {
-        if (DirectoryExists(path + testNames[i])) {
-            EXPECT_TRUE(FileExists(path + testNames[i] + "input.xml"));
-            EXPECT_TRUE(FileExists(path + testNames[i] + "expected_parser.txt"));
+    void runFixture(FixtureRun& run) {
+        const std::string& path = run.path;
+        if (!FileExists(path + "input.xml")) run.failures.push_back(path + "input.xml is missing");
+        if (!FileExists(path + "expected_parser.txt")) run.failures.push_back(path + "expected_parser.txt is missing");
 
-            std::ofstream parserOutputStream;
-            std::string paserOutputName = path + testNames[i] + "output_parser.txt";
-            parserOutputStream.open(paserOutputName.c_str());
+        std::ostringstream parserOutputStream;
+        Parser parser = Parser(parserOutputStream);
 
-            Parser parser = Parser(parserOutputStream);
+        std::string completefilename = path + "input.xml";
+        std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile(completefilename.c_str());
 
-            std::string completefilename = path + testNames[i] + "input.xml";
-            std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile(completefilename.c_str());
+        expectGolden(run, path + "expected_parser.txt", path + "output_parser.txt", parserOutputStream.str());
+        if (pairResult.first != ParseEnum::kSuccess) run.failures.push_back(path + "input.xml did not parse as success");
 
-            EXPECT_TRUE(FileCompare(path + testNames[i] + "expected_parser.txt", path + testNames[i] + "output_parser.txt"));
+        for (AirportMap::iterator it_airport = pairResult.second.begin(); it_airport != pairResult.second.end(); it_airport++) {
+            Airport* airport = it_airport->second;
 
-            parserOutputStream.close();
+            std::string airportPath = path + airport->getIata() + "/";
 
-            EXPECT_EQ(pairResult.first, ParseEnum::kSuccess);
-            for (AirportMap::iterator it_airport = pairResult.second.begin(); it_airport != pairResult.second.end(); it_airport++) {
-                Airport* airport = it_airport->second;
+            std::ostringstream outputStream;
+            std::ostringstream errorStream;
+            std::ostringstream towerStream;
+            std::ostringstream floorplanStream;
+            std::ostringstream airportInfoStream;
 
-                std::string airportPath = path + testNames[i] + airport->getIata() + "/";
+            airport->printInfo(airportInfoStream);
 
-                EXPECT_TRUE(FileExists(airportPath + "expected_output.txt"));
-                EXPECT_TRUE(FileExists(airportPath + "expected_error.txt"));
-                EXPECT_TRUE(FileExists(airportPath + "expected_tower.txt"));
+            for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
+                std::ostringstream airplaneStream;
+                it_airplane->second->printInfo(airplaneStream);
+
+                const std::string airplanePath = airportPath + "airplanes/";
+                expectGolden(run, airplanePath + "expected_" + it_airplane->second->getNumber() + ".txt", airplanePath + it_airplane->second->getNumber() + ".txt", airplaneStream.str());
+            }
+
+            Simulator simulator(airport, outputStream, errorStream, towerStream, floorplanStream);
+            simulator.Simulate();
+
+            expectGolden(run, airportPath + "expected_output.txt", airportPath + "output_output.txt", outputStream.str());
+            expectGolden(run, airportPath + "expected_error.txt", airportPath + "output_error.txt", errorStream.str());
+            expectGolden(run, airportPath + "expected_tower.txt", airportPath + "output_tower.txt", towerStream.str());
+            expectGolden(run, airportPath + "expected_floorplan.txt", airportPath + "output_floorplan.txt", floorplanStream.str());
+            expectGolden(run, airportPath + "expected_airportinfo.txt", airportPath + "output_airportinfo.txt", airportInfoStream.str());
+
+            delete airport;
+        }
+    }
 
-                std::ofstream outputStream;
-                std::string outputStreamName = airportPath + "output_output.txt";
-                outputStream.open(outputStreamName.c_str());
+    void* runFixtures(void* argument) {
+        FixtureQueue* queue = static_cast<FixtureQueue*>(argument);
 
-                std::ofstream errorStream;
-                std::string errorStreamName = airportPath + "output_error.txt";
-                errorStream.open(errorStreamName.c_str());
+        while (true) {
+            const unsigned long index = __sync_fetch_and_add(&queue->next, 1);
+            if (index >= queue->runs->size()) break;
+            runFixture((*queue->runs)[index]);
+        }
 
-                std::ofstream towerStream;
-                std::string towerStreamName = airportPath + "output_tower.txt";
-                towerStream.open(towerStreamName.c_str());
+        return NULL;
+    }
+}
 
-                std::ofstream floorplanStream;
-                std::string floorplanStreamName = airportPath + "output_floorplan.txt";
-                floorplanStream.open(floorplanStreamName.c_str());
+class OutputTests: public ::testing::Test {
+protected:
+    friend class Airport;
 
-                std::ofstream airportInfoStream;
-                std::string fairportInfoStreamName = airportPath + "output_airportinfo.txt";
-                airportInfoStream.open(fairportInfoStreamName.c_str());
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
 
-                airport->printInfo(airportInfoStream);
+    virtual void TearDown() {
 
-                for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
-                    std::ofstream airplaneStream;
-                    std::string airplaneMap = airportPath + "airplanes/" + it_airplane->second->getNumber() + ".txt";
-                    airplaneStream.open(airplaneMap.c_str());
+    };
+};
 
-                    it_airplane->second->printInfo(airplaneStream);
+TEST_F(OutputTests, outputs) {
+    std::string path = "./outputTests/";
 
-                    EXPECT_TRUE(FileCompare(airportPath + "airplanes/expected_" + it_airplane->second->getNumber() + ".txt", airplaneMap));
+    // every directory with an input.xml is a fixture
+    std::vector<FixtureRun> runs;
+    std::vector<std::string> directories = ListDirectories(path);
+    for (std::vector<std::string>::const_iterator it_directory = directories.begin(); it_directory != directories.end(); it_directory++) {
+        if (!FileExists(path + *it_directory + "/input.xml")) continue;
 
-                    airplaneStream.close();
-                }
+        FixtureRun run;
+        run.path = path + *it_directory + "/";
+        runs.push_back(run);
+    }
+    ASSERT_FALSE(runs.empty());
 
-                Simulator simulator(airport, outputStream, errorStream, towerStream, floorplanStream);
-                simulator.Simulate();
+    FixtureQueue queue;
+    queue.runs = &runs;
+    queue.next = 0;
 
-                EXPECT_TRUE(FileCompare(airportPath + "expected_output.txt", airportPath + "output_output.txt"));
-                EXPECT_TRUE(FileCompare(airportPath + "expected_error.txt", airportPath + "output_error.txt"));
-                EXPECT_TRUE(FileCompare(airportPath + "expected_tower.txt", airportPath + "output_tower.txt"));
-                EXPECT_TRUE(FileCompare(airportPath + "expected_floorplan.txt", airportPath + "output_floorplan.txt"));
-                EXPECT_TRUE(FileCompare(airportPath + "expected_airportinfo.txt", airportPath + "output_airportinfo.txt"));
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    const unsigned long threadCount = std::min(runs.size(), static_cast<unsigned long>(processors > 1 ? processors : 1));
 
-                outputStream.close();
-                errorStream.close();
-                towerStream.close();
-                floorplanStream.close();
-                airportInfoStream.close();
+    // the calling thread works on the queue as well
+    std::vector<pthread_t> threads;
+    for (unsigned long i = 1; i < threadCount; i++) {
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, &runFixtures, &queue) == 0) threads.push_back(thread);
+    }
+    runFixtures(&queue);
+    for (std::vector<pthread_t>::iterator it_thread = threads.begin(); it_thread != threads.end(); it_thread++) {
+        pthread_join(*it_thread, NULL);
+    }
 
-                delete airport;
-            }
-        } else {
-            EXPECT_TRUE(false);
+    for (std::vector<FixtureRun>::const_iterator it_run = runs.begin(); it_run != runs.end(); it_run++) {
+        for (std::vector<std::string>::const_iterator it_failure = it_run->failures.begin(); it_failure != it_run->failures.end(); it_failure++) {
+            ADD_FAILURE() << *it_failure;
         }
     }
-}
\ No newline at end of file
+}
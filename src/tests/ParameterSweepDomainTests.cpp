@@ -0,0 +1,153 @@
+#include "../classes/Airport.h"
+#include "../utils/ParameterSweep.h"
+#include "../utils/ScenarioInput.h"
+
+#include <gtest/gtest.h>
+#include <set>
+
+class ParameterSweepDomainTests: public ::testing::Test {
+protected:
+    friend class ParameterSweep;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(ParameterSweepDomainTests, ranges) {
+    std::vector<unsigned int> values;
+    ASSERT_TRUE(ParameterSweep::parseRange("5", values));
+    EXPECT_EQ(values, std::vector<unsigned int>(1, 5));
+
+    ASSERT_TRUE(ParameterSweep::parseRange("1,10-20/5,3-4", values));
+    const unsigned int expected[] = {1, 10, 15, 20, 3, 4};
+    EXPECT_EQ(values, std::vector<unsigned int>(expected, expected + 6));
+
+    ASSERT_TRUE(ParameterSweep::parseRange("0-10/4", values));
+    const unsigned int stepped[] = {0, 4, 8};
+    EXPECT_EQ(values, std::vector<unsigned int>(stepped, stepped + 3));
+
+    EXPECT_FALSE(ParameterSweep::parseRange("", values));
+    EXPECT_FALSE(ParameterSweep::parseRange("a", values));
+    EXPECT_FALSE(ParameterSweep::parseRange("5-1", values));
+    EXPECT_FALSE(ParameterSweep::parseRange("1-5/0", values));
+    EXPECT_FALSE(ParameterSweep::parseRange("1,,2", values));
+    EXPECT_EQ(values.size(), 3u);
+
+    FleetMix mix;
+    EXPECT_TRUE(mix.keepsBase());
+    EXPECT_EQ(mix.getName(), "keep");
+    ASSERT_TRUE(mix.parse("1:2:0:3"));
+    EXPECT_EQ(mix.getWeight(AirplaneEnums::kType_Airline), 2u);
+    EXPECT_EQ(mix.getName(), "1:2:0:3");
+    EXPECT_FALSE(mix.parse("0:0:0:0"));
+    EXPECT_FALSE(mix.parse("1:2:3"));
+    ASSERT_TRUE(mix.parse("keep"));
+    EXPECT_TRUE(mix.keepsBase());
+
+    SweepRanges ranges;
+    ASSERT_EQ(ranges.getPoints().size(), 1u);
+    ranges.gates.push_back(4);
+    ranges.runwayTypes.push_back(RunwayEnums::kGrass);
+    ranges.arrivals.push_back(50);
+    ranges.arrivals.push_back(200);
+    const std::vector<SweepPoint> points = ranges.getPoints();
+    ASSERT_EQ(points.size(), 12u);
+    EXPECT_EQ(points[1].arrivals, 50u);
+    EXPECT_EQ(points[3].runwayType, RunwayEnums::kGrass);
+    EXPECT_EQ(points[11].gates, 4u);
+}
+
+TEST_F(ParameterSweepDomainTests, variants) {
+    ScenarioInput input;
+    ASSERT_EQ(input.load("./outputTests/2/", std::cerr), ParseEnum::kSuccess);
+    const Airport* airport = input.getAirports().begin()->second;
+
+    unsigned long arrivals = 0;
+    for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
+        if (it_airplane->second->getStatus() == AirplaneEnums::kStatus_Approaching) arrivals++;
+    }
+    ASSERT_GT(arrivals, 0u);
+    const unsigned long others = airport->getAirplanes().size() - arrivals;
+
+    SweepPoint point;
+    point.gates = airport->getGateCount() + 3;
+    point.runwayLength = 50;
+    point.runwayType = RunwayEnums::kGrass;
+    point.arrivals = 300;
+    Airport* variant = ParameterSweep::buildVariant(airport, point);
+    EXPECT_EQ(variant->getGateCount(), airport->getGateCount() + 3);
+    for (RunwayMap::const_iterator it_runway = variant->getRunways().begin(); it_runway != variant->getRunways().end(); it_runway++) {
+        EXPECT_EQ(it_runway->second->getType(), RunwayEnums::kGrass);
+        EXPECT_EQ(it_runway->second->getLength(), airport->getRunwayByName(it_runway->first)->getLength() / 2);
+    }
+    ASSERT_EQ(variant->getAirplanes().size(), others + 3 * arrivals);
+
+    // every arrival is drawn three times, the copies are numbered
+    const Airplane* first = NULL;
+    for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); first == NULL && it_airplane != airport->getAirplanes().end(); it_airplane++) {
+        if (it_airplane->second->getStatus() == AirplaneEnums::kStatus_Approaching) first = it_airplane->second;
+    }
+    const Airplane* copy = variant->getAirplanesByRegistrationNumber(first->getNumber() + "-2");
+    ASSERT_TRUE(copy != NULL);
+    EXPECT_EQ(copy->getAirport(), variant);
+    EXPECT_EQ(copy->getModel(), first->getModel());
+    EXPECT_EQ(copy->getFuel(), first->getFuel());
+    EXPECT_TRUE(variant->getAirplanesByRegistrationNumber(first->getNumber() + "-3") == NULL);
+
+    // the copies take free codes of the block of their combination
+    EXPECT_EQ(copy->getSquawk() / 01000 * 01000, first->getSquawkBlock());
+    std::set<unsigned int> squawks;
+    for (AirplaneMap::const_iterator it_airplane = variant->getAirplanes().begin(); it_airplane != variant->getAirplanes().end(); it_airplane++) {
+        EXPECT_TRUE(squawks.insert(it_airplane->second->getSquawk()).second);
+    }
+    delete variant;
+
+    // a mix of one type only draws that type
+    point = SweepPoint();
+    point.mix.parse(std::string(first->getType() == AirplaneEnums::kType_Private ? "1:0:0:0" : first->getType() == AirplaneEnums::kType_Airline ? "0:1:0:0" : first->getType() == AirplaneEnums::kType_Military ? "0:0:1:0" : "0:0:0:1"));
+    ASSERT_TRUE(ParameterSweep::canDraw(airport, point.mix));
+    variant = ParameterSweep::buildVariant(airport, point);
+    ASSERT_EQ(variant->getAirplanes().size(), others + arrivals);
+    for (AirplaneMap::const_iterator it_airplane = variant->getAirplanes().begin(); it_airplane != variant->getAirplanes().end(); it_airplane++) {
+        if (it_airplane->second->getStatus() == AirplaneEnums::kStatus_Approaching) {
+            EXPECT_EQ(it_airplane->second->getType(), first->getType());
+        }
+    }
+    delete variant;
+
+    point = SweepPoint();
+    point.arrivals = 0;
+    variant = ParameterSweep::buildVariant(airport, point);
+    EXPECT_EQ(variant->getAirplanes().size(), others);
+    delete variant;
+
+    // the sweep gives the results of the variants in point order
+    SweepRanges ranges;
+    ranges.arrivals.clear();
+    ranges.arrivals.push_back(100);
+    ranges.arrivals.push_back(200);
+    ParameterSweep sweep(2, 11520);
+    const std::vector<SweepResult> results = sweep.run(airport, ranges.getPoints());
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_EQ(results[0].point.arrivals, 100u);
+    EXPECT_EQ(results[0].airplanes, airport->getAirplanes().size());
+    EXPECT_EQ(results[1].airplanes, others + 2 * arrivals);
+    const ReplicationResult base = MonteCarloRunner::replicate(airport, 0, 0, 11520);
+    EXPECT_EQ(results[0].metrics.ticks, base.ticks);
+    EXPECT_DOUBLE_EQ(results[0].metrics.gateTime, base.gateTime);
+    EXPECT_TRUE(results[1].metrics.finished);
+
+    std::ostringstream report;
+    ParameterSweep::report(results, report);
+    EXPECT_EQ(report.str().find(" Gates  Runway"), static_cast<std::string::size_type>(0));
+
+    point = SweepPoint();
+    point.runwayLength = 0;
+    EXPECT_DEATH(ParameterSweep::buildVariant(airport, point), "Runways can not be shortened to nothing.");
+    EXPECT_DEATH(ParameterSweep::buildVariant(NULL, SweepPoint()), "Airport can not be NULL.");
+}
@@ -0,0 +1,77 @@
+#include "../classes/Airport.h"
+#include "../classes/Simulator.h"
+#include "../utils/PerfCounters.h"
+#include "../parser/Parser.h"
+
+#include <gtest/gtest.h>
+
+class PerfCountersDomainTests: public ::testing::Test {
+protected:
+    friend class PerfCounters;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(PerfCountersDomainTests, phases) {
+    PerfCounters counters;
+    EXPECT_EQ(counters.getSamples("work"), static_cast<unsigned long>(0));
+
+    volatile unsigned long sum = 0;
+    for (unsigned int sample = 0; sample < 3; sample++) {
+        counters.begin();
+        for (unsigned long i = 0; i < 1000000; i++) sum += i;
+        counters.end("work");
+    }
+
+    EXPECT_EQ(counters.getSamples("work"), static_cast<unsigned long>(3));
+    for (unsigned int counter = 0; counter < PerfEnums::kCounterCount; counter++) {
+        if (!counters.isAvailable(static_cast<PerfEnums::ECounter>(counter))) {
+            EXPECT_EQ(counters.getTotal("work").values[counter], static_cast<unsigned long long>(0));
+        }
+    }
+    if (counters.isAvailable(PerfEnums::kCounter_TaskClock)) {
+        EXPECT_GT(counters.getTotal("work").values[PerfEnums::kCounter_TaskClock], static_cast<unsigned long long>(0));
+    }
+
+    std::ostringstream report;
+    counters.report(report);
+    EXPECT_NE(report.str().find("work"), std::string::npos);
+    EXPECT_NE(report.str().find("per sample"), std::string::npos);
+
+    EXPECT_DEATH(counters.end("work"), "PerfCounters phase was not begun.");
+    counters.begin();
+    EXPECT_DEATH(counters.begin(), "PerfCounters phase was already begun.");
+}
+
+TEST_F(PerfCountersDomainTests, sampledSimulation) {
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/1/input.xml");
+    ASSERT_EQ(pairResult.first, ParseEnum::kSuccess);
+    Airport* airport = pairResult.second.begin()->second;
+
+    std::ostringstream plainOutput, plainError, plainTower, plainFloorplan;
+    Simulator plainSimulator(airport, plainOutput, plainError, plainTower, plainFloorplan);
+    plainSimulator.Simulate();
+
+    PerfCounters counters;
+    SimulationProfile profile;
+    std::ostringstream sampledOutput, sampledError, sampledTower, sampledFloorplan;
+    Simulator sampledSimulator(airport, sampledOutput, sampledError, sampledTower, sampledFloorplan);
+    sampledSimulator.setPerfCounters(&counters);
+    sampledSimulator.setProfile(&profile);
+    sampledSimulator.Simulate();
+
+    EXPECT_EQ(sampledOutput.str(), plainOutput.str());
+    EXPECT_EQ(counters.getSamples("simulate"), profile.getTicks());
+    EXPECT_EQ(counters.getSamples("render"), profile.getTicks());
+    EXPECT_EQ(counters.getSamples("flush"), static_cast<unsigned long>(1));
+
+    delete airport;
+}
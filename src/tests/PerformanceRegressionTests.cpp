@@ -0,0 +1,183 @@
+#include "../classes/Airport.h"
+#include "../classes/Simulator.h"
+#include "../classes/AllocationTracker.h"
+#include "../parser/Parser.h"
+#include "../utils/ScenarioGenerator.h"
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+
+/**
+ * Compares the runtime and allocations of generated scenarios against perfTests/baseline.txt. \n
+ * Excluded from the default run by main_tests, run them with --gtest_filter=PerformanceRegressionTests.* \n
+ * Setting PSE_UPDATE_BASELINE writes the measured values to the baseline instead of comparing.
+ */
+class PerformanceRegressionTests: public ::testing::Test {
+protected:
+    friend class Simulator;
+
+    static const unsigned int kRepeat = 5;
+
+    // runtime is relative to a calibration workload so the baseline carries over between machines
+    static const double kRuntimeTolerance;
+    static const double kAllocationTolerance;
+
+    struct Measurement {
+        double runtime;
+        unsigned long allocations;
+    };
+
+    class NullBuffer: public std::streambuf {
+    protected:
+        int overflow(int c) {
+            return c;
+        }
+    };
+
+    NullBuffer nullBuffer;
+    std::ostream nullStream;
+
+    PerformanceRegressionTests() : nullBuffer(), nullStream(&nullBuffer) {}
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+
+    static const char* baselineName() {
+        return "./perfTests/baseline.txt";
+    }
+
+    static std::map<std::string, Measurement> loadBaseline() {
+        std::map<std::string, Measurement> baseline;
+        std::ifstream stream(baselineName());
+        std::string line;
+
+        while (std::getline(stream, line)) {
+            if (line.empty() || line[0] == '#') continue;
+
+            std::istringstream fields(line);
+            std::string name;
+            Measurement measurement;
+            if (fields >> name >> measurement.runtime >> measurement.allocations) baseline[name] = measurement;
+        }
+
+        return baseline;
+    }
+
+    static void saveBaseline(const std::map<std::string, Measurement>& baseline) {
+        std::ofstream stream(baselineName());
+        stream << "# Runtime relative to the calibration workload and allocations of parsing and simulating" << std::endl;
+        stream << "# Regenerate with PSE_UPDATE_BASELINE=1 PSE_Tests --gtest_filter=PerformanceRegressionTests.*" << std::endl;
+        stream << std::fixed << std::setprecision(3);
+        for (std::map<std::string, Measurement>::const_iterator it_case = baseline.begin(); it_case != baseline.end(); it_case++) {
+            stream << it_case->first << " " << it_case->second.runtime << " " << it_case->second.allocations << std::endl;
+        }
+    }
+
+    static unsigned long long calibrate() {
+        std::vector<unsigned int> values(200000);
+        unsigned int state = 12345;
+        for (unsigned int i = 0; i < values.size(); i++) {
+            state = state * 1103515245 + 12345;
+            values[i] = state;
+        }
+
+        const unsigned long long start = getThreadCpuNanoseconds();
+        std::sort(values.begin(), values.end());
+        return getThreadCpuNanoseconds() - start;
+    }
+
+    bool simulate(const std::string& fileName, const unsigned int ticks) {
+        Parser parser(nullStream);
+        std::pair<ParseEnum::EResult, AirportMap> parsed = parser.parseFile(fileName.c_str());
+        const bool success = (parsed.first == ParseEnum::kSuccess && parsed.second.size() == 1);
+
+        if (success) {
+            Simulator simulator(parsed.second.begin()->second, nullStream, nullStream, nullStream, nullStream);
+            simulator.setTickLimit(ticks);
+            simulator.Simulate();
+        }
+
+        for (AirportMap::iterator it_airport = parsed.second.begin(); it_airport != parsed.second.end(); it_airport++) {
+            delete it_airport->second;
+        }
+        return success;
+    }
+
+    void checkCase(const std::string& name, const ScenarioConfig& config, const unsigned int ticks) {
+        const std::string fileName = "./perfTests/" + name + ".xml";
+        ScenarioGenerator generator(config);
+        ASSERT_TRUE(generator.writeFile(fileName));
+
+        Measurement measured;
+        {
+            AllocationTracker tracker(false);
+            ASSERT_TRUE(simulate(fileName, ticks));
+            measured.allocations = tracker.getOtherAllocations();
+            for (unsigned int phase = 0; phase < ProfileEnums::kPhaseCount; phase++) {
+                measured.allocations += tracker.getAllocations(static_cast<ProfileEnums::EPhase>(phase));
+            }
+        }
+
+        // every run is divided by a calibration run next to it, the median ratio is kept
+        std::vector<double> ratios;
+        for (unsigned int iteration = 0; iteration < kRepeat; iteration++) {
+            const unsigned long long calibration = calibrate();
+            const unsigned long long start = getThreadCpuNanoseconds();
+            simulate(fileName, ticks);
+            ratios.push_back(static_cast<double>(getThreadCpuNanoseconds() - start) / calibration);
+        }
+        std::sort(ratios.begin(), ratios.end());
+        measured.runtime = ratios[kRepeat / 2];
+        std::remove(fileName.c_str());
+
+        std::map<std::string, Measurement> baseline = loadBaseline();
+        if (std::getenv("PSE_UPDATE_BASELINE") != NULL) {
+            baseline[name] = measured;
+            saveBaseline(baseline);
+            return;
+        }
+
+        ASSERT_TRUE(baseline.find(name) != baseline.end()) << "No baseline for " << name << ", run with PSE_UPDATE_BASELINE=1";
+        const Measurement& expected = baseline[name];
+        EXPECT_LE(measured.runtime, expected.runtime * (1 + kRuntimeTolerance)) << name << " runtime regressed";
+        EXPECT_LE(measured.allocations, expected.allocations * (1 + kAllocationTolerance)) << name << " allocations regressed";
+    }
+};
+
+const double PerformanceRegressionTests::kRuntimeTolerance = 0.30;
+const double PerformanceRegressionTests::kAllocationTolerance = 0.02;
+
+TEST_F(PerformanceRegressionTests, day) {
+    ScenarioConfig config;
+    config.airplanes = 100;
+    config.runways = 4;
+    config.seed = 1;
+    checkCase("day", config, 1440);
+}
+
+TEST_F(PerformanceRegressionTests, crowded) {
+    ScenarioConfig config;
+    config.airplanes = 2000;
+    config.runways = 10;
+    config.seed = 2;
+    checkCase("crowded", config, 240);
+}
+
+TEST_F(PerformanceRegressionTests, crossings) {
+    ScenarioConfig config;
+    config.airplanes = 300;
+    config.runways = 50;
+    config.crossingDensity = 80;
+    config.seed = 3;
+    checkCase("crossings", config, 240);
+}
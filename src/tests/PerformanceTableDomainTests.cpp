@@ -0,0 +1,61 @@
+#include "../classes/Airplane.h"
+#include "../classes/PerformanceTable.h"
+
+#include <gtest/gtest.h>
+
+class PerformanceTableDomainTests: public ::testing::Test {
+protected:
+    friend class PerformanceTable;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(PerformanceTableDomainTests, defaults) {
+    const PerformanceTable& table = PerformanceTable::getDefault();
+
+    EXPECT_EQ(table.getFuelConsumption(AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Propeller), static_cast<unsigned int>(10));
+    EXPECT_EQ(table.getFuelConsumption(AirplaneEnums::kSize_Large, AirplaneEnums::kEngine_Jet), static_cast<unsigned int>(250));
+    EXPECT_EQ(table.getFuelConsumption(AirplaneEnums::kSize_InvalidSize, AirplaneEnums::kEngine_Jet), static_cast<unsigned int>(0));
+
+    EXPECT_EQ(table.getActionTime(AirplaneEnums::kStatus_DescendingTo5000ft, AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Propeller), static_cast<unsigned int>(2));
+    EXPECT_EQ(table.getActionTime(AirplaneEnums::kStatus_DescendingTo5000ft, AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Jet), static_cast<unsigned int>(1));
+    EXPECT_EQ(table.getActionTime(AirplaneEnums::kStatus_TaxiingToApron, AirplaneEnums::kSize_Large, AirplaneEnums::kEngine_Jet), static_cast<unsigned int>(5));
+    EXPECT_EQ(table.getActionTime(AirplaneEnums::kStatus_Boarding, AirplaneEnums::kSize_Medium, AirplaneEnums::kEngine_Jet), static_cast<unsigned int>(10));
+    EXPECT_EQ(table.getActionTime(AirplaneEnums::kStatus_PushingBack, AirplaneEnums::kSize_Large, AirplaneEnums::kEngine_Propeller), static_cast<unsigned int>(3));
+    EXPECT_EQ(table.getActionTime(AirplaneEnums::kStatus_TakingOff, AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Propeller), static_cast<unsigned int>(3));
+    EXPECT_EQ(table.getActionTime(AirplaneEnums::kStatus_HoldingShort, AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Propeller), static_cast<unsigned int>(1));
+
+    EXPECT_EQ(table.getRefuelRate(), static_cast<unsigned int>(10000));
+    EXPECT_EQ(table.getRefuelTime(0), static_cast<unsigned int>(0));
+    EXPECT_EQ(table.getRefuelTime(1), static_cast<unsigned int>(1));
+    EXPECT_EQ(table.getRefuelTime(10000), static_cast<unsigned int>(1));
+    EXPECT_EQ(table.getRefuelTime(10001), static_cast<unsigned int>(2));
+}
+
+TEST_F(PerformanceTableDomainTests, setters) {
+    PerformanceTable table;
+
+    EXPECT_NO_THROW(table.setActionTime(AirplaneEnums::kStatus_Boarding, AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Jet, 7));
+    EXPECT_EQ(table.getActionTime(AirplaneEnums::kStatus_Boarding, AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Jet), static_cast<unsigned int>(7));
+    EXPECT_EQ(table.getActionTime(AirplaneEnums::kStatus_Boarding, AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Propeller), static_cast<unsigned int>(5));
+
+    EXPECT_NO_THROW(table.setFuelConsumption(AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Jet, 30));
+    EXPECT_EQ(table.getFuelConsumption(AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Jet), static_cast<unsigned int>(30));
+
+    EXPECT_DEATH(table.setRefuelRate(0), "Refuel rate must be positive.");
+    EXPECT_NO_THROW(table.setRefuelRate(500));
+    EXPECT_EQ(table.getRefuelTime(1200), static_cast<unsigned int>(3));
+
+    Airplane airplane = Airplane("N123", "Dummy Airplane", "Dummy", 01, 10000, 10000, 10000, 4, 4, AirplaneEnums::kStatus_Approaching, AirplaneEnums::kType_Private, AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Jet);
+    EXPECT_EQ(airplane.getAircraftType(), PerformanceTable::getDefault().getAircraftType(AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Jet));
+    EXPECT_EQ(airplane.getFuelConsumption(), static_cast<unsigned int>(25));
+    EXPECT_DEATH(airplane.setAircraftType(NULL), "Referenced AircraftType is a nullpointer.");
+    EXPECT_NO_THROW(airplane.setAircraftType(table.getAircraftType(AirplaneEnums::kSize_Small, AirplaneEnums::kEngine_Jet)));
+    EXPECT_EQ(airplane.getFuelConsumption(), static_cast<unsigned int>(30));
+}
@@ -0,0 +1,123 @@
+#include "../utils/ResultCache.h"
+#include "../utils/ScenarioRunner.h"
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+
+class ResultCacheDomainTests: public ::testing::Test {
+protected:
+    friend class ResultCache;
+
+    std::string scenario;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+
+        scenario = "./cacheTest/scenario/";
+        ASSERT_EQ(std::system("rm -rf ./cacheTest && mkdir -p ./cacheTest/scenario/ANR/airplanes"), 0);
+        ASSERT_EQ(std::system("cp ./outputTests/1/input.xml ./cacheTest/scenario/input.xml"), 0);
+    };
+
+    virtual void TearDown() {
+        std::system("rm -rf ./cacheTest");
+    };
+};
+
+TEST_F(ResultCacheDomainTests, keys) {
+    ResultCache cache("./cacheTest/cache/");
+    EXPECT_TRUE(DirectoryExists("./cacheTest/cache/"));
+
+    const std::string key = cache.computeKey(scenario, "sync");
+    EXPECT_EQ(key.size(), static_cast<unsigned long>(32));
+    EXPECT_EQ(cache.computeKey(scenario, "sync"), key);
+    EXPECT_NE(cache.computeKey(scenario, "async"), key);
+
+    std::ofstream input((scenario + "input.xml").c_str(), std::ios::app);
+    input << " ";
+    input.close();
+    EXPECT_NE(cache.computeKey(scenario, "sync"), key);
+
+    EXPECT_DEATH(ResultCache("./cacheTest/nocache"), "Cache directory must end with a slash.");
+}
+
+TEST_F(ResultCacheDomainTests, restoresOutputs) {
+    RunOptions options;
+    options.cache = true;
+    options.cacheDirectory = "./cacheTest/cache/";
+    ScenarioRunner runner(options);
+
+    std::ostringstream console;
+    ScenarioSummary first = runner.run(scenario, console);
+    EXPECT_FALSE(first.cached);
+    EXPECT_EQ(first.result, ParseEnum::kSuccess);
+    EXPECT_FALSE(first.outputs.empty());
+
+    const std::string outputName = scenario + "ANR/output_output.txt";
+    std::ifstream output(outputName.c_str());
+    std::ostringstream expected;
+    expected << output.rdbuf();
+    output.close();
+    ASSERT_FALSE(expected.str().empty());
+    std::remove(outputName.c_str());
+
+    ScenarioSummary second = runner.run(scenario, console);
+    EXPECT_TRUE(second.cached);
+    EXPECT_EQ(second.result, first.result);
+    EXPECT_EQ(second.airports, first.airports);
+    EXPECT_EQ(second.airplanes, first.airplanes);
+    EXPECT_EQ(second.outputs, first.outputs);
+    EXPECT_TRUE(CompareWithFile(outputName, expected.str()));
+
+    // an entry is written once, a second store keeps it
+    ResultCache cache(options.cacheDirectory);
+    EXPECT_FALSE(cache.store(cache.computeKey(scenario, "sync"), scenario, first));
+
+    // measuring runs are never cached
+    options.profile = true;
+    ScenarioRunner measuringRunner(options);
+    EXPECT_FALSE(measuringRunner.run(scenario, console).cached);
+}
+
+TEST_F(ResultCacheDomainTests, abortedInputs) {
+    RunOptions options;
+    options.cache = true;
+    options.cacheDirectory = "./cacheTest/cache/";
+    ScenarioRunner runner(options);
+
+    std::ofstream performance((scenario + "performance.xml").c_str());
+    performance << "<ACTION>";
+    performance.close();
+
+    // the run stops before input.xml, the console says why and nothing is cached
+    std::ostringstream console;
+    EXPECT_EQ(runner.run(scenario, console).result, ParseEnum::kAborted);
+    EXPECT_NE(console.str().find("Error loading ./cacheTest/scenario/performance.xml"), std::string::npos);
+    EXPECT_FALSE(runner.run(scenario, console).cached);
+}
+
+TEST_F(ResultCacheDomainTests, outputPaths) {
+    ResultCache cache("./cacheTest/cache/");
+    ASSERT_EQ(std::system("mkdir -p './cacheTest/scenario/ANR/with space'"), 0);
+
+    const std::string outputName = "ANR/with space/output tower.txt";
+    std::ofstream output((scenario + outputName).c_str());
+    output << "tower";
+    output.close();
+
+    ScenarioSummary summary;
+    summary.result = ParseEnum::kSuccess;
+    summary.outputs.push_back(outputName);
+    const std::string key = cache.computeKey(scenario, "sync");
+    ASSERT_TRUE(cache.store(key, scenario, summary));
+
+    // the whole path is restored, not the part before the first space
+    std::remove((scenario + outputName).c_str());
+    ScenarioSummary restored;
+    ASSERT_TRUE(cache.restore(key, scenario, restored));
+    EXPECT_EQ(restored.outputs, summary.outputs);
+    EXPECT_TRUE(CompareWithFile(scenario + outputName, "tower"));
+
+    // an output that can not be written back makes the lookup a miss
+    ASSERT_EQ(std::system("rm -rf './cacheTest/scenario/ANR/with space'"), 0);
+    EXPECT_FALSE(cache.restore(key, scenario, restored));
+}
@@ -0,0 +1,73 @@
+#include "../classes/Airport.h"
+#include "../utils/SaturationFinder.h"
+#include "../utils/ScenarioInput.h"
+
+#include <gtest/gtest.h>
+
+class SaturationFinderDomainTests: public ::testing::Test {
+protected:
+    friend class SaturationFinder;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(SaturationFinderDomainTests, search) {
+    ScenarioInput input;
+    ASSERT_EQ(input.load("./outputTests/2/", std::cerr), ParseEnum::kSuccess);
+    const Airport* airport = input.getAirports().begin()->second;
+
+    SaturationOptions options;
+    options.maxHolding = 20;
+    options.upper = 2000;
+    options.threads = 1;
+    SaturationFinder bisection(options);
+    EXPECT_FALSE(bisection.isSearched());
+    EXPECT_DEATH(bisection.getSustainable(), "SaturationFinder has not searched yet.");
+    bisection.search(airport);
+    ASSERT_TRUE(bisection.isSearched());
+    ASSERT_TRUE(bisection.hasSustainable());
+    ASSERT_TRUE(bisection.hasUnsustainable());
+    EXPECT_LT(bisection.getSustainable(), bisection.getUnsustainable());
+
+    // the bounds are one arrival apart and agree with plain simulations of both loads
+    EXPECT_EQ(ParameterSweep::getArrivalCount(airport, bisection.getUnsustainable()), bisection.getSustainableArrivals() + 1);
+    SweepPoint point;
+    point.arrivals = bisection.getSustainable();
+    Airport* variant = ParameterSweep::buildVariant(airport, point);
+    EXPECT_TRUE(bisection.isSustainable(MonteCarloRunner::replicate(variant, 0, 0, options.tickLimit)));
+    delete variant;
+    point.arrivals = bisection.getUnsustainable();
+    variant = ParameterSweep::buildVariant(airport, point);
+    EXPECT_FALSE(bisection.isSustainable(MonteCarloRunner::replicate(variant, 0, 0, options.tickLimit)));
+    delete variant;
+
+    // wider rounds find the same bounds in fewer rounds
+    options.threads = 3;
+    SaturationFinder parallel(options);
+    parallel.search(airport);
+    EXPECT_EQ(parallel.getSustainableArrivals(), bisection.getSustainableArrivals());
+    EXPECT_LT(parallel.getProbes().back().round, bisection.getProbes().back().round);
+    EXPECT_DEATH(parallel.search(airport), "SaturationFinder has already searched.");
+
+    std::ostringstream report;
+    parallel.report(report);
+    EXPECT_NE(report.str().find("Saturation between"), std::string::npos);
+
+    options.upper = 100;
+    SaturationFinder base(options);
+    base.search(airport);
+    EXPECT_FALSE(base.hasUnsustainable());
+    EXPECT_EQ(base.getProbes().size(), 2u);
+
+    options.upper = 0;
+    EXPECT_DEATH(SaturationFinder finder(options), "The upper load must be above 0.");
+    options.upper = 100;
+    options.precision = 0;
+    EXPECT_DEATH(SaturationFinder finder(options), "The precision must be above 0.");
+}
@@ -0,0 +1,129 @@
+#include "../classes/Airport.h"
+#include "../parser/Parser.h"
+#include "../utils/ScenarioGenerator.h"
+
+#include <gtest/gtest.h>
+
+class ScenarioGeneratorDomainTests: public ::testing::Test {
+protected:
+    friend class ScenarioGenerator;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(ScenarioGeneratorDomainTests, parsesAsSuccess) {
+    ScenarioConfig config;
+    config.airplanes = 600;
+    config.runways = 5;
+    config.seed = 7;
+
+    ScenarioGenerator generator(config);
+    ASSERT_TRUE(generator.writeFile("./outputTests/generated.xml"));
+
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/generated.xml");
+    std::remove("./outputTests/generated.xml");
+
+    ASSERT_EQ(pairResult.first, ParseEnum::kSuccess);
+    EXPECT_TRUE(parserStream.str().empty());
+    ASSERT_EQ(pairResult.second.size(), static_cast<unsigned long>(1));
+
+    Airport* airport = pairResult.second.begin()->second;
+    EXPECT_EQ(airport->getAirplanes().size(), static_cast<unsigned long>(600));
+    EXPECT_EQ(airport->getRunways().size(), static_cast<unsigned long>(5));
+
+    delete airport;
+}
+
+TEST_F(ScenarioGeneratorDomainTests, deterministic) {
+    ScenarioConfig config;
+    config.airplanes = 50;
+    config.runways = 3;
+
+    std::ostringstream first;
+    std::ostringstream second;
+    ScenarioGenerator(config).write(first);
+    ScenarioGenerator(config).write(second);
+    EXPECT_EQ(first.str(), second.str());
+
+    config.seed = 2;
+    std::ostringstream other;
+    ScenarioGenerator(config).write(other);
+    EXPECT_NE(first.str(), other.str());
+
+    config.airplanes = 0;
+    EXPECT_DEATH(ScenarioGenerator generator(config), "A scenario needs at least one airplane.");
+}
+
+TEST_F(ScenarioGeneratorDomainTests, chainsAndCrossings) {
+    ScenarioConfig config;
+    config.airplanes = 300;
+    config.runways = 11;
+    config.taxiChainLength = 4;
+    config.crossingDensity = 50;
+    config.gateShare = 100;
+    config.privateWeight = 1;
+    config.airlineWeight = 0;
+    config.militaryWeight = 0;
+    config.emergencyWeight = 1;
+
+    ScenarioGenerator generator(config);
+    EXPECT_EQ(generator.getAirportCount(), static_cast<unsigned int>(3));
+    ASSERT_TRUE(generator.writeFile("./outputTests/generated.xml"));
+
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/generated.xml");
+    std::remove("./outputTests/generated.xml");
+
+    ASSERT_EQ(pairResult.first, ParseEnum::kSuccess);
+    ASSERT_EQ(pairResult.second.size(), static_cast<unsigned long>(3));
+
+    unsigned long airplanes = 0;
+    for (std::map<std::string, Airport*>::iterator it_airport = pairResult.second.begin(); it_airport != pairResult.second.end(); it_airport++) {
+        Airport* airport = it_airport->second;
+        airplanes += airport->getAirplanes().size();
+
+        for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
+            EXPECT_NE(it_airplane->second->getType(), AirplaneEnums::kType_Airline);
+            EXPECT_NE(it_airplane->second->getType(), AirplaneEnums::kType_Military);
+            EXPECT_EQ(it_airplane->second->getStatus(), AirplaneEnums::kStatus_StandingAtGate);
+        }
+
+        delete airport;
+    }
+    EXPECT_EQ(airplanes, static_cast<unsigned long>(300));
+}
+
+TEST_F(ScenarioGeneratorDomainTests, manyAirports) {
+    ScenarioConfig config;
+    config.airplanes = 1400;
+    config.runways = 1400;
+    config.taxiChainLength = 0;
+
+    ScenarioGenerator generator(config);
+    ASSERT_TRUE(generator.writeFile("./outputTests/generated.xml"));
+
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/generated.xml");
+    std::remove("./outputTests/generated.xml");
+
+    // past 676 airports the codes get a letter longer instead of repeating
+    EXPECT_EQ(pairResult.first, ParseEnum::kSuccess);
+    EXPECT_EQ(pairResult.second.size(), static_cast<unsigned long>(1400));
+    EXPECT_TRUE(pairResult.second.find("GZZ") != pairResult.second.end());
+    EXPECT_TRUE(pairResult.second.find("GAAA") != pairResult.second.end());
+
+    for (std::map<std::string, Airport*>::iterator it_airport = pairResult.second.begin(); it_airport != pairResult.second.end(); it_airport++) {
+        EXPECT_EQ(it_airport->second->getAirplanes().size(), static_cast<unsigned long>(1));
+        delete it_airport->second;
+    }
+}
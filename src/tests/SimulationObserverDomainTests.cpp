@@ -0,0 +1,182 @@
+#include "../classes/Airport.h"
+#include "../classes/Simulator.h"
+#include "../classes/SimulationObserver.h"
+#include "../parser/FlightSchedule.h"
+#include "../parser/Parser.h"
+
+#include <gtest/gtest.h>
+
+class SimulationObserverDomainTests: public ::testing::Test {
+protected:
+    friend class SimulationObserver;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+namespace {
+    /**
+     * Keeps the last status of every Airplane and counts the callbacks
+     */
+    class RecordingObserver: public SimulationObserver {
+    public:
+        std::map<std::string, AirplaneEnums::EStatus> statuses;
+        std::map<std::string, unsigned int> runways;
+        std::map<std::string, AirplaneEnums::EStatus> firstFrom;
+        unsigned long transitions;
+        unsigned long consistent;
+        unsigned long runwayAcquired;
+        unsigned long runwayReleased;
+        unsigned long gateAcquired;
+        unsigned long gateReleased;
+        unsigned long emergencies;
+
+        RecordingObserver()
+                : statuses(), runways(), firstFrom(), transitions(0), consistent(0), runwayAcquired(0), runwayReleased(0),
+                  gateAcquired(0), gateReleased(0), emergencies(0) {}
+
+        virtual void onTransition(const unsigned int, const Airplane* airplane, const AirplaneEnums::EStatus from, const AirplaneEnums::EStatus to) {
+            std::map<std::string, AirplaneEnums::EStatus>::iterator it_status = statuses.find(airplane->getNumber());
+            if (it_status == statuses.end()) firstFrom[airplane->getNumber()] = from;
+            if (it_status == statuses.end() || it_status->second == from) consistent++;
+            statuses[airplane->getNumber()] = to;
+            transitions++;
+        }
+
+        virtual void onRunwayAcquired(const unsigned int, const Airplane* airplane, const Runway*) {
+            runways[airplane->getNumber()]++;
+            runwayAcquired++;
+        }
+
+        virtual void onRunwayReleased(const unsigned int, const Airplane* airplane, const Runway*) {
+            runways[airplane->getNumber()]--;
+            runwayReleased++;
+        }
+
+        virtual void onGateAcquired(const unsigned int, const Airplane*, const long gate) {
+            if (gate >= 0) gateAcquired++;
+        }
+
+        virtual void onGateReleased(const unsigned int, const Airplane*, const long gate) {
+            if (gate >= 0) gateReleased++;
+        }
+
+        virtual void onEmergency(const unsigned int, const Airplane* airplane) {
+            EXPECT_EQ(statuses[airplane->getNumber()], AirplaneEnums::kStatus_Emergency);
+            emergencies++;
+        }
+    };
+}
+
+TEST_F(SimulationObserverDomainTests, callbacks) {
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/2/input.xml");
+    ASSERT_EQ(pairResult.first, ParseEnum::kSuccess);
+    Airport* airport = pairResult.second.begin()->second;
+    ASSERT_FALSE(airport->getAirplanes().empty());
+    const std::string number = airport->getAirplanes().begin()->first;
+
+    std::ostringstream plainOutput, plainError, plainTower, plainFloorplan;
+    Simulator plainSimulator(airport, plainOutput, plainError, plainTower, plainFloorplan);
+    plainSimulator.Simulate();
+
+    RecordingObserver all;
+    RecordingObserver single;
+    single.watchAirplane(number);
+    RecordingObserver landing;
+    landing.watchStatus(AirplaneEnums::kStatus_Landing);
+    RecordingObserver removed;
+
+    std::ostringstream observedOutput, observedError, observedTower, observedFloorplan;
+    Simulator observedSimulator(airport, observedOutput, observedError, observedTower, observedFloorplan);
+    EXPECT_DEATH(observedSimulator.addObserver(NULL), "Referenced SimulationObserver is a nullpointer.");
+    observedSimulator.addObserver(&all);
+    observedSimulator.addObserver(&single);
+    observedSimulator.addObserver(&landing);
+    observedSimulator.addObserver(&removed);
+    observedSimulator.removeObserver(&removed);
+    observedSimulator.Simulate();
+
+    // observing does not change the simulation
+    EXPECT_EQ(observedOutput.str(), plainOutput.str());
+    EXPECT_EQ(observedTower.str(), plainTower.str());
+
+    EXPECT_GT(all.transitions, static_cast<unsigned long>(0));
+    EXPECT_EQ(all.consistent, all.transitions);
+    for (std::map<std::string, AirplaneEnums::EStatus>::iterator it_status = all.statuses.begin(); it_status != all.statuses.end(); it_status++) {
+        EXPECT_EQ(it_status->second, observedSimulator.getAirport()->getAirplanesByRegistrationNumber(it_status->first)->getStatus());
+    }
+
+    EXPECT_GT(all.runwayAcquired, static_cast<unsigned long>(0));
+    for (std::map<std::string, unsigned int>::iterator it_runway = all.runways.begin(); it_runway != all.runways.end(); it_runway++) {
+        EXPECT_LE(it_runway->second, static_cast<unsigned int>(1));
+    }
+    EXPECT_GT(all.gateAcquired + all.gateReleased, static_cast<unsigned long>(0));
+    EXPECT_GT(all.emergencies, static_cast<unsigned long>(0));
+
+    EXPECT_GT(single.transitions, static_cast<unsigned long>(0));
+    EXPECT_EQ(single.statuses.size(), static_cast<unsigned long>(1));
+    EXPECT_EQ(single.statuses.begin()->first, number);
+
+    EXPECT_LT(landing.transitions, all.transitions);
+    EXPECT_EQ(landing.transitions % 2, static_cast<unsigned long>(0));
+
+    EXPECT_EQ(removed.transitions, static_cast<unsigned long>(0));
+
+    delete airport;
+}
+
+TEST_F(SimulationObserverDomainTests, scheduled) {
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/2/input.xml");
+    ASSERT_EQ(pairResult.first, ParseEnum::kSuccess);
+    Airport* airport = pairResult.second.begin()->second;
+    airport->setGateCount(airport->getGateCount() + 1);
+
+    std::istringstream scheduleStream("<AIRPLANE>\n"
+                                      "    <number>S1</number>\n"
+                                      "    <callsign>Scheduled S1</callsign>\n"
+                                      "    <model>Cessna 340</model>\n"
+                                      "    <fuel>50000</fuel>\n"
+                                      "    <passengers>100</passengers>\n"
+                                      "    <status>StandingAtGate</status>\n"
+                                      "    <type>airline</type>\n"
+                                      "    <size>medium</size>\n"
+                                      "    <engine>propeller</engine>\n"
+                                      "    <arrival>0</arrival>\n"
+                                      "    <departure>20</departure>\n"
+                                      "</AIRPLANE>\n");
+    std::ostringstream errorStream;
+    FlightSchedule schedule(scheduleStream, errorStream);
+
+    RecordingObserver scheduled;
+    scheduled.watchAirplane("S1");
+
+    Simulator simulator(airport, errorStream);
+    simulator.setRecordEvents(false);
+    simulator.setSchedule(&schedule);
+    simulator.addObserver(&scheduled);
+
+    // the placement at the gate is reported before the airplane is handled
+    simulator.step();
+    ASSERT_EQ(scheduled.statuses.count("S1"), 1u);
+    EXPECT_EQ(scheduled.firstFrom["S1"], AirplaneEnums::kStatus_InvalidStatus);
+    EXPECT_EQ(scheduled.gateAcquired, 1u);
+    EXPECT_EQ(scheduled.gateReleased, 0u);
+
+    simulator.Simulate();
+    EXPECT_EQ(scheduled.consistent, scheduled.transitions);
+    EXPECT_EQ(scheduled.statuses["S1"], simulator.getAirport()->getAirplanesByRegistrationNumber("S1")->getStatus());
+    EXPECT_EQ(scheduled.gateAcquired, scheduled.gateReleased);
+    EXPECT_EQ(scheduled.runwayAcquired, scheduled.runwayReleased);
+    EXPECT_GT(scheduled.runwayAcquired, 0u);
+
+    delete airport;
+}
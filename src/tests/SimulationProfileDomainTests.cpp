@@ -0,0 +1,75 @@
+#include "../classes/Airport.h"
+#include "../classes/Simulator.h"
+#include "../classes/SimulationProfile.h"
+#include "../parser/Parser.h"
+
+#include <gtest/gtest.h>
+
+class SimulationProfileDomainTests: public ::testing::Test {
+protected:
+    friend class SimulationProfile;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(SimulationProfileDomainTests, counters) {
+    SimulationProfile profile;
+    EXPECT_EQ(profile.getTicks(), static_cast<unsigned long>(0));
+
+    profile.addHandler(AirplaneEnums::kStatus_HoldingShort, 200, true);
+    profile.addHandler(AirplaneEnums::kStatus_HoldingShort, 300, false);
+    profile.addPhase(ProfileEnums::kPhase_Dispatch, 500);
+    profile.addRenderer("output", 40);
+    profile.addRenderer("output", 60);
+    profile.endTick();
+
+    EXPECT_EQ(profile.getTicks(), static_cast<unsigned long>(1));
+    EXPECT_EQ(profile.getHandlerCalls(AirplaneEnums::kStatus_HoldingShort), static_cast<unsigned long>(2));
+    EXPECT_EQ(profile.getHandlerTime(AirplaneEnums::kStatus_HoldingShort), static_cast<unsigned long long>(500));
+    EXPECT_EQ(profile.getWaitingPolls(AirplaneEnums::kStatus_HoldingShort), static_cast<unsigned long>(1));
+    EXPECT_EQ(profile.getPhaseTime(ProfileEnums::kPhase_Dispatch), static_cast<unsigned long long>(500));
+    EXPECT_EQ(profile.getRendererTime("output"), static_cast<unsigned long long>(100));
+    EXPECT_EQ(profile.getRendererTime("tower"), static_cast<unsigned long long>(0));
+
+    EXPECT_DEATH(profile.getHandlerCalls(static_cast<AirplaneEnums::EStatus>(AirplaneEnums::kStatusCount)), "Status is out of range.");
+}
+
+TEST_F(SimulationProfileDomainTests, profiledSimulation) {
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/1/input.xml");
+    ASSERT_EQ(pairResult.first, ParseEnum::kSuccess);
+    Airport* airport = pairResult.second.begin()->second;
+
+    std::ostringstream plainOutput, plainError, plainTower, plainFloorplan;
+    Simulator plainSimulator(airport, plainOutput, plainError, plainTower, plainFloorplan);
+    plainSimulator.Simulate();
+
+    std::ostringstream profiledOutput, profiledError, profiledTower, profiledFloorplan, report;
+    SimulationProfile profile;
+    Simulator profiledSimulator(airport, profiledOutput, profiledError, profiledTower, profiledFloorplan);
+    profiledSimulator.setProfile(&profile, &report);
+    profiledSimulator.Simulate();
+
+    EXPECT_EQ(profiledOutput.str(), plainOutput.str());
+    EXPECT_EQ(profiledTower.str(), plainTower.str());
+    EXPECT_EQ(profiledFloorplan.str(), plainFloorplan.str());
+
+    EXPECT_GT(profile.getTicks(), static_cast<unsigned long>(0));
+    EXPECT_GT(profile.getHandlerCalls(AirplaneEnums::kStatus_Approaching), static_cast<unsigned long>(0));
+    EXPECT_GT(profile.getHandlerCalls(AirplaneEnums::kStatus_Landing), static_cast<unsigned long>(0));
+    EXPECT_EQ(profile.getHandlerCalls(AirplaneEnums::kStatus_LeftAirport), static_cast<unsigned long>(0));
+    EXPECT_GT(profile.getRendererTime("floorplan"), static_cast<unsigned long long>(0));
+
+    EXPECT_NE(report.str().find("Simulation profile over"), std::string::npos);
+    EXPECT_NE(report.str().find("Dispatch"), std::string::npos);
+    EXPECT_NE(report.str().find("Approaching"), std::string::npos);
+
+    delete airport;
+}
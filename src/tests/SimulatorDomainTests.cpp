@@ -0,0 +1,105 @@
+#include "../classes/Airport.h"
+#include "../classes/Simulator.h"
+#include "../parser/Parser.h"
+
+#include <gtest/gtest.h>
+
+class SimulatorDomainTests: public ::testing::Test {
+protected:
+    friend class Simulator;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+namespace {
+    /**
+     * Holds as soon as one Airplane is landing
+     */
+    class LandingCondition: public SimulationCondition {
+    public:
+        virtual bool holds(const Simulator& simulator) const {
+            const AirplaneMap& airplanes = simulator.getAirport()->getAirplanes();
+            for (AirplaneMap::const_iterator it_airplane = airplanes.begin(); it_airplane != airplanes.end(); it_airplane++) {
+                if (it_airplane->second->getStatus() == AirplaneEnums::kStatus_Landing) return true;
+            }
+            return false;
+        }
+    };
+}
+
+TEST_F(SimulatorDomainTests, stepping) {
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/1/input.xml");
+    ASSERT_EQ(pairResult.first, ParseEnum::kSuccess);
+    Airport* airport = pairResult.second.begin()->second;
+
+    std::ostringstream plainOutput, plainError, plainTower, plainFloorplan;
+    Simulator plainSimulator(airport, plainOutput, plainError, plainTower, plainFloorplan);
+    plainSimulator.Simulate();
+    EXPECT_TRUE(plainSimulator.isStopped());
+    EXPECT_TRUE(plainSimulator.isFinished());
+    EXPECT_DEATH(plainSimulator.step(), "Simulation is already finished.");
+
+    std::ostringstream steppedOutput, steppedError, steppedTower, steppedFloorplan;
+    Simulator steppedSimulator(airport, steppedOutput, steppedError, steppedTower, steppedFloorplan);
+    EXPECT_EQ(steppedSimulator.getTimer(), static_cast<unsigned int>(0));
+    EXPECT_FALSE(steppedSimulator.isStopped());
+
+    EXPECT_EQ(steppedSimulator.step(), static_cast<unsigned int>(1));
+    EXPECT_EQ(steppedSimulator.getTimer(), static_cast<unsigned int>(2));
+    EXPECT_EQ(steppedSimulator.step(3), static_cast<unsigned int>(3));
+    EXPECT_EQ(steppedSimulator.getTimer(), static_cast<unsigned int>(5));
+
+    // the renderers are run at the end of every tick, the output so far is a prefix of the complete output
+    EXPECT_EQ(plainOutput.str().compare(0, steppedOutput.str().size(), steppedOutput.str()), 0);
+
+    EXPECT_EQ(steppedSimulator.runUntilTime(10), static_cast<unsigned int>(5));
+    EXPECT_EQ(steppedSimulator.getTimer(), static_cast<unsigned int>(10));
+    EXPECT_EQ(steppedSimulator.runUntilTime(4), static_cast<unsigned int>(0));
+
+    LandingCondition landing;
+    steppedSimulator.runUntil(landing);
+    ASSERT_FALSE(steppedSimulator.isStopped());
+    EXPECT_TRUE(landing.holds(steppedSimulator));
+    EXPECT_EQ(steppedSimulator.runUntil(landing), static_cast<unsigned int>(0));
+
+    while (steppedSimulator.step(7) == 7) {}
+    EXPECT_TRUE(steppedSimulator.isStopped());
+    EXPECT_EQ(steppedSimulator.step(), static_cast<unsigned int>(0));
+    EXPECT_FALSE(steppedSimulator.isFinished());
+    steppedSimulator.finish();
+
+    EXPECT_EQ(steppedSimulator.getTimer(), plainSimulator.getTimer());
+    EXPECT_EQ(steppedOutput.str(), plainOutput.str());
+    EXPECT_EQ(steppedError.str(), plainError.str());
+    EXPECT_EQ(steppedTower.str(), plainTower.str());
+    EXPECT_EQ(steppedFloorplan.str(), plainFloorplan.str());
+
+    delete airport;
+}
+
+TEST_F(SimulatorDomainTests, tickLimit) {
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/1/input.xml");
+    ASSERT_EQ(pairResult.first, ParseEnum::kSuccess);
+    Airport* airport = pairResult.second.begin()->second;
+
+    std::ostringstream errorStream;
+    Simulator simulator(airport, errorStream);
+    simulator.setTickLimit(20);
+    EXPECT_EQ(simulator.step(100), static_cast<unsigned int>(20));
+    EXPECT_TRUE(simulator.isStopped());
+    EXPECT_EQ(simulator.getTimer(), static_cast<unsigned int>(21));
+    simulator.finish();
+    EXPECT_DEATH(simulator.finish(), "Simulation is already finished.");
+
+    delete airport;
+}
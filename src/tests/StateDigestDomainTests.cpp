@@ -0,0 +1,77 @@
+#include "../classes/Airport.h"
+#include "../classes/Simulator.h"
+#include "../classes/StateDigest.h"
+#include "../parser/Parser.h"
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+
+class StateDigestDomainTests: public ::testing::Test {
+protected:
+    friend class StateDigest;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(StateDigestDomainTests, divergence) {
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/1/input.xml");
+    ASSERT_EQ(pairResult.first, ParseEnum::kSuccess);
+    Airport* airport = pairResult.second.begin()->second;
+
+    std::ostringstream firstDigests, firstStates;
+    StateDigest firstDigest(firstDigests, &firstStates);
+    std::ostringstream firstError;
+    Simulator firstSimulator(airport, firstError);
+    firstSimulator.setStateDigest(&firstDigest);
+    firstSimulator.Simulate();
+
+    std::ostringstream secondDigests;
+    StateDigest secondDigest(secondDigests);
+    std::ostringstream secondError;
+    Simulator secondSimulator(airport, secondError);
+    secondSimulator.setStateDigest(&secondDigest);
+    secondSimulator.Simulate();
+
+    ASSERT_GT(firstDigest.getTicks(), static_cast<unsigned long>(2));
+    EXPECT_EQ(firstDigests.str().size(), firstDigest.getTicks() * StateDigest::kLineLength);
+    EXPECT_EQ(firstDigests.str(), secondDigests.str());
+
+    unsigned int tick = 0;
+    std::istringstream first(firstDigests.str());
+    std::istringstream second(secondDigests.str());
+    EXPECT_FALSE(StateDigest::findDivergence(first, second, tick));
+
+    // a different digest from the third tick on, as a chained digest stream would have
+    const std::string firstText = firstDigests.str();
+    std::string diverged = firstText;
+    for (unsigned long index = 2; index < firstDigest.getTicks(); index++) {
+        char& digit = diverged[(index + 1) * StateDigest::kLineLength - 2];
+        digit = (digit == '0' ? '1' : '0');
+    }
+    const unsigned int thirdTick = std::atoi(firstText.substr(2 * StateDigest::kLineLength, 10).c_str());
+
+    std::istringstream divergedStream(diverged);
+    ASSERT_TRUE(StateDigest::findDivergence(first, divergedStream, tick));
+    EXPECT_EQ(tick, thirdTick);
+
+    // a stream that stops early diverges at the first tick it is missing
+    std::istringstream truncatedStream(firstText.substr(0, 2 * StateDigest::kLineLength));
+    ASSERT_TRUE(StateDigest::findDivergence(first, truncatedStream, tick));
+    EXPECT_EQ(tick, thirdTick);
+
+    std::istringstream states(firstStates.str());
+    std::ostringstream state;
+    ASSERT_TRUE(StateDigest::extractState(states, tick, state));
+    EXPECT_NE(state.str().find("airplane "), std::string::npos);
+    EXPECT_FALSE(StateDigest::extractState(states, 1000000, state));
+
+    delete airport;
+}
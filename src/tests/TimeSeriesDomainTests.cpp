@@ -0,0 +1,121 @@
+#include "../classes/Airport.h"
+#include "../classes/Simulator.h"
+#include "../classes/TimeSeries.h"
+#include "../parser/Parser.h"
+
+#include <gtest/gtest.h>
+
+class TimeSeriesDomainTests: public ::testing::Test {
+protected:
+    friend class TimeSeriesWriter;
+    friend class TimeSeriesReader;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(TimeSeriesDomainTests, roundTrip) {
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/2/input.xml");
+    ASSERT_EQ(pairResult.first, ParseEnum::kSuccess);
+    Airport* airport = pairResult.second.begin()->second;
+
+    std::ostringstream file;
+    TimeSeriesWriter writer(file);
+    EXPECT_DEATH(writer.changeStatus(AirplaneEnums::kStatus_Approaching, static_cast<AirplaneEnums::EStatus>(AirplaneEnums::kStatusCount)), "Status is out of range.");
+
+    std::ostringstream errorStream;
+    Simulator simulator(airport, errorStream);
+    simulator.setTickLimit(3000);
+    simulator.setTimeSeries(&writer);
+
+    // the incremental status counts match a scan of the airplanes after every tick
+    while (simulator.step() == 1) {
+        std::vector<unsigned long> scanned(AirplaneEnums::kStatusCount, 0);
+        for (AirplaneMap::const_iterator it_airplane = simulator.getAirport()->getAirplanes().begin(); it_airplane != simulator.getAirport()->getAirplanes().end(); it_airplane++) {
+            scanned[it_airplane->second->getStatus()]++;
+        }
+        for (unsigned int status = 0; status < AirplaneEnums::kStatusCount; status++) {
+            ASSERT_EQ(writer.getStatusCount(static_cast<AirplaneEnums::EStatus>(status)), scanned[status]) << simulator.getTimer();
+        }
+    }
+    simulator.finish();
+    writer.close();
+    EXPECT_DEATH(writer.record(1, airport), "TimeSeriesWriter is already closed.");
+
+    const unsigned long rows = writer.getRows();
+    ASSERT_GT(rows, static_cast<unsigned long>(0));
+    // less than half of what 32 bit columns would take, the header included
+    EXPECT_LT(file.str().size(), rows * TimeSeriesWriter::getColumnNames().size() * 4 / 2);
+
+    std::istringstream stream(file.str());
+    TimeSeriesReader reader(stream);
+    ASSERT_TRUE(reader.isValid());
+    EXPECT_EQ(reader.getColumns(), TimeSeriesWriter::getColumnNames());
+
+    std::vector<unsigned long> ticks;
+    ASSERT_TRUE(reader.readColumn("tick", ticks));
+    ASSERT_EQ(ticks.size(), rows);
+    for (unsigned long row = 0; row < rows; row++) EXPECT_EQ(ticks[row], row + 1);
+
+    std::vector<unsigned long> holding, waitPattern;
+    ASSERT_TRUE(reader.readColumn("holding", holding));
+    ASSERT_TRUE(reader.readColumn("FlyingWaitPattern", waitPattern));
+    EXPECT_EQ(holding, waitPattern);
+
+    std::vector<unsigned long> unknown;
+    EXPECT_FALSE(reader.readColumn("unknown", unknown));
+
+    std::ostringstream csv;
+    ASSERT_TRUE(reader.writeCsv(csv));
+    std::istringstream csvLines(csv.str());
+    std::string line;
+    std::getline(csvLines, line);
+    EXPECT_EQ(line.find("tick,airborne,holding,taxiing,gates,freeRunways,Approaching,"), static_cast<std::string::size_type>(0));
+    unsigned long lines = 0;
+    while (std::getline(csvLines, line)) lines++;
+    EXPECT_EQ(lines, rows);
+
+    // a file cut off in the middle of a block is reported as damaged
+    std::istringstream truncated(file.str().substr(0, file.str().size() / 2));
+    TimeSeriesReader truncatedReader(truncated);
+    ASSERT_TRUE(truncatedReader.isValid());
+    std::ostringstream truncatedCsv;
+    EXPECT_FALSE(truncatedReader.writeCsv(truncatedCsv));
+
+    // several blocks, every block decodes on its own
+    std::ostringstream blocksFile;
+    TimeSeriesWriter blocksWriter(blocksFile);
+    blocksWriter.countAirport(airport);
+    const unsigned long blockRows = 2 * TimeSeriesWriter::kBlockRows + 5;
+    for (unsigned long row = 0; row < blockRows; row++) {
+        if (row % 3 == 0) blocksWriter.changeStatus(AirplaneEnums::kStatus_Approaching, AirplaneEnums::kStatus_Landing);
+        if (row % 3 == 2) blocksWriter.changeStatus(AirplaneEnums::kStatus_Landing, AirplaneEnums::kStatus_Approaching);
+        blocksWriter.record(row * 7, airport);
+    }
+    blocksWriter.close();
+
+    std::istringstream blocksStream(blocksFile.str());
+    TimeSeriesReader blocksReader(blocksStream);
+    std::vector<unsigned long> blockTicks, landing;
+    ASSERT_TRUE(blocksReader.readColumn("tick", blockTicks));
+    ASSERT_TRUE(blocksReader.readColumn("Landing", landing));
+    ASSERT_EQ(blockTicks.size(), blockRows);
+    ASSERT_EQ(landing.size(), blockRows);
+    for (unsigned long row = 0; row < blockRows; row++) {
+        EXPECT_EQ(blockTicks[row], row * 7);
+        EXPECT_EQ(landing[row], (row % 3 == 2 ? 0u : 1u) + landing[0] - 1);
+    }
+
+    std::istringstream invalid("not a time series");
+    TimeSeriesReader invalidReader(invalid);
+    EXPECT_FALSE(invalidReader.isValid());
+
+    delete airport;
+}
@@ -0,0 +1,84 @@
+#include "../classes/Airport.h"
+#include "../classes/Simulator.h"
+#include "../classes/TraceWriter.h"
+#include "../parser/Parser.h"
+
+#include <gtest/gtest.h>
+
+class TraceWriterDomainTests: public ::testing::Test {
+protected:
+    friend class TraceWriter;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(TraceWriterDomainTests, format) {
+    std::ostringstream stream;
+    TraceWriter trace(stream);
+
+    const unsigned long long start = getMonotonicNanoseconds();
+    trace.beginTrack("main \"track\"");
+    trace.span("tick", "simulation", start, start + 1500, "[Monday 12:01]");
+
+    std::map<std::string, unsigned long> values;
+    values["active"] = 3;
+    values["waiting"] = 1;
+    trace.counter("airplanes", start, values);
+
+    EXPECT_FALSE(trace.isClosed());
+    trace.close();
+    EXPECT_TRUE(trace.isClosed());
+
+    const std::string json = stream.str();
+    EXPECT_EQ(json.find("{\"traceEvents\":["), static_cast<std::string::size_type>(0));
+    EXPECT_NE(json.find("\"name\":\"main \\\"track\\\"\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"X\",\"name\":\"tick\""), std::string::npos);
+    EXPECT_NE(json.find("\"dur\":1.500"), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"active\":3,\"waiting\":1}"), std::string::npos);
+    EXPECT_EQ(json.substr(json.size() - 4), "\n]}\n");
+
+    EXPECT_DEATH(trace.span("late", "simulation", start, start), "TraceWriter is already closed.");
+}
+
+TEST_F(TraceWriterDomainTests, tracedSimulation) {
+    std::ostringstream stream;
+    TraceWriter trace(stream);
+
+    std::ostringstream parserStream;
+    Parser parser = Parser(parserStream);
+    trace.beginTrack("parser");
+    parser.setTrace(&trace);
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport*> > pairResult = parser.parseFile("./outputTests/1/input.xml");
+    ASSERT_EQ(pairResult.first, ParseEnum::kSuccess);
+    Airport* airport = pairResult.second.begin()->second;
+
+    std::ostringstream plainOutput, plainError, plainTower, plainFloorplan;
+    Simulator plainSimulator(airport, plainOutput, plainError, plainTower, plainFloorplan);
+    plainSimulator.Simulate();
+
+    std::ostringstream tracedOutput, tracedError, tracedTower, tracedFloorplan;
+    Simulator tracedSimulator(airport, tracedOutput, tracedError, tracedTower, tracedFloorplan);
+    trace.beginTrack("simulation");
+    tracedSimulator.setTrace(&trace);
+    tracedSimulator.Simulate();
+    trace.close();
+
+    EXPECT_EQ(tracedOutput.str(), plainOutput.str());
+    EXPECT_EQ(tracedTower.str(), plainTower.str());
+
+    const std::string json = stream.str();
+    EXPECT_NE(json.find("\"name\":\"parseFile\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"AIRPLANE\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Airport copy\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"tick\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Approaching\",\"cat\":\"handler\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"C\",\"name\":\"queues\""), std::string::npos);
+
+    delete airport;
+}
@@ -0,0 +1,76 @@
+#include "../utils/WorkStealingPool.h"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+namespace {
+    class CountingJob: public PoolJob {
+    public:
+        unsigned int runs;
+        unsigned int thread;
+        unsigned int sleep;
+
+        CountingJob(const unsigned int _sleep = 0) : runs(0), thread(0), sleep(_sleep) {}
+
+        void run(const unsigned int _thread) {
+            if (sleep > 0) usleep(sleep);
+            thread = _thread;
+            runs++;
+        }
+    };
+}
+
+class WorkStealingPoolDomainTests: public ::testing::Test {
+protected:
+    friend class WorkStealingPool;
+
+    virtual void SetUp() {
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    };
+
+    virtual void TearDown() {
+
+    };
+};
+
+TEST_F(WorkStealingPoolDomainTests, everyJobRunsOnce) {
+    WorkStealingPool pool(4);
+    EXPECT_EQ(pool.getThreadCount(), static_cast<unsigned int>(4));
+    EXPECT_FALSE(pool.hasRun());
+
+    std::vector<CountingJob> jobs(100);
+    for (unsigned int i = 0; i < jobs.size(); i++) {
+        pool.submit(&jobs[i]);
+    }
+    pool.run();
+
+    EXPECT_TRUE(pool.hasRun());
+    for (unsigned int i = 0; i < jobs.size(); i++) {
+        EXPECT_EQ(jobs[i].runs, static_cast<unsigned int>(1));
+        EXPECT_LT(jobs[i].thread, static_cast<unsigned int>(4));
+    }
+
+    CountingJob late;
+    EXPECT_DEATH(pool.submit(&late), "WorkStealingPool has already run.");
+    EXPECT_DEATH(pool.run(), "WorkStealingPool has already run.");
+}
+
+TEST_F(WorkStealingPoolDomainTests, idleThreadSteals) {
+    WorkStealingPool pool(2);
+
+    // the first thread is busy with the long job, the second one takes its quick jobs
+    CountingJob longJob(200000);
+    std::vector<CountingJob> quickJobs(20);
+    pool.submit(&longJob);
+    for (unsigned int i = 0; i < quickJobs.size(); i++) {
+        pool.submit(&quickJobs[i]);
+    }
+    pool.run();
+
+    EXPECT_EQ(longJob.thread, static_cast<unsigned int>(0));
+    EXPECT_GT(pool.getStolen(), static_cast<unsigned long>(0));
+    for (unsigned int i = 0; i < quickJobs.size(); i++) {
+        EXPECT_EQ(quickJobs[i].runs, static_cast<unsigned int>(1));
+        EXPECT_EQ(quickJobs[i].thread, static_cast<unsigned int>(1));
+    }
+}
@@ -0,0 +1,173 @@
+#include "MonteCarlo.h"
+#include "WorkStealingPool.h"
+#include "../classes/Simulator.h"
+#include "../classes/OperationalStatistics.h"
+#include "../classes/TimingPerturbation.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <math.h>
+
+namespace {
+    class ReplicationJob: public PoolJob {
+    public:
+        const Airport* airport;
+        unsigned long long seed;
+        const MonteCarloOptions& options;
+        ReplicationResult result;
+
+        ReplicationJob(const Airport* _airport, const unsigned long long _seed, const MonteCarloOptions& _options)
+                : airport(_airport), seed(_seed), options(_options), result() {}
+
+        void run(const unsigned int) {
+            result = MonteCarloRunner::replicate(airport, seed, options.spread, options.tickLimit);
+        }
+    };
+
+    /**
+     * Writes one row of the report, values is sorted in place
+     */
+    void reportMetric(std::ostream& stream, const std::string& name, std::vector<double>& values) {
+        std::sort(values.begin(), values.end());
+        const unsigned long count = values.size();
+
+        double sum = 0;
+        for (std::vector<double>::const_iterator it_value = values.begin(); it_value != values.end(); it_value++) sum += *it_value;
+        const double mean = sum / count;
+
+        double squares = 0;
+        for (std::vector<double>::const_iterator it_value = values.begin(); it_value != values.end(); it_value++) squares += (*it_value - mean) * (*it_value - mean);
+        const double deviation = (count > 1 ? sqrt(squares / (count - 1)) : 0);
+        const double halfWidth = 1.96 * deviation / sqrt(static_cast<double>(count));
+
+        // nearest rank percentiles
+        const double p5 = values[static_cast<unsigned long>(ceil(0.05 * count)) - 1];
+        const double p50 = values[static_cast<unsigned long>(ceil(0.50 * count)) - 1];
+        const double p95 = values[static_cast<unsigned long>(ceil(0.95 * count)) - 1];
+
+        stream << std::left << std::setw(16) << name << std::right
+               << std::setw(10) << mean << std::setw(10) << deviation
+               << std::setw(10) << mean - halfWidth << std::setw(10) << mean + halfWidth
+               << std::setw(10) << values.front() << std::setw(10) << p5 << std::setw(10) << p50 << std::setw(10) << p95
+               << std::setw(10) << values.back() << std::endl;
+    }
+}
+
+MonteCarloOptions::MonteCarloOptions() : replications(100), seed(1), spread(0.2), threads(0), tickLimit(11520) {}
+
+ReplicationResult::ReplicationResult()
+        : seed(0),
+          ticks(0),
+          finished(false),
+          crashed(0),
+          left(0),
+          holding(0),
+          taxiWait(0),
+          crossingWait(0),
+          gateTime(0) {}
+
+bool MonteCarloRunner::properlyInitialized() const {
+    return this == init;
+}
+
+MonteCarloRunner::MonteCarloRunner(const MonteCarloOptions& _options) : options(_options), init(this) {
+    REQUIRE(_options.replications > 0, "At least one replication is needed.");
+    REQUIRE(_options.spread >= 0 && _options.spread < 1, "Spread must be at least 0 and below 1.");
+    ENSURE(properlyInitialized(), "MonteCarloRunner was not properly initialized.");
+}
+
+ReplicationResult MonteCarloRunner::replicate(const Airport* airport, const unsigned long long seed, const double spread, const unsigned int tickLimit) {
+    REQUIRE(airport != NULL, "Airport can not be NULL.");
+
+    TimingPerturbation perturbation(seed, spread);
+    OperationalStatistics statistics;
+
+    std::ostringstream errorStream;
+    Simulator simulator(airport, errorStream);
+    simulator.setRecordEvents(false);
+    simulator.setTickLimit(tickLimit);
+    simulator.setPerturbation(&perturbation);
+    simulator.setStatistics(&statistics);
+    simulator.Simulate();
+
+    ReplicationResult result;
+    result.seed = seed;
+    result.ticks = statistics.getTicks();
+    result.finished = simulator.SimulationFinished();
+
+    const AirplaneMap& airplanes = simulator.getAirport()->getAirplanes();
+    for (AirplaneMap::const_iterator it_airplane = airplanes.begin(); it_airplane != airplanes.end(); it_airplane++) {
+        if (it_airplane->second->getStatus() == AirplaneEnums::kStatus_Crashed) result.crashed++;
+        if (it_airplane->second->getStatus() == AirplaneEnums::kStatus_LeftAirport) result.left++;
+
+        const AirplaneStatistics* airplane = statistics.getAirplane(it_airplane->first);
+        if (airplane == NULL) continue;
+        result.holding += airplane->getHoldingTime();
+        result.taxiWait += airplane->getTaxiWaitTime();
+        result.crossingWait += airplane->getCrossingWaitTime();
+        result.gateTime += airplane->gateTime;
+    }
+
+    if (!airplanes.empty()) {
+        result.holding /= airplanes.size();
+        result.taxiWait /= airplanes.size();
+        result.crossingWait /= airplanes.size();
+        result.gateTime /= airplanes.size();
+    }
+    return result;
+}
+
+std::vector<ReplicationResult> MonteCarloRunner::run(const Airport* airport) const {
+    REQUIRE(properlyInitialized(), "MonteCarloRunner was not properly initialized.");
+    REQUIRE(airport != NULL, "Airport can not be NULL.");
+
+    WorkStealingPool pool(options.threads);
+    std::vector<ReplicationJob*> jobs;
+    for (unsigned int replication = 0; replication < options.replications; replication++) {
+        jobs.push_back(new ReplicationJob(airport, options.seed + replication, options));
+        pool.submit(jobs.back());
+    }
+    pool.run();
+
+    std::vector<ReplicationResult> results;
+    for (std::vector<ReplicationJob*>::iterator it_job = jobs.begin(); it_job != jobs.end(); it_job++) {
+        results.push_back((*it_job)->result);
+        delete *it_job;
+    }
+    return results;
+}
+
+void MonteCarloRunner::report(const std::vector<ReplicationResult>& results, std::ostream& stream) {
+    REQUIRE(!results.empty(), "There are no replications to report.");
+
+    unsigned long finished = 0;
+    std::vector<double> ticks, crashed, left, holding, taxiWait, crossingWait, gateTime;
+    for (std::vector<ReplicationResult>::const_iterator it_result = results.begin(); it_result != results.end(); it_result++) {
+        if (it_result->finished) finished++;
+        ticks.push_back(it_result->ticks);
+        crashed.push_back(it_result->crashed);
+        left.push_back(it_result->left);
+        holding.push_back(it_result->holding);
+        taxiWait.push_back(it_result->taxiWait);
+        crossingWait.push_back(it_result->crossingWait);
+        gateTime.push_back(it_result->gateTime);
+    }
+
+    stream << std::fixed << std::setprecision(2);
+    stream << "Monte Carlo over " << results.size() << " replications, seeds " << results.front().seed << " to " << results.back().seed << std::endl;
+    stream << finished << " of " << results.size() << " replications finished before the tick limit" << std::endl << std::endl;
+
+    stream << std::left << std::setw(16) << "Metric" << std::right << std::setw(10) << "mean" << std::setw(10) << "stddev"
+           << std::setw(10) << "95% low" << std::setw(10) << "95% high" << std::setw(10) << "min" << std::setw(10) << "p5"
+           << std::setw(10) << "median" << std::setw(10) << "p95" << std::setw(10) << "max" << std::endl;
+    reportMetric(stream, "minutes", ticks);
+    reportMetric(stream, "crashed", crashed);
+    reportMetric(stream, "left airport", left);
+    reportMetric(stream, "holding", holding);
+    reportMetric(stream, "taxi wait", taxiWait);
+    reportMetric(stream, "crossing wait", crossingWait);
+    reportMetric(stream, "at gate", gateTime);
+
+    stream << std::resetiosflags(std::ios::fixed) << std::setprecision(6);
+}
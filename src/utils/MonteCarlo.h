@@ -0,0 +1,94 @@
+#ifndef INC_MONTECARLO_H
+#define INC_MONTECARLO_H
+
+#include "../lib/DesignByContract.h"
+#include "../classes/Airport.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * The replication count, the seed of the first replication, the spread of the TimingPerturbation, the number of pool
+ * threads (0 is one per online CPU) and the tick limit of every replication
+ */
+struct MonteCarloOptions {
+    unsigned int replications;
+    unsigned long long seed;
+    double spread;
+    unsigned int threads;
+    unsigned int tickLimit;
+
+    MonteCarloOptions();
+};
+
+/**
+ * The outcome of one replication, the times are the means over all Airplanes in minutes
+ */
+struct ReplicationResult {
+    unsigned long long seed;
+    unsigned int ticks;
+    bool finished;
+    unsigned long crashed;
+    unsigned long left;
+    double holding;
+    double taxiWait;
+    double crossingWait;
+    double gateTime;
+
+    ReplicationResult();
+};
+
+/**
+ * Runs independent replications of an Airport on a WorkStealingPool, every replication simulates its own copy of the
+ * Airport with its own TimingPerturbation seed and without rendering. \n
+ * The report gives the distribution of every metric over the replications.
+ */
+class MonteCarloRunner {
+private:
+    MonteCarloOptions options;
+
+    const MonteCarloRunner* init;
+
+    bool properlyInitialized() const;
+
+    MonteCarloRunner(const MonteCarloRunner&);
+
+    MonteCarloRunner& operator=(const MonteCarloRunner&);
+
+public:
+    /**
+     * PRE: \n
+     * REQUIRE(_options.replications > 0, "At least one replication is needed."); \n
+     * REQUIRE(_options.spread >= 0 && _options.spread < 1, "Spread must be at least 0 and below 1."); \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "MonteCarloRunner was not properly initialized.");
+     */
+    MonteCarloRunner(const MonteCarloOptions& _options);
+
+    /**
+     * Simulates one replication with the seed, it only reads the Airport \n
+     * PRE: \n
+     * REQUIRE(airport != NULL, "Airport can not be NULL.");
+     */
+    static ReplicationResult replicate(const Airport* airport, const unsigned long long seed, const double spread, const unsigned int tickLimit);
+
+    /**
+     * Runs every replication, replication i has seed options.seed + i \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "MonteCarloRunner was not properly initialized."); \n
+     * REQUIRE(airport != NULL, "Airport can not be NULL.");
+     * @return the results in seed order
+     */
+    std::vector<ReplicationResult> run(const Airport* airport) const;
+
+    /**
+     * Writes mean, standard deviation, 95% confidence interval of the mean, minimum, percentiles and maximum of every
+     * metric, the interval uses the normal approximation \n
+     * PRE: \n
+     * REQUIRE(!results.empty(), "There are no replications to report.");
+     */
+    static void report(const std::vector<ReplicationResult>& results, std::ostream& stream);
+};
+
+#endif
@@ -0,0 +1,335 @@
+#include "ParameterSweep.h"
+#include "Utils.h"
+#include "WorkStealingPool.h"
+
+#include <iomanip>
+#include <sstream>
+
+namespace {
+    const unsigned int kTypeCount = AirplaneEnums::kType_Emergency + 1;
+
+    class SweepJob: public PoolJob {
+    public:
+        const Airport* airport;
+        const SweepPoint& point;
+        unsigned int tickLimit;
+        SweepResult result;
+
+        SweepJob(const Airport* _airport, const SweepPoint& _point, const unsigned int _tickLimit)
+                : airport(_airport), point(_point), tickLimit(_tickLimit), result() {}
+
+        void run(const unsigned int) {
+            Airport* variant = ParameterSweep::buildVariant(airport, point);
+            result.point = point;
+            result.airplanes = variant->getAirplanes().size();
+            // without spread a replication is the plain simulation
+            result.metrics = MonteCarloRunner::replicate(variant, 0, 0, tickLimit);
+            delete variant;
+        }
+    };
+
+    /**
+     * @return the Approaching airplanes, in registration order
+     */
+    std::vector<const Airplane*> getArrivals(const Airport* airport) {
+        std::vector<const Airplane*> arrivals;
+        for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
+            if (it_airplane->second->getStatus() == AirplaneEnums::kStatus_Approaching) arrivals.push_back(it_airplane->second);
+        }
+        return arrivals;
+    }
+
+    /**
+     * A copy keeps the squawk of the original while no other Airplane of the variant uses it, otherwise it takes the
+     * next free code of the block of its combination
+     */
+    unsigned int takeSquawk(const Airplane* original, SquawkAllocator& squawks) {
+        const unsigned int block = original->getSquawkBlock();
+        if (block == 0 || !squawks.isHeld(original->getSquawk())) {
+            squawks.hold(original->getSquawk());
+            return original->getSquawk();
+        }
+        return squawks.take(block);
+    }
+
+    Airplane* copyArrival(const Airplane* original, const std::string& number, const unsigned int squawk) {
+        Airplane* airplane = new Airplane(number, original->getCallsign(), original->getModel(), squawk,
+                                          original->getAltitude(), original->getFuel(), original->getFuelCapacity(),
+                                          original->getPassengers(), original->getPassengerCapacity(), original->getStatus(),
+                                          original->getType(), original->getSize(), original->getEngine());
+        if (original->getAircraftType() != NULL) airplane->setAircraftType(original->getAircraftType());
+        return airplane;
+    }
+
+    bool parseNumber(const std::string& text, unsigned int& value) {
+        int number = 0;
+        if (text.empty() || !tryCastStringToInt(text, &number) || number < 0) return false;
+        value = number;
+        return true;
+    }
+}
+
+FleetMix::FleetMix() : privateWeight(0), airlineWeight(0), militaryWeight(0), emergencyWeight(0) {}
+
+unsigned int FleetMix::getWeight(const AirplaneEnums::EType type) const {
+    switch (type) {
+        case AirplaneEnums::kType_Private:
+            return privateWeight;
+        case AirplaneEnums::kType_Airline:
+            return airlineWeight;
+        case AirplaneEnums::kType_Military:
+            return militaryWeight;
+        case AirplaneEnums::kType_Emergency:
+            return emergencyWeight;
+        default:
+            return 0;
+    }
+}
+
+bool FleetMix::keepsBase() const {
+    return privateWeight + airlineWeight + militaryWeight + emergencyWeight == 0;
+}
+
+std::string FleetMix::getName() const {
+    if (keepsBase()) return "keep";
+
+    std::ostringstream name;
+    name << privateWeight << ":" << airlineWeight << ":" << militaryWeight << ":" << emergencyWeight;
+    return name.str();
+}
+
+bool FleetMix::parse(const std::string& text) {
+    if (text == "keep") {
+        *this = FleetMix();
+        return true;
+    }
+
+    std::vector<unsigned int> weights;
+    std::stringstream stream(text);
+    std::string weight;
+    while (std::getline(stream, weight, ':')) {
+        unsigned int value = 0;
+        if (!parseNumber(weight, value)) return false;
+        weights.push_back(value);
+    }
+    if (weights.size() != 4 || weights[0] + weights[1] + weights[2] + weights[3] == 0) return false;
+
+    privateWeight = weights[0];
+    airlineWeight = weights[1];
+    militaryWeight = weights[2];
+    emergencyWeight = weights[3];
+    return true;
+}
+
+SweepPoint::SweepPoint() : gates(0), runwayLength(100), runwayType(RunwayEnums::kInvalidType), mix(), arrivals(100) {}
+
+SweepRanges::SweepRanges()
+        : gates(1, 0),
+          runwayLengths(1, 100),
+          runwayTypes(1, RunwayEnums::kInvalidType),
+          mixes(1, FleetMix()),
+          arrivals(1, 100) {}
+
+std::vector<SweepPoint> SweepRanges::getPoints() const {
+    std::vector<SweepPoint> points;
+    SweepPoint point;
+    for (unsigned long i_gates = 0; i_gates < gates.size(); i_gates++) {
+        point.gates = gates[i_gates];
+        for (unsigned long i_length = 0; i_length < runwayLengths.size(); i_length++) {
+            point.runwayLength = runwayLengths[i_length];
+            for (unsigned long i_type = 0; i_type < runwayTypes.size(); i_type++) {
+                point.runwayType = runwayTypes[i_type];
+                for (unsigned long i_mix = 0; i_mix < mixes.size(); i_mix++) {
+                    point.mix = mixes[i_mix];
+                    for (unsigned long i_arrivals = 0; i_arrivals < arrivals.size(); i_arrivals++) {
+                        point.arrivals = arrivals[i_arrivals];
+                        points.push_back(point);
+                    }
+                }
+            }
+        }
+    }
+    return points;
+}
+
+SweepResult::SweepResult() : point(), airplanes(0), metrics() {}
+
+bool ParameterSweep::properlyInitialized() const {
+    return this == init;
+}
+
+ParameterSweep::ParameterSweep(const unsigned int _threads, const unsigned int _tickLimit) : threads(_threads), tickLimit(_tickLimit), init(this) {
+    ENSURE(properlyInitialized(), "ParameterSweep was not properly initialized.");
+}
+
+bool ParameterSweep::parseRange(const std::string& text, std::vector<unsigned int>& values) {
+    std::vector<unsigned int> parsed;
+    std::stringstream stream(text);
+    std::string value;
+
+    while (std::getline(stream, value, ',')) {
+        const std::string::size_type dash = value.find('-');
+        if (dash == std::string::npos) {
+            unsigned int number = 0;
+            if (!parseNumber(value, number)) return false;
+            parsed.push_back(number);
+            continue;
+        }
+
+        const std::string::size_type slash = value.find('/', dash);
+        unsigned int from = 0, to = 0, step = 1;
+        if (!parseNumber(value.substr(0, dash), from)) return false;
+        if (!parseNumber(value.substr(dash + 1, slash == std::string::npos ? std::string::npos : slash - dash - 1), to)) return false;
+        if (slash != std::string::npos && !parseNumber(value.substr(slash + 1), step)) return false;
+        if (from > to || step == 0) return false;
+
+        for (unsigned int number = from; number <= to; number += step) {
+            parsed.push_back(number);
+            if (to - number < step) break;
+        }
+    }
+
+    if (parsed.empty()) return false;
+    values = parsed;
+    return true;
+}
+
+unsigned long ParameterSweep::getMinimumGates(const Airport* airport) {
+    const AirplaneVector& gates = airport->getGates();
+    for (unsigned long gate = gates.size(); gate > 0; gate--) {
+        if (gates[gate - 1] != NULL) return gate;
+    }
+    return 0;
+}
+
+unsigned long ParameterSweep::getArrivalCount(const Airport* airport, const unsigned int arrivals) {
+    return (static_cast<unsigned long>(getArrivals(airport).size()) * arrivals + 50) / 100;
+}
+
+bool ParameterSweep::canDraw(const Airport* airport, const FleetMix& mix) {
+    if (mix.keepsBase()) return true;
+
+    const std::vector<const Airplane*> arrivals = getArrivals(airport);
+    if (arrivals.empty()) return true;
+    for (std::vector<const Airplane*>::const_iterator it_arrival = arrivals.begin(); it_arrival != arrivals.end(); it_arrival++) {
+        if (mix.getWeight((*it_arrival)->getType()) > 0) return true;
+    }
+    return false;
+}
+
+Airport* ParameterSweep::buildVariant(const Airport* airport, const SweepPoint& point) {
+    REQUIRE(airport != NULL, "Airport can not be NULL.");
+    REQUIRE(point.runwayLength > 0, "Runways can not be shortened to nothing.");
+    REQUIRE(point.gates == 0 || point.gates >= getMinimumGates(airport), "The gate count can not drop below the gates in use.");
+    REQUIRE(point.arrivals == 0 || canDraw(airport, point.mix), "The base scenario has no arrivals of the fleet mix.");
+
+    Airport* variant = new Airport(airport);
+    if (point.gates != 0) variant->setGateCount(point.gates);
+
+    for (RunwayMap::iterator it_runway = variant->getRunways().begin(); it_runway != variant->getRunways().end(); it_runway++) {
+        Runway* runway = it_runway->second;
+        runway->setLength(static_cast<unsigned int>(static_cast<unsigned long long>(runway->getLength()) * point.runwayLength / 100));
+        if (point.runwayType != RunwayEnums::kInvalidType) runway->setType(point.runwayType);
+    }
+
+    const std::vector<const Airplane*> arrivals = getArrivals(airport);
+    if (point.mix.keepsBase() && point.arrivals == 100) return variant;
+
+    for (std::vector<const Airplane*>::const_iterator it_arrival = arrivals.begin(); it_arrival != arrivals.end(); it_arrival++) {
+        Airplane* airplane = variant->getAirplanesByRegistrationNumber((*it_arrival)->getNumber());
+        variant->removeAirplane(airplane);
+        delete airplane;
+    }
+
+    // the arrivals of every type, a mix that keeps the base draws from one pool
+    std::vector<std::vector<const Airplane*> > pools(kTypeCount);
+    for (std::vector<const Airplane*>::const_iterator it_arrival = arrivals.begin(); it_arrival != arrivals.end(); it_arrival++) {
+        const unsigned int type = (point.mix.keepsBase() ? 0 : (*it_arrival)->getType());
+        pools[type].push_back(*it_arrival);
+    }
+
+    std::vector<unsigned int> weights(kTypeCount, 0);
+    unsigned long totalWeight = 0;
+    for (unsigned int type = 0; type < kTypeCount; type++) {
+        if (pools[type].empty()) continue;
+        weights[type] = (point.mix.keepsBase() ? 1 : point.mix.getWeight(static_cast<AirplaneEnums::EType>(type)));
+        totalWeight += weights[type];
+    }
+
+    // smooth weighted round robin over the types, round robin within a type
+    const unsigned long count = getArrivalCount(airport, point.arrivals);
+    std::vector<long> credits(kTypeCount, 0);
+    std::vector<unsigned long> drawn(kTypeCount, 0);
+    std::map<std::string, unsigned int> copies;
+    SquawkAllocator squawks;
+    for (AirplaneMap::const_iterator it_airplane = variant->getAirplanes().begin(); it_airplane != variant->getAirplanes().end(); it_airplane++) {
+        squawks.hold(it_airplane->second->getSquawk());
+    }
+    for (unsigned long i = 0; i < count; i++) {
+        unsigned int chosen = 0;
+        for (unsigned int type = 0; type < kTypeCount; type++) {
+            credits[type] += weights[type];
+            if (weights[type] > 0 && (weights[chosen] == 0 || credits[type] > credits[chosen])) chosen = type;
+        }
+        credits[chosen] -= totalWeight;
+
+        const Airplane* original = pools[chosen][drawn[chosen] % pools[chosen].size()];
+        drawn[chosen]++;
+
+        const unsigned int copy = copies[original->getNumber()]++;
+        std::ostringstream number;
+        number << original->getNumber();
+        if (copy > 0) number << "-" << copy;
+
+        Airplane* airplane = copyArrival(original, number.str(), takeSquawk(original, squawks));
+        airplane->setAirport(variant);
+        variant->addAirplane(airplane);
+    }
+
+    return variant;
+}
+
+std::vector<SweepResult> ParameterSweep::run(const Airport* airport, const std::vector<SweepPoint>& points) const {
+    REQUIRE(properlyInitialized(), "ParameterSweep was not properly initialized.");
+    REQUIRE(airport != NULL, "Airport can not be NULL.");
+
+    WorkStealingPool pool(threads);
+    std::vector<SweepJob*> jobs;
+    for (std::vector<SweepPoint>::const_iterator it_point = points.begin(); it_point != points.end(); it_point++) {
+        jobs.push_back(new SweepJob(airport, *it_point, tickLimit));
+        pool.submit(jobs.back());
+    }
+    pool.run();
+
+    std::vector<SweepResult> results;
+    for (std::vector<SweepJob*>::iterator it_job = jobs.begin(); it_job != jobs.end(); it_job++) {
+        results.push_back((*it_job)->result);
+        delete *it_job;
+    }
+    return results;
+}
+
+void ParameterSweep::report(const std::vector<SweepResult>& results, std::ostream& stream) {
+    stream << std::fixed << std::setprecision(2);
+    stream << std::right << std::setw(6) << "Gates" << std::setw(8) << "Runway" << std::setw(9) << "Surface"
+           << std::setw(14) << "Mix" << std::setw(10) << "Arrivals" << std::setw(11) << "Airplanes" << std::setw(9) << "Minutes"
+           << std::setw(10) << "Finished" << std::setw(9) << "Crashed" << std::setw(6) << "Left" << std::setw(10) << "Holding"
+           << std::setw(11) << "Taxi wait" << std::setw(10) << "Crossing" << std::setw(10) << "At gate" << std::endl;
+
+    for (std::vector<SweepResult>::const_iterator it_result = results.begin(); it_result != results.end(); it_result++) {
+        const SweepPoint& point = it_result->point;
+        const ReplicationResult& metrics = it_result->metrics;
+        std::ostringstream gates;
+        if (point.gates == 0) gates << "keep";
+        else gates << point.gates;
+
+        stream << std::setw(6) << gates.str() << std::setw(7) << point.runwayLength << "%"
+               << std::setw(9) << (point.runwayType == RunwayEnums::kInvalidType ? "keep" : RunwayEnums::EnumToString(point.runwayType))
+               << std::setw(14) << point.mix.getName() << std::setw(9) << point.arrivals << "%" << std::setw(11) << it_result->airplanes
+               << std::setw(9) << metrics.ticks << std::setw(10) << (metrics.finished ? "yes" : "no") << std::setw(9) << metrics.crashed
+               << std::setw(6) << metrics.left << std::setw(10) << metrics.holding << std::setw(11) << metrics.taxiWait
+               << std::setw(10) << metrics.crossingWait << std::setw(10) << metrics.gateTime << std::endl;
+    }
+
+    stream << std::resetiosflags(std::ios::fixed) << std::setprecision(6);
+}
@@ -0,0 +1,171 @@
+#ifndef INC_PARAMETERSWEEP_H
+#define INC_PARAMETERSWEEP_H
+
+#include "../lib/DesignByContract.h"
+#include "../classes/Airport.h"
+#include "MonteCarlo.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Relative weights of the airplane types among the arrivals, all weights 0 keeps the arrivals of the base scenario
+ */
+struct FleetMix {
+    unsigned int privateWeight;
+    unsigned int airlineWeight;
+    unsigned int militaryWeight;
+    unsigned int emergencyWeight;
+
+    FleetMix();
+
+    unsigned int getWeight(const AirplaneEnums::EType type) const;
+
+    bool keepsBase() const;
+
+    /**
+     * "keep" or PRIVATE:AIRLINE:MILITARY:EMERGENCY
+     */
+    std::string getName() const;
+
+    /**
+     * Parses the format of getName
+     * @return false if the text is not a mix
+     */
+    bool parse(const std::string& text);
+};
+
+/**
+ * One configuration of the sweep, every field has a value that keeps the base scenario
+ */
+struct SweepPoint {
+    /**
+     * 0 keeps the gate count
+     */
+    unsigned long gates;
+
+    /**
+     * Every runway length in percent of its base length
+     */
+    unsigned int runwayLength;
+
+    /**
+     * kInvalidType keeps the runway types
+     */
+    RunwayEnums::EType runwayType;
+
+    FleetMix mix;
+
+    /**
+     * The number of arrivals in percent of the Approaching airplanes of the base scenario
+     */
+    unsigned int arrivals;
+
+    SweepPoint();
+};
+
+/**
+ * The values of every parameter, the sweep simulates every combination
+ */
+struct SweepRanges {
+    std::vector<unsigned long> gates;
+    std::vector<unsigned int> runwayLengths;
+    std::vector<RunwayEnums::EType> runwayTypes;
+    std::vector<FleetMix> mixes;
+    std::vector<unsigned int> arrivals;
+
+    /**
+     * Every range holds the value that keeps the base scenario
+     */
+    SweepRanges();
+
+    /**
+     * @return the combinations, the last parameter changes fastest
+     */
+    std::vector<SweepPoint> getPoints() const;
+};
+
+struct SweepResult {
+    SweepPoint point;
+    unsigned long airplanes;
+    ReplicationResult metrics;
+
+    SweepResult();
+};
+
+/**
+ * Builds the variant Airports of a sweep in memory from a parsed base Airport and simulates them on a
+ * WorkStealingPool. \n
+ * Arrivals are the Approaching airplanes of the base. A variant draws its arrivals from them by fleet mix, in
+ * registration order, and airplanes drawn more than once get a numbered registration. Airplanes that are not
+ * arriving are kept as they are.
+ */
+class ParameterSweep {
+private:
+    unsigned int threads;
+    unsigned int tickLimit;
+
+    const ParameterSweep* init;
+
+    bool properlyInitialized() const;
+
+    ParameterSweep(const ParameterSweep&);
+
+    ParameterSweep& operator=(const ParameterSweep&);
+
+public:
+    /**
+     * POST: \n
+     * ENSURE(properlyInitialized(), "ParameterSweep was not properly initialized.");
+     * @param _threads The number of pool threads, 0 is one per online CPU
+     */
+    ParameterSweep(const unsigned int _threads, const unsigned int _tickLimit);
+
+    /**
+     * Parses comma separated values, every value is a number or a range FROM-TO with an optional /STEP
+     * @return false if a value is not a number or a range, values is left unchanged then
+     */
+    static bool parseRange(const std::string& text, std::vector<unsigned int>& values);
+
+    /**
+     * @return the fewest gates that hold the airplanes that are at a gate in the base Airport
+     */
+    static unsigned long getMinimumGates(const Airport* airport);
+
+    /**
+     * @return the number of arrivals a variant with the load draws, in percent of the Approaching airplanes of the Airport
+     */
+    static unsigned long getArrivalCount(const Airport* airport, const unsigned int arrivals);
+
+    /**
+     * @return true if the base Airport has arrivals of a type the mix draws, a mix that keeps the base can always draw
+     */
+    static bool canDraw(const Airport* airport, const FleetMix& mix);
+
+    /**
+     * PRE: \n
+     * REQUIRE(airport != NULL, "Airport can not be NULL."); \n
+     * REQUIRE(point.runwayLength > 0, "Runways can not be shortened to nothing."); \n
+     * REQUIRE(point.gates == 0 || point.gates >= getMinimumGates(airport), "The gate count can not drop below the gates in use."); \n
+     * REQUIRE(point.arrivals == 0 || canDraw(airport, point.mix), "The base scenario has no arrivals of the fleet mix.");
+     * @return a new Airport the caller owns
+     */
+    static Airport* buildVariant(const Airport* airport, const SweepPoint& point);
+
+    /**
+     * Builds and simulates every point without rendering, the variants are deleted afterwards \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "ParameterSweep was not properly initialized."); \n
+     * REQUIRE(airport != NULL, "Airport can not be NULL.");
+     * @return the results in the order of the points
+     */
+    std::vector<SweepResult> run(const Airport* airport, const std::vector<SweepPoint>& points) const;
+
+    /**
+     * Writes one row per point
+     */
+    static void report(const std::vector<SweepResult>& results, std::ostream& stream);
+};
+
+#endif
@@ -0,0 +1,197 @@
+#include "PerfCounters.h"
+
+#include <iomanip>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+namespace PerfEnums {
+    #define ecounter(x) #x
+        const char* strECounter[] = { ECOUNTERS };
+    #undef ecounter
+
+    const char* EnumToString(ECounter f)
+    {
+        return strECounter[static_cast<int>(f)];
+    }
+}
+
+namespace {
+#ifdef __linux__
+    int openCounter(const PerfEnums::ECounter counter) {
+        struct perf_event_attr attributes;
+        memset(&attributes, 0, sizeof(attributes));
+        attributes.size = sizeof(attributes);
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        switch (counter) {
+            case PerfEnums::kCounter_Cycles:
+                attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+                break;
+            case PerfEnums::kCounter_Instructions:
+                attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+                break;
+            case PerfEnums::kCounter_CacheMisses:
+                attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+                break;
+            case PerfEnums::kCounter_BranchMisses:
+                attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+                break;
+            case PerfEnums::kCounter_TaskClock:
+                attributes.type = PERF_TYPE_SOFTWARE;
+                attributes.config = PERF_COUNT_SW_TASK_CLOCK;
+                break;
+        }
+
+        // this thread, on any cpu
+        return static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+    }
+#endif
+
+    void writeValue(std::ostream& stream, const bool available, const double value) {
+        if (available) stream << std::setw(16) << value;
+        else stream << std::setw(16) << "n/a";
+    }
+}
+
+PerfSample::PerfSample() {
+    for (unsigned int counter = 0; counter < PerfEnums::kCounterCount; counter++) {
+        values[counter] = 0;
+    }
+}
+
+bool PerfCounters::properlyInitialized() const {
+    return this == init;
+}
+
+PerfCounters::PerfCounters() : running(false), begun(), phaseOrder(), phaseSamples(), phaseTotals(), init(this) {
+    for (unsigned int counter = 0; counter < PerfEnums::kCounterCount; counter++) {
+#ifdef __linux__
+        descriptors[counter] = openCounter(static_cast<PerfEnums::ECounter>(counter));
+#else
+        descriptors[counter] = -1;
+#endif
+    }
+
+    ENSURE(properlyInitialized(), "PerfCounters was not properly initialized.");
+}
+
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+    for (unsigned int counter = 0; counter < PerfEnums::kCounterCount; counter++) {
+        if (descriptors[counter] >= 0) close(descriptors[counter]);
+    }
+#endif
+}
+
+bool PerfCounters::isAvailable(const PerfEnums::ECounter counter) const {
+    REQUIRE(properlyInitialized(), "PerfCounters was not properly initialized.");
+    return descriptors[counter] >= 0;
+}
+
+PerfSample PerfCounters::read() const {
+    REQUIRE(properlyInitialized(), "PerfCounters was not properly initialized.");
+    PerfSample sample;
+
+#ifdef __linux__
+    for (unsigned int counter = 0; counter < PerfEnums::kCounterCount; counter++) {
+        if (descriptors[counter] < 0) continue;
+
+        // value, time enabled, time running
+        unsigned long long buffer[3] = {0, 0, 0};
+        if (::read(descriptors[counter], buffer, sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer))) continue;
+
+        if (buffer[2] == buffer[1] || buffer[2] == 0) {
+            sample.values[counter] = buffer[0];
+        } else {
+            sample.values[counter] = static_cast<unsigned long long>(buffer[0] * (static_cast<double>(buffer[1]) / buffer[2]));
+        }
+    }
+#endif
+
+    return sample;
+}
+
+void PerfCounters::begin() {
+    REQUIRE(properlyInitialized(), "PerfCounters was not properly initialized.");
+    REQUIRE(!running, "PerfCounters phase was already begun.");
+    begun = read();
+    running = true;
+}
+
+void PerfCounters::end(const std::string& phase) {
+    REQUIRE(properlyInitialized(), "PerfCounters was not properly initialized.");
+    REQUIRE(running, "PerfCounters phase was not begun.");
+    const PerfSample now = read();
+    running = false;
+
+    if (phaseSamples.find(phase) == phaseSamples.end()) {
+        phaseOrder.push_back(phase);
+        phaseSamples[phase] = 0;
+    }
+
+    PerfSample& total = phaseTotals[phase];
+    for (unsigned int counter = 0; counter < PerfEnums::kCounterCount; counter++) {
+        // a multiplexed counter can be scaled below its previous reading
+        if (now.values[counter] > begun.values[counter]) total.values[counter] += now.values[counter] - begun.values[counter];
+    }
+    phaseSamples[phase]++;
+}
+
+unsigned long PerfCounters::getSamples(const std::string& phase) const {
+    REQUIRE(properlyInitialized(), "PerfCounters was not properly initialized.");
+    std::map<std::string, unsigned long>::const_iterator it_phase = phaseSamples.find(phase);
+    return it_phase != phaseSamples.end() ? it_phase->second : 0;
+}
+
+PerfSample PerfCounters::getTotal(const std::string& phase) const {
+    REQUIRE(properlyInitialized(), "PerfCounters was not properly initialized.");
+    std::map<std::string, PerfSample>::const_iterator it_phase = phaseTotals.find(phase);
+    return it_phase != phaseTotals.end() ? it_phase->second : PerfSample();
+}
+
+void PerfCounters::report(std::ostream& stream) const {
+    REQUIRE(properlyInitialized(), "PerfCounters was not properly initialized.");
+
+    stream << std::fixed << std::setprecision(2);
+    stream << "Hardware counters, simulate and render have one sample per tick" << std::endl;
+    stream << std::left << std::setw(22) << "Phase" << std::right << std::setw(10) << "samples";
+    for (unsigned int counter = 0; counter < PerfEnums::kCounterCount; counter++) {
+        stream << std::setw(16) << PerfEnums::EnumToString(static_cast<PerfEnums::ECounter>(counter));
+    }
+    stream << std::setw(8) << "IPC" << std::endl;
+
+    for (std::vector<std::string>::const_iterator it_phase = phaseOrder.begin(); it_phase != phaseOrder.end(); it_phase++) {
+        const PerfSample& total = phaseTotals.find(*it_phase)->second;
+        const unsigned long samples = phaseSamples.find(*it_phase)->second;
+        const bool ipcAvailable = isAvailable(PerfEnums::kCounter_Cycles) && isAvailable(PerfEnums::kCounter_Instructions) && total.values[PerfEnums::kCounter_Cycles] > 0;
+
+        for (unsigned int row = 0; row < 2; row++) {
+            // the second row divides the totals by the number of samples
+            const double divisor = (row == 0 ? 1.0 : static_cast<double>(samples));
+            stream << std::left << std::setw(22) << (row == 0 ? *it_phase : "  per sample") << std::right << std::setw(10);
+            if (row == 0) stream << samples;
+            else stream << "";
+
+            for (unsigned int counter = 0; counter < PerfEnums::kCounterCount; counter++) {
+                writeValue(stream, isAvailable(static_cast<PerfEnums::ECounter>(counter)), total.values[counter] / divisor);
+            }
+
+            if (ipcAvailable) stream << std::setw(8) << static_cast<double>(total.values[PerfEnums::kCounter_Instructions]) / total.values[PerfEnums::kCounter_Cycles];
+            else stream << std::setw(8) << "n/a";
+            stream << std::endl;
+
+            if (samples == 1) break;
+        }
+    }
+
+    stream << std::resetiosflags(std::ios::fixed) << std::setprecision(6);
+}
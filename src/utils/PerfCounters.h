@@ -0,0 +1,122 @@
+#ifndef INC_PERFCOUNTERS_H
+#define INC_PERFCOUNTERS_H
+
+#include "../lib/DesignByContract.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+
+namespace PerfEnums {
+    #define ECOUNTERS \
+        ecounter(Cycles), \
+        ecounter(Instructions), \
+        ecounter(CacheMisses), \
+        ecounter(BranchMisses), \
+        ecounter(TaskClock)
+
+    #define ecounter(x) kCounter_##x
+        enum ECounter { ECOUNTERS };
+    #undef ecounter
+
+    const unsigned int kCounterCount = kCounter_TaskClock + 1;
+
+    const char* EnumToString(ECounter f);
+}
+
+/**
+ * Counter values, TaskClock is the CPU time in nanoseconds
+ */
+struct PerfSample {
+    unsigned long long values[PerfEnums::kCounterCount];
+
+    PerfSample();
+};
+
+/**
+ * Reads hardware counters of the calling thread through perf_event_open and sums them per named phase. \n
+ * Every counter is opened on its own, counters the kernel or CPU does not offer are reported as unavailable and read as 0.
+ * Counters that are multiplexed by the kernel are scaled to the time they were enabled. \n
+ * On other platforms than Linux no counter is available.
+ */
+class PerfCounters {
+private:
+    int descriptors[PerfEnums::kCounterCount];
+
+    bool running;
+    PerfSample begun;
+
+    std::vector<std::string> phaseOrder;
+    std::map<std::string, unsigned long> phaseSamples;
+    std::map<std::string, PerfSample> phaseTotals;
+
+    const PerfCounters* init;
+
+    bool properlyInitialized() const;
+
+    PerfCounters(const PerfCounters&);
+
+    PerfCounters& operator=(const PerfCounters&);
+
+public:
+    /**
+     * Opens and starts every counter \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "PerfCounters was not properly initialized.");
+     */
+    PerfCounters();
+
+    ~PerfCounters();
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "PerfCounters was not properly initialized.");
+     */
+    bool isAvailable(const PerfEnums::ECounter counter) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "PerfCounters was not properly initialized.");
+     * @return the values counted since construction
+     */
+    PerfSample read() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "PerfCounters was not properly initialized."); \n
+     * REQUIRE(!running, "PerfCounters phase was already begun.");
+     */
+    void begin();
+
+    /**
+     * Adds the values counted since begin to the phase, every call counts as one sample of the phase \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "PerfCounters was not properly initialized."); \n
+     * REQUIRE(running, "PerfCounters phase was not begun.");
+     */
+    void end(const std::string& phase);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "PerfCounters was not properly initialized.");
+     * @return the number of samples of the phase, 0 if it was never ended
+     */
+    unsigned long getSamples(const std::string& phase) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "PerfCounters was not properly initialized.");
+     * @return the summed values of the phase
+     */
+    PerfSample getTotal(const std::string& phase) const;
+
+    /**
+     * Writes the totals, the values per sample and the instructions per cycle of every phase \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "PerfCounters was not properly initialized.");
+     */
+    void report(std::ostream& stream) const;
+};
+
+#endif
@@ -0,0 +1,190 @@
+#include "ResultCache.h"
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstdio>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+    const char* kInputFiles[] = {"input.xml", "performance.xml", "aircraft.xml", "schedule.xml"};
+    const unsigned int kInputFileCount = 4;
+
+    unsigned long temporaryCounter = 0;
+
+    bool readFile(const std::string& fileName, std::string& contents) {
+        std::ifstream stream(fileName.c_str(), std::ios::binary);
+        if (!stream.is_open()) return false;
+
+        std::ostringstream buffer;
+        buffer << stream.rdbuf();
+        contents = buffer.str();
+        return true;
+    }
+
+    bool writeFile(const std::string& fileName, const std::string& contents) {
+        std::ofstream stream(fileName.c_str(), std::ios::binary);
+        if (!stream.is_open()) return false;
+
+        stream << contents;
+        return stream.good();
+    }
+
+    /**
+     * Two different 64 bit hashes over the same bytes, together a 128 bit key
+     */
+    struct KeyHash {
+        unsigned long long fnv;
+        unsigned long long sdbm;
+
+        KeyHash() : fnv(14695981039346656037ULL), sdbm(0) {}
+
+        void add(const std::string& bytes) {
+            for (std::string::const_iterator it_char = bytes.begin(); it_char != bytes.end(); it_char++) {
+                const unsigned char byte = static_cast<unsigned char>(*it_char);
+                fnv = (fnv ^ byte) * 1099511628211ULL;
+                sdbm = byte + (sdbm << 6) + (sdbm << 16) - sdbm;
+            }
+        }
+    };
+
+    std::string entryFile(const std::string& entry, const unsigned long index) {
+        std::ostringstream name;
+        name << entry << index;
+        return name.str();
+    }
+
+    void removeEntry(const std::string& entry, const unsigned long files) {
+        for (unsigned long index = 0; index < files; index++) {
+            std::remove(entryFile(entry, index).c_str());
+        }
+        std::remove((entry + "manifest.txt").c_str());
+        rmdir(entry.c_str());
+    }
+}
+
+bool ResultCache::properlyInitialized() const {
+    return this == init;
+}
+
+ResultCache::ResultCache(const std::string& _directory) : directory(_directory), init(this) {
+    REQUIRE(!_directory.empty() && _directory[_directory.size() - 1] == '/', "Cache directory must end with a slash.");
+
+    mkdir(directory.c_str(), 0755);
+
+    ENSURE(properlyInitialized(), "ResultCache was not properly initialized.");
+}
+
+std::string ResultCache::computeKey(const std::string& scenarioPath, const std::string& configuration) const {
+    REQUIRE(properlyInitialized(), "ResultCache was not properly initialized.");
+
+    KeyHash hash;
+    std::ostringstream header;
+    header << "version " << kEngineVersion << "\nconfiguration " << configuration << "\n";
+    hash.add(header.str());
+
+    for (unsigned int file = 0; file < kInputFileCount; file++) {
+        std::string contents;
+        std::ostringstream fileHeader;
+        if (readFile(scenarioPath + kInputFiles[file], contents)) {
+            fileHeader << kInputFiles[file] << " " << contents.size() << "\n";
+            hash.add(fileHeader.str());
+            hash.add(contents);
+        } else {
+            fileHeader << kInputFiles[file] << " missing\n";
+            hash.add(fileHeader.str());
+        }
+    }
+
+    std::ostringstream key;
+    key << std::hex << std::setfill('0') << std::setw(16) << hash.fnv << std::setw(16) << hash.sdbm;
+    return key.str();
+}
+
+bool ResultCache::restore(const std::string& key, const std::string& scenarioPath, ScenarioSummary& summary) const {
+    REQUIRE(properlyInitialized(), "ResultCache was not properly initialized.");
+
+    const std::string entry = directory + key + "/";
+    std::ifstream manifest((entry + "manifest.txt").c_str());
+    if (!manifest.is_open()) return false;
+
+    ScenarioSummary restored;
+    restored.path = summary.path;
+
+    std::string field;
+    while (manifest >> field) {
+        if (field == "result") {
+            int result = 0;
+            manifest >> result;
+            restored.result = static_cast<ParseEnum::EResult>(result);
+        } else if (field == "airports") {
+            manifest >> restored.airports;
+        } else if (field == "airplanes") {
+            manifest >> restored.airplanes;
+        } else if (field == "output") {
+            // the path is the rest of the line, it may contain spaces
+            std::string output;
+            manifest.ignore(1);
+            std::getline(manifest, output);
+            restored.outputs.push_back(output);
+        } else {
+            std::string ignored;
+            std::getline(manifest, ignored);
+        }
+    }
+
+    for (unsigned long index = 0; index < restored.outputs.size(); index++) {
+        std::string contents;
+        if (!readFile(entryFile(entry, index), contents)) return false;
+        // an output that can not be written back is a miss, the scenario is simulated again
+        if (!writeFile(scenarioPath + restored.outputs[index], contents)) return false;
+    }
+
+    restored.cached = true;
+    summary = restored;
+    return true;
+}
+
+bool ResultCache::store(const std::string& key, const std::string& scenarioPath, const ScenarioSummary& summary) const {
+    REQUIRE(properlyInitialized(), "ResultCache was not properly initialized.");
+
+    std::ostringstream temporaryName;
+    temporaryName << directory << key << ".tmp" << getpid() << "-" << __sync_fetch_and_add(&temporaryCounter, 1) << "/";
+    const std::string temporary = temporaryName.str();
+    if (mkdir(temporary.c_str(), 0755) != 0) return false;
+
+    std::ostringstream manifest;
+    manifest << "version " << kEngineVersion << "\n";
+    manifest << "result " << static_cast<int>(summary.result) << "\n";
+    manifest << "airports " << summary.airports << "\n";
+    manifest << "airplanes " << summary.airplanes << "\n";
+
+    // outputs that could not be written by the run, for example without an airplanes directory, are left out
+    unsigned long files = 0;
+    for (std::vector<std::string>::const_iterator it_output = summary.outputs.begin(); it_output != summary.outputs.end(); it_output++) {
+        std::string contents;
+        if (!readFile(scenarioPath + *it_output, contents)) continue;
+
+        if (!writeFile(entryFile(temporary, files), contents)) {
+            removeEntry(temporary, files + 1);
+            return false;
+        }
+        manifest << "output " << *it_output << "\n";
+        files++;
+    }
+
+    if (!writeFile(temporary + "manifest.txt", manifest.str())) {
+        removeEntry(temporary, files);
+        return false;
+    }
+
+    // the rename fails when another run stored the same entry first
+    const std::string entry = directory + key;
+    if (std::rename(temporary.substr(0, temporary.size() - 1).c_str(), entry.c_str()) != 0) {
+        removeEntry(temporary, files);
+        return false;
+    }
+
+    return true;
+}
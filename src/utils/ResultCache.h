@@ -0,0 +1,63 @@
+#ifndef INC_RESULTCACHE_H
+#define INC_RESULTCACHE_H
+
+#include "../lib/DesignByContract.h"
+#include "ScenarioRunner.h"
+
+#include <string>
+
+/**
+ * Stores the outputs of scenario runs on disk, keyed by the contents of the scenario inputs, the engine version and the
+ * run configuration. \n
+ * Every entry is a directory named after its key with a manifest and one file per output. Entries are written to a
+ * temporary directory that is renamed into place, so runs in other threads or processes only see complete entries.
+ */
+class ResultCache {
+private:
+    std::string directory;
+
+    const ResultCache* init;
+
+    bool properlyInitialized() const;
+
+public:
+    /**
+     * Part of every key, raise it whenever a change to the Parser or Simulator changes any output
+     */
+    static const unsigned int kEngineVersion = 4;
+
+    /**
+     * Creates the directory when it does not exist \n
+     * PRE: \n
+     * REQUIRE(!_directory.empty() && _directory[_directory.size() - 1] == '/', "Cache directory must end with a slash."); \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "ResultCache was not properly initialized.");
+     */
+    ResultCache(const std::string& _directory);
+
+    /**
+     * Hashes input.xml, performance.xml and aircraft.xml of the scenario with the engine version and configuration \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "ResultCache was not properly initialized.");
+     * @return 32 hexadecimal digits
+     */
+    std::string computeKey(const std::string& scenarioPath, const std::string& configuration) const;
+
+    /**
+     * Copies the outputs of the entry into the scenario directory and fills in the summary \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "ResultCache was not properly initialized.");
+     * @return false if there is no complete entry for the key or an output could not be written
+     */
+    bool restore(const std::string& key, const std::string& scenarioPath, ScenarioSummary& summary) const;
+
+    /**
+     * Copies the outputs listed in the summary into a new entry, an existing entry is kept \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "ResultCache was not properly initialized.");
+     * @return false if the entry could not be written
+     */
+    bool store(const std::string& key, const std::string& scenarioPath, const ScenarioSummary& summary) const;
+};
+
+#endif
@@ -0,0 +1,163 @@
+#include "SaturationFinder.h"
+#include "WorkStealingPool.h"
+
+#include <algorithm>
+#include <iomanip>
+
+SaturationOptions::SaturationOptions() : maxHolding(30), upper(1000), precision(1), mix(), threads(0), tickLimit(11520) {}
+
+SaturationProbe::SaturationProbe() : round(0), arrivals(0), result(), sustainable(false) {}
+
+bool SaturationFinder::properlyInitialized() const {
+    return this == init;
+}
+
+SaturationFinder::SaturationFinder(const SaturationOptions& _options)
+        : options(_options),
+          probes(),
+          sustainable(0),
+          unsustainable(0),
+          sustainableArrivals(0),
+          unsustainableArrivals(0),
+          searched(false),
+          init(this) {
+    REQUIRE(_options.upper > 0, "The upper load must be above 0.");
+    REQUIRE(_options.precision > 0, "The precision must be above 0.");
+    ENSURE(properlyInitialized(), "SaturationFinder was not properly initialized.");
+}
+
+bool SaturationFinder::isSustainable(const ReplicationResult& metrics) const {
+    REQUIRE(properlyInitialized(), "SaturationFinder was not properly initialized.");
+    return metrics.finished && metrics.crashed == 0 && metrics.holding <= options.maxHolding;
+}
+
+void SaturationFinder::probe(const Airport* airport, const std::vector<unsigned int>& loads, const unsigned int round) {
+    std::vector<SweepPoint> points;
+    for (std::vector<unsigned int>::const_iterator it_load = loads.begin(); it_load != loads.end(); it_load++) {
+        SweepPoint point;
+        point.mix = options.mix;
+        point.arrivals = *it_load;
+        points.push_back(point);
+    }
+
+    ParameterSweep sweep(options.threads, options.tickLimit);
+    const std::vector<SweepResult> results = sweep.run(airport, points);
+
+    // the loads are ascending, a load above the first unsustainable one does not count even if it happened to pass
+    bool failed = false;
+    for (std::vector<SweepResult>::const_iterator it_result = results.begin(); it_result != results.end(); it_result++) {
+        SaturationProbe probe;
+        probe.round = round;
+        probe.result = *it_result;
+        probe.arrivals = ParameterSweep::getArrivalCount(airport, it_result->point.arrivals);
+        probe.sustainable = isSustainable(it_result->metrics);
+        probes.push_back(probe);
+
+        if (failed) continue;
+        if (probe.sustainable) {
+            sustainable = it_result->point.arrivals;
+            sustainableArrivals = probe.arrivals;
+        } else {
+            unsustainable = it_result->point.arrivals;
+            unsustainableArrivals = probe.arrivals;
+            failed = true;
+        }
+    }
+}
+
+void SaturationFinder::search(const Airport* airport) {
+    REQUIRE(properlyInitialized(), "SaturationFinder was not properly initialized.");
+    REQUIRE(airport != NULL, "Airport can not be NULL.");
+    REQUIRE(!isSearched(), "SaturationFinder has already searched.");
+    REQUIRE(ParameterSweep::canDraw(airport, options.mix), "The base scenario has no arrivals of the fleet mix.");
+
+    // the bounds first, there is nothing to narrow if either of them settles the question
+    std::vector<unsigned int> loads;
+    loads.push_back(0);
+    loads.push_back(options.upper);
+    unsustainable = options.upper + 1;
+    probe(airport, loads, 0);
+
+    // a load is searched as the number of arrivals it draws, every probe of a round is a different simulation
+    const unsigned long baseArrivals = ParameterSweep::getArrivalCount(airport, 100);
+    const unsigned int width = WorkStealingPool::getThreadCount(options.threads);
+    unsigned int round = 1;
+    while (hasSustainable() && hasUnsustainable() && unsustainable - sustainable > options.precision) {
+        const unsigned long lowest = ParameterSweep::getArrivalCount(airport, sustainable);
+        const unsigned long highest = ParameterSweep::getArrivalCount(airport, unsustainable);
+        if (highest - lowest <= 1) break;
+
+        loads.clear();
+        const unsigned long steps = std::min(static_cast<unsigned long>(width), highest - lowest - 1);
+        for (unsigned long i = 1; i <= steps; i++) {
+            const unsigned long count = lowest + (highest - lowest) * i / (steps + 1);
+            // the lowest load that draws count arrivals
+            loads.push_back(static_cast<unsigned int>((100 * count - 50 + baseArrivals - 1) / baseArrivals));
+        }
+        probe(airport, loads, round++);
+    }
+
+    searched = true;
+    ENSURE(isSearched(), "SaturationFinder did not search.");
+}
+
+bool SaturationFinder::isSearched() const {
+    return searched;
+}
+
+unsigned int SaturationFinder::getSustainable() const {
+    REQUIRE(isSearched(), "SaturationFinder has not searched yet.");
+    return sustainable;
+}
+
+unsigned int SaturationFinder::getUnsustainable() const {
+    REQUIRE(isSearched(), "SaturationFinder has not searched yet.");
+    return unsustainable;
+}
+
+bool SaturationFinder::hasSustainable() const {
+    return probes.empty() || probes.front().sustainable;
+}
+
+bool SaturationFinder::hasUnsustainable() const {
+    return unsustainable <= options.upper;
+}
+
+unsigned long SaturationFinder::getSustainableArrivals() const {
+    REQUIRE(isSearched(), "SaturationFinder has not searched yet.");
+    return sustainableArrivals;
+}
+
+const std::vector<SaturationProbe>& SaturationFinder::getProbes() const {
+    REQUIRE(isSearched(), "SaturationFinder has not searched yet.");
+    return probes;
+}
+
+void SaturationFinder::report(std::ostream& stream) const {
+    REQUIRE(isSearched(), "SaturationFinder has not searched yet.");
+
+    stream << std::fixed << std::setprecision(2);
+    stream << "Sustainable: finished, no crashes and at most " << options.maxHolding << " minutes of mean holding, fleet mix "
+           << options.mix.getName() << std::endl << std::endl;
+
+    stream << std::right << std::setw(6) << "Round" << std::setw(7) << "Load" << std::setw(10) << "Arrivals" << std::setw(11) << "Airplanes" << std::setw(9) << "Minutes"
+           << std::setw(10) << "Finished" << std::setw(9) << "Crashed" << std::setw(10) << "Holding" << std::setw(13) << "Sustainable" << std::endl;
+    for (std::vector<SaturationProbe>::const_iterator it_probe = probes.begin(); it_probe != probes.end(); it_probe++) {
+        const ReplicationResult& metrics = it_probe->result.metrics;
+        stream << std::setw(6) << it_probe->round << std::setw(6) << it_probe->result.point.arrivals << "%" << std::setw(10) << it_probe->arrivals << std::setw(11) << it_probe->result.airplanes
+               << std::setw(9) << metrics.ticks << std::setw(10) << (metrics.finished ? "yes" : "no") << std::setw(9) << metrics.crashed
+               << std::setw(10) << metrics.holding << std::setw(13) << (it_probe->sustainable ? "yes" : "no") << std::endl;
+    }
+    stream << std::endl;
+
+    if (!hasSustainable()) {
+        stream << "Not even the airplanes that are not arriving are sustainable" << std::endl;
+    } else if (!hasUnsustainable()) {
+        stream << "Every load up to " << options.upper << "% is sustainable" << std::endl;
+    } else {
+        stream << "Saturation between " << sustainableArrivals << " arrivals (" << sustainable << "% of the base) and "
+               << unsustainableArrivals << " arrivals (" << unsustainable << "%)" << std::endl;
+    }
+
+    stream << std::resetiosflags(std::ios::fixed) << std::setprecision(6);
+}
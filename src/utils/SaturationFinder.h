@@ -0,0 +1,161 @@
+#ifndef INC_SATURATIONFINDER_H
+#define INC_SATURATIONFINDER_H
+
+#include "../lib/DesignByContract.h"
+#include "../classes/Airport.h"
+#include "ParameterSweep.h"
+
+#include <iostream>
+#include <vector>
+
+/**
+ * The limits of a sustainable load and the bounds of the search, loads are arrivals in percent of the base scenario
+ */
+struct SaturationOptions {
+    /**
+     * The highest mean holding time per airplane in minutes
+     */
+    double maxHolding;
+
+    /**
+     * The highest load that is tried
+     */
+    unsigned int upper;
+
+    /**
+     * The search stops once the highest sustainable and the lowest unsustainable load are this close, in percent
+     */
+    unsigned int precision;
+
+    FleetMix mix;
+
+    /**
+     * The number of pool threads, 0 is one per online CPU
+     */
+    unsigned int threads;
+
+    unsigned int tickLimit;
+
+    SaturationOptions();
+};
+
+/**
+ * One simulated load of the search
+ */
+struct SaturationProbe {
+    unsigned int round;
+    unsigned long arrivals;
+    SweepResult result;
+    bool sustainable;
+
+    SaturationProbe();
+};
+
+/**
+ * Searches the highest arrival load of an Airport that is sustainable: every simulation finishes before the tick
+ * limit, no airplane crashes and the mean holding time stays under the threshold. \n
+ * Every round simulates one load per pool thread, evenly spread over the arrival counts between the highest
+ * sustainable and the lowest unsustainable load so far, one thread is plain bisection. The search ends when the loads
+ * are within the precision or one arrival apart. The variants are built from the parsed Airport by ParameterSweep, the
+ * topology is never parsed again.
+ */
+class SaturationFinder {
+private:
+    SaturationOptions options;
+
+    std::vector<SaturationProbe> probes;
+    unsigned int sustainable;
+    unsigned int unsustainable;
+    unsigned long sustainableArrivals;
+    unsigned long unsustainableArrivals;
+    bool searched;
+
+    const SaturationFinder* init;
+
+    bool properlyInitialized() const;
+
+    /**
+     * Simulates the loads in parallel and narrows the interval
+     */
+    void probe(const Airport* airport, const std::vector<unsigned int>& loads, const unsigned int round);
+
+    SaturationFinder(const SaturationFinder&);
+
+    SaturationFinder& operator=(const SaturationFinder&);
+
+public:
+    /**
+     * PRE: \n
+     * REQUIRE(_options.upper > 0, "The upper load must be above 0."); \n
+     * REQUIRE(_options.precision > 0, "The precision must be above 0."); \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "SaturationFinder was not properly initialized.");
+     */
+    SaturationFinder(const SaturationOptions& _options);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SaturationFinder was not properly initialized.");
+     */
+    bool isSustainable(const ReplicationResult& metrics) const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "SaturationFinder was not properly initialized."); \n
+     * REQUIRE(airport != NULL, "Airport can not be NULL."); \n
+     * REQUIRE(!isSearched(), "SaturationFinder has already searched."); \n
+     * REQUIRE(ParameterSweep::canDraw(airport, options.mix), "The base scenario has no arrivals of the fleet mix."); \n
+     * POST: \n
+     * ENSURE(isSearched(), "SaturationFinder did not search.");
+     */
+    void search(const Airport* airport);
+
+    bool isSearched() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(isSearched(), "SaturationFinder has not searched yet.");
+     * @return the highest sustainable load that was found, only meaningful if hasSustainable()
+     */
+    unsigned int getSustainable() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(isSearched(), "SaturationFinder has not searched yet.");
+     * @return the lowest unsustainable load that was found, only meaningful if hasUnsustainable()
+     */
+    unsigned int getUnsustainable() const;
+
+    /**
+     * @return false if the Airport does not even sustain the airplanes that are not arriving
+     */
+    bool hasSustainable() const;
+
+    /**
+     * @return false if the upper load is sustainable
+     */
+    bool hasUnsustainable() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(isSearched(), "SaturationFinder has not searched yet.");
+     * @return the number of arrivals of getSustainable()
+     */
+    unsigned long getSustainableArrivals() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(isSearched(), "SaturationFinder has not searched yet.");
+     * @return every simulated load in the order it was simulated
+     */
+    const std::vector<SaturationProbe>& getProbes() const;
+
+    /**
+     * Writes the probes and the result \n
+     * PRE: \n
+     * REQUIRE(isSearched(), "SaturationFinder has not searched yet.");
+     */
+    void report(std::ostream& stream) const;
+};
+
+#endif
@@ -0,0 +1,191 @@
+#include "ScenarioGenerator.h"
+
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+
+namespace {
+    struct FleetEntry {
+        unsigned int type;
+        const char* typeName;
+        const char* size;
+        const char* engine;
+        const char* model;
+        unsigned int passengers;
+        unsigned int fuel;
+    };
+
+    // every type/size/engine combination the parser assigns a squawk range to, type indexes the fleet mix weights
+    const FleetEntry kFleet[] = {
+        {0, "private", "small", "propeller", "Cessna 340", 4, 6000},
+        {0, "private", "small", "jet", "Cessna Citation", 8, 15000},
+        {0, "private", "medium", "jet", "Gulfstream G650", 18, 100000},
+        {1, "airline", "medium", "propeller", "ATR 72", 70, 30000},
+        {1, "airline", "medium", "jet", "Airbus A320", 180, 100000},
+        {1, "airline", "large", "jet", "Boeing 747", 400, 150000},
+        {2, "military", "small", "jet", "F-16", 1, 15000},
+        {2, "military", "large", "propeller", "C-130", 90, 60000},
+        {3, "emergency", "small", "propeller", "Cessna 208", 6, 6000}
+    };
+
+    const unsigned int kFleetSize = sizeof(kFleet) / sizeof(kFleet[0]);
+
+    std::string airportIata(const unsigned int airport) {
+        // two letters after the G for the first 676 airports, every following group of names is one letter longer
+        unsigned int letters = 2;
+        unsigned long long groupSize = 26 * 26;
+        unsigned long long index = airport;
+        while (index >= groupSize) {
+            index -= groupSize;
+            groupSize *= 26;
+            letters++;
+        }
+
+        std::string iata(letters + 1, 'G');
+        for (unsigned int i = letters; i > 0; i--) {
+            iata[i] = static_cast<char>('A' + index % 26);
+            index /= 26;
+        }
+        return iata;
+    }
+
+    unsigned int nameWidth(const unsigned int names) {
+        unsigned int width = 3;
+        for (unsigned long long limit = 1000; limit < names; limit *= 10) width++;
+        return width;
+    }
+}
+
+ScenarioConfig::ScenarioConfig()
+        : airplanes(10),
+          runways(1),
+          taxiChainLength(49),
+          crossingDensity(0),
+          gateShare(50),
+          privateWeight(3),
+          airlineWeight(3),
+          militaryWeight(2),
+          emergencyWeight(1),
+          seed(1) {}
+
+bool ScenarioGenerator::properlyInitialized() const {
+    return this == init;
+}
+
+ScenarioGenerator::ScenarioGenerator(const ScenarioConfig& _config) : config(_config), state(_config.seed), init(this) {
+    REQUIRE(_config.airplanes > 0, "A scenario needs at least one airplane.");
+    REQUIRE(_config.runways > 0, "A scenario needs at least one runway.");
+    REQUIRE(_config.crossingDensity <= 100 && _config.gateShare <= 100, "Percentages can not exceed 100.");
+    REQUIRE(_config.privateWeight + _config.airlineWeight + _config.militaryWeight + _config.emergencyWeight > 0, "The fleet mix needs at least one airplane type.");
+    ENSURE(properlyInitialized(), "ScenarioGenerator was not properly initialized.");
+}
+
+unsigned long ScenarioGenerator::next() {
+    // 32 bit linear congruential generator, so files are equal across platforms
+    state = (state * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    return state >> 8;
+}
+
+unsigned int ScenarioGenerator::nextFleetEntry() {
+    const unsigned int weights[] = {config.privateWeight, config.airlineWeight, config.militaryWeight, config.emergencyWeight};
+
+    unsigned long pick = next() % (weights[0] + weights[1] + weights[2] + weights[3]);
+    unsigned int type = 0;
+    while (pick >= weights[type]) {
+        pick -= weights[type];
+        type++;
+    }
+
+    std::vector<unsigned int> candidates;
+    for (unsigned int i = 0; i < kFleetSize; i++) {
+        if (kFleet[i].type == type) candidates.push_back(i);
+    }
+
+    return candidates[next() % candidates.size()];
+}
+
+unsigned int ScenarioGenerator::getAirportCount() const {
+    REQUIRE(properlyInitialized(), "ScenarioGenerator was not properly initialized.");
+    const unsigned int chainRunways = config.taxiChainLength + 1;
+    return (config.runways + chainRunways - 1) / chainRunways;
+}
+
+void ScenarioGenerator::write(std::ostream& stream) {
+    REQUIRE(properlyInitialized(), "ScenarioGenerator was not properly initialized.");
+    state = config.seed;
+
+    const unsigned int airports = getAirportCount();
+    const unsigned int chainRunways = config.taxiChainLength + 1;
+
+    for (unsigned int airport = 0; airport < airports; airport++) {
+        const std::string iata = airportIata(airport);
+        const unsigned int firstAirplane = static_cast<unsigned int>(static_cast<unsigned long long>(config.airplanes) * airport / airports);
+        const unsigned int lastAirplane = static_cast<unsigned int>(static_cast<unsigned long long>(config.airplanes) * (airport + 1) / airports);
+        const unsigned int runways = std::min(chainRunways, config.runways - airport * chainRunways);
+        const unsigned int grassStrips = config.crossingDensity * (runways - 1) / 100;
+        const unsigned int width = nameWidth(runways);
+
+        std::vector<unsigned int> fleet;
+        std::vector<bool> atGate;
+        unsigned int gates = 1;
+
+        for (unsigned int i = firstAirplane; i < lastAirplane; i++) {
+            fleet.push_back(nextFleetEntry());
+            atGate.push_back(next() % 100 < config.gateShare);
+            if (atGate.back()) gates++;
+        }
+
+        stream << "<AIRPORT>" << std::endl;
+        stream << "    <name>Generated Airport " << airport << "</name>" << std::endl;
+        stream << "    <iata>" << iata << "</iata>" << std::endl;
+        stream << "    <callsign>Generated Tower " << airport << "</callsign>" << std::endl;
+        stream << "    <gates>" << gates << "</gates>" << std::endl;
+        stream << "</AIRPORT>" << std::endl;
+
+        // names are zero padded to one width so the parser's name order, in which landing runways are picked, is the chain order
+        for (unsigned int runway = 0; runway < runways; runway++) {
+            stream << "<RUNWAY>" << std::endl;
+            stream << "    <name>R" << std::setw(width) << std::setfill('0') << runway << "</name>" << std::endl;
+            stream << "    <airport>" << iata << "</airport>" << std::endl;
+            stream << "    <type>" << (runway < grassStrips ? "grass" : "asphalt") << "</type>" << std::endl;
+            stream << "    <length>" << (runway < grassStrips ? 800 : 4000) << "</length>" << std::endl;
+            stream << "    <TAXIROUTE>" << std::endl;
+            stream << "        <taxipoint>T000</taxipoint>" << std::endl;
+            for (unsigned int crossing = 0; crossing < runway; crossing++) {
+                stream << "        <crossing>R" << std::setw(width) << std::setfill('0') << crossing << "</crossing>" << std::endl;
+                stream << "        <taxipoint>T" << std::setw(width) << std::setfill('0') << crossing + 1 << "</taxipoint>" << std::endl;
+            }
+            stream << "    </TAXIROUTE>" << std::endl;
+            stream << "</RUNWAY>" << std::endl;
+        }
+
+        for (unsigned int i = firstAirplane; i < lastAirplane; i++) {
+            const FleetEntry& entry = kFleet[fleet[i - firstAirplane]];
+
+            stream << "<AIRPLANE>" << std::endl;
+            stream << "    <number>GEN" << std::setw(6) << std::setfill('0') << i << "</number>" << std::endl;
+            stream << "    <callsign>Generated " << i << "</callsign>" << std::endl;
+            stream << "    <model>" << entry.model << "</model>" << std::endl;
+            stream << "    <type>" << entry.typeName << "</type>" << std::endl;
+            stream << "    <engine>" << entry.engine << "</engine>" << std::endl;
+            stream << "    <size>" << entry.size << "</size>" << std::endl;
+            stream << "    <fuel>" << entry.fuel << "</fuel>" << std::endl;
+            stream << "    <passengers>" << entry.passengers << "</passengers>" << std::endl;
+            stream << "    <status>" << (atGate[i - firstAirplane] ? "StandingAtGate" : "Approaching") << "</status>" << std::endl;
+            stream << "</AIRPLANE>" << std::endl;
+        }
+    }
+}
+
+bool ScenarioGenerator::writeFile(const std::string& fileName) {
+    REQUIRE(properlyInitialized(), "ScenarioGenerator was not properly initialized.");
+
+    std::ofstream file(fileName.c_str());
+    if (!file.is_open()) return false;
+
+    write(file);
+    file.close();
+
+    return !file.fail();
+}
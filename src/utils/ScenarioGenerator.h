@@ -0,0 +1,103 @@
+#ifndef INC_SCENARIOGENERATOR_H
+#define INC_SCENARIOGENERATOR_H
+
+#include "../lib/DesignByContract.h"
+
+#include <iostream>
+#include <string>
+
+/**
+ * Size and shape of a generated scenario
+ */
+struct ScenarioConfig {
+    /**
+     * Totals over every generated airport
+     */
+    unsigned int airplanes;
+    unsigned int runways;
+
+    /**
+     * The most runways a taxi route crosses, an airport holds taxiChainLength + 1 runways on one chain from the apron. \n
+     * Runways that do not fit on one chain are placed at additional airports.
+     */
+    unsigned int taxiChainLength;
+
+    /**
+     * Percentage of every chain that consists of short grass strips next to the apron, only small propeller airplanes
+     * land there and all other traffic has to cross them. The runway at the end of a chain is always long asphalt.
+     */
+    unsigned int crossingDensity;
+
+    /**
+     * Percentage of airplanes that start StandingAtGate instead of Approaching
+     */
+    unsigned int gateShare;
+
+    /**
+     * Relative weights of the airplane types in the fleet
+     */
+    unsigned int privateWeight;
+    unsigned int airlineWeight;
+    unsigned int militaryWeight;
+    unsigned int emergencyWeight;
+
+    /**
+     * Seed of the pseudo random fleet, equal configurations give equal files
+     */
+    unsigned long seed;
+
+    ScenarioConfig();
+};
+
+/**
+ * Writes synthetic AIRPORT/RUNWAY/AIRPLANE input files that Parser::parseFile accepts as kSuccess. \n
+ * Runways are chained the way scenarios/1 does it, every runway's taxi route crosses all runways declared before it. \n
+ * IATA codes and runway names get longer instead of wrapping around, so they stay unique for every configuration.
+ */
+class ScenarioGenerator {
+private:
+    ScenarioConfig config;
+    unsigned long state;
+
+    const ScenarioGenerator* init;
+
+    bool properlyInitialized() const;
+
+    unsigned long next();
+
+    unsigned int nextFleetEntry();
+
+public:
+    /**
+     * PRE: \n
+     * REQUIRE(_config.airplanes > 0, "A scenario needs at least one airplane."); \n
+     * REQUIRE(_config.runways > 0, "A scenario needs at least one runway."); \n
+     * REQUIRE(_config.crossingDensity <= 100 && _config.gateShare <= 100, "Percentages can not exceed 100."); \n
+     * REQUIRE(_config.privateWeight + _config.airlineWeight + _config.militaryWeight + _config.emergencyWeight > 0, "The fleet mix needs at least one airplane type."); \n
+     * POST: \n
+     * ENSURE(properlyInitialized(), "ScenarioGenerator was not properly initialized.");
+     */
+    ScenarioGenerator(const ScenarioConfig& _config);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "ScenarioGenerator was not properly initialized.");
+     * @return the number of AIRPORT elements write produces
+     */
+    unsigned int getAirportCount() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "ScenarioGenerator was not properly initialized.");
+     */
+    void write(std::ostream& stream);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "ScenarioGenerator was not properly initialized.");
+     * @return false if the file could not be written
+     */
+    bool writeFile(const std::string& fileName);
+};
+
+#endif
@@ -0,0 +1,64 @@
+#include "ScenarioInput.h"
+
+bool ScenarioInput::properlyInitialized() const {
+    return this == init;
+}
+
+ScenarioInput::ScenarioInput()
+        : performanceTable(),
+          aircraftDatabase(),
+          airports(),
+          result(ParseEnum::kInvalidResult),
+          init(this) {
+    ENSURE(properlyInitialized(), "ScenarioInput was not properly initialized.");
+}
+
+ScenarioInput::~ScenarioInput() {
+    for (AirportMap::iterator it_airport = airports.begin(); it_airport != airports.end(); it_airport++) {
+        delete it_airport->second;
+    }
+}
+
+ParseEnum::EResult ScenarioInput::load(const std::string& path, std::ostream& parserStream) {
+    REQUIRE(properlyInitialized(), "ScenarioInput was not properly initialized.");
+    REQUIRE(!path.empty() && path[path.size() - 1] == '/', "Scenario path must end with a slash.");
+    REQUIRE(getResult() == ParseEnum::kInvalidResult, "ScenarioInput is already loaded.");
+
+    if (!FileExists(path + "input.xml")) return result;
+
+    Parser parser = Parser(parserStream);
+
+    if (FileExists(path + "performance.xml")) {
+        std::string performanceFileName = path + "performance.xml";
+        if (parser.parsePerformanceFile(performanceFileName.c_str(), performanceTable) == ParseEnum::kAborted) {
+            result = ParseEnum::kAborted;
+            return result;
+        }
+    }
+    parser.setPerformanceTable(&performanceTable);
+
+    if (FileExists(path + "aircraft.xml")) {
+        std::string aircraftFileName = path + "aircraft.xml";
+        if (parser.parseAircraftFile(aircraftFileName.c_str(), aircraftDatabase) == ParseEnum::kAborted) {
+            result = ParseEnum::kAborted;
+            return result;
+        }
+    }
+    parser.setAircraftDatabase(&aircraftDatabase);
+
+    std::string completefilename = path + "input.xml";
+    std::pair<ParseEnum::EResult, AirportMap> pairResult = parser.parseFile(completefilename.c_str());
+    airports = pairResult.second;
+    result = pairResult.first;
+    return result;
+}
+
+ParseEnum::EResult ScenarioInput::getResult() const {
+    REQUIRE(properlyInitialized(), "ScenarioInput was not properly initialized.");
+    return result;
+}
+
+const AirportMap& ScenarioInput::getAirports() const {
+    REQUIRE(properlyInitialized(), "ScenarioInput was not properly initialized.");
+    return airports;
+}
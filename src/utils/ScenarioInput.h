@@ -0,0 +1,65 @@
+#ifndef INC_SCENARIOINPUT_H
+#define INC_SCENARIOINPUT_H
+
+#include "../lib/DesignByContract.h"
+#include "../parser/Parser.h"
+
+#include <iostream>
+#include <string>
+
+/**
+ * The parsed inputs of a scenario directory: input.xml and the optional performance.xml and aircraft.xml. \n
+ * The Airports refer to the performance table and aircraft database, the input owns all of them. \n
+ * For tools that simulate the same scenario many times, ScenarioRunner parses and simulates once with outputs.
+ */
+class ScenarioInput {
+private:
+    PerformanceTable performanceTable;
+    AircraftDatabase aircraftDatabase;
+    AirportMap airports;
+    ParseEnum::EResult result;
+
+    const ScenarioInput* init;
+
+    bool properlyInitialized() const;
+
+    ScenarioInput(const ScenarioInput&);
+
+    ScenarioInput& operator=(const ScenarioInput&);
+
+public:
+    /**
+     * POST: \n
+     * ENSURE(properlyInitialized(), "ScenarioInput was not properly initialized.");
+     */
+    ScenarioInput();
+
+    /**
+     * Deletes the Airports
+     */
+    ~ScenarioInput();
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "ScenarioInput was not properly initialized."); \n
+     * REQUIRE(!path.empty() && path[path.size() - 1] == '/', "Scenario path must end with a slash."); \n
+     * REQUIRE(getResult() == ParseEnum::kInvalidResult, "ScenarioInput is already loaded.");
+     * @param parserStream The stream the parser messages are written to
+     * @return kInvalidResult if the scenario has no input.xml
+     */
+    ParseEnum::EResult load(const std::string& path, std::ostream& parserStream);
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "ScenarioInput was not properly initialized.");
+     */
+    ParseEnum::EResult getResult() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "ScenarioInput was not properly initialized.");
+     */
+    const AirportMap& getAirports() const;
+};
+
+#endif
@@ -0,0 +1,386 @@
+#include "ScenarioRunner.h"
+#include "../classes/Simulator.h"
+#include "../classes/AsyncRenderer.h"
+#include "../classes/TraceWriter.h"
+#include "../classes/AllocationTracker.h"
+#include "../classes/StateDigest.h"
+#include "../classes/AirplaneInfoFile.h"
+#include "../classes/OperationalStatistics.h"
+#include "../parser/FlightSchedule.h"
+#include "ResultCache.h"
+
+#include <fstream>
+
+namespace {
+    /**
+     * What a Simulator of one airport is run with, NULL leaves a measurement off
+     */
+    struct SimulatorSetup {
+        SimulationProfile* profile;
+        std::ostream* profileStream;
+        TraceWriter* trace;
+        PerfCounters* perfCounters;
+        AllocationTracker* allocationTracker;
+        StateDigest* stateDigest;
+        OperationalStatistics* statistics;
+        TimeSeriesWriter* timeSeries;
+        FlightSchedule* schedule;
+        bool retire;
+
+        SimulatorSetup()
+                : profile(NULL), profileStream(NULL), trace(NULL), perfCounters(NULL), allocationTracker(NULL),
+                  stateDigest(NULL), statistics(NULL), timeSeries(NULL), schedule(NULL), retire(false) {}
+    };
+
+    /**
+     * Hands the setup to the Simulator, whichever renderers it was built with
+     */
+    void configure(Simulator& simulator, const SimulatorSetup& setup) {
+        if (setup.profile != NULL) simulator.setProfile(setup.profile, setup.profileStream);
+        if (setup.trace != NULL) simulator.setTrace(setup.trace);
+        if (setup.perfCounters != NULL) simulator.setPerfCounters(setup.perfCounters);
+        if (setup.allocationTracker != NULL) simulator.setAllocationTracker(setup.allocationTracker);
+        if (setup.stateDigest != NULL) simulator.setStateDigest(setup.stateDigest);
+        if (setup.statistics != NULL) simulator.setStatistics(setup.statistics);
+        if (setup.timeSeries != NULL) simulator.setTimeSeries(setup.timeSeries);
+        if (setup.schedule != NULL) simulator.setSchedule(setup.schedule);
+        simulator.setRetireAirplanes(setup.retire);
+    }
+}
+
+RunOptions::RunOptions()
+        : asyncOutput(false),
+          profile(false),
+          trace(false),
+          perf(false),
+          allocations(false),
+          digest(false),
+          states(false),
+          airplaneFiles(false),
+          statistics(false),
+          timeSeries(false),
+          retire(false),
+          cache(false),
+          cacheDirectory(".pse_cache/") {}
+
+ScenarioSummary::ScenarioSummary()
+        : path(),
+          result(ParseEnum::kInvalidResult),
+          airports(0),
+          airplanes(0),
+          parseTime(0),
+          simulateTime(0),
+          cached(false),
+          outputs() {}
+
+bool ScenarioRunner::properlyInitialized() const {
+    return this == init;
+}
+
+ScenarioRunner::ScenarioRunner(const RunOptions& _options) : options(_options), cache(NULL), init(this) {
+    // the measuring outputs differ between runs, those runs are never cached
+    const bool measuring = options.profile || options.trace || options.perf || options.allocations || options.digest || options.states;
+    if (options.cache && !measuring) cache = new ResultCache(options.cacheDirectory);
+
+    ENSURE(properlyInitialized(), "ScenarioRunner was not properly initialized.");
+}
+
+ScenarioRunner::~ScenarioRunner() {
+    delete cache;
+}
+
+ScenarioSummary ScenarioRunner::run(const std::string& path, std::ostream& console) const {
+    REQUIRE(properlyInitialized(), "ScenarioRunner was not properly initialized.");
+    REQUIRE(!path.empty() && path[path.size() - 1] == '/', "Scenario path must end with a slash.");
+
+    ScenarioSummary summary;
+    summary.path = path;
+    if (!FileExists(path + "input.xml")) return summary;
+
+    std::string key;
+    if (cache != NULL) {
+        const unsigned long long start = getMonotonicNanoseconds();
+        key = cache->computeKey(path, std::string(options.asyncOutput ? "async" : "sync") + (options.airplaneFiles ? " airplane-files" : "") + (options.statistics ? " statistics" : "") + (options.timeSeries ? " time-series" : "") + (options.retire ? " retire" : ""));
+        if (cache->restore(key, path, summary)) {
+            summary.parseTime = (getMonotonicNanoseconds() - start) / 1000000.0;
+            return summary;
+        }
+    }
+
+    simulate(path, console, summary);
+
+    // an aborted run is not cached, the next run reports the broken file again
+    if (cache != NULL && summary.result != ParseEnum::kAborted) cache->store(key, path, summary);
+    return summary;
+}
+
+void ScenarioRunner::simulate(const std::string& path, std::ostream& console, ScenarioSummary& summary) const {
+    const unsigned long long parseStart = getMonotonicNanoseconds();
+
+    std::ofstream parserOutputStream;
+    std::string paserOutputName = path + "output_parser.txt";
+    parserOutputStream.open(paserOutputName.c_str());
+    summary.outputs.push_back("output_parser.txt");
+
+    Parser parser = Parser(parserOutputStream);
+
+    PerformanceTable performanceTable;
+    if (FileExists(path + "performance.xml")) {
+        std::string performanceFileName = path + "performance.xml";
+        if (parser.parsePerformanceFile(performanceFileName.c_str(), performanceTable) == ParseEnum::kAborted) {
+            console << "Error loading " << performanceFileName << ", the scenario was not simulated (see output_parser.txt)." << std::endl;
+            summary.result = ParseEnum::kAborted;
+            return;
+        }
+    }
+    parser.setPerformanceTable(&performanceTable);
+
+    AircraftDatabase aircraftDatabase;
+    if (FileExists(path + "aircraft.xml")) {
+        std::string aircraftFileName = path + "aircraft.xml";
+        if (parser.parseAircraftFile(aircraftFileName.c_str(), aircraftDatabase) == ParseEnum::kAborted) {
+            console << "Error loading " << aircraftFileName << ", the scenario was not simulated (see output_parser.txt)." << std::endl;
+            summary.result = ParseEnum::kAborted;
+            return;
+        }
+    }
+    parser.setAircraftDatabase(&aircraftDatabase);
+
+    std::ofstream traceStream;
+    TraceWriter* trace = NULL;
+    if (options.trace) {
+        std::string traceStreamName = path + "output_trace.json";
+        traceStream.open(traceStreamName.c_str());
+        trace = new TraceWriter(traceStream);
+        trace->beginTrack("parser");
+    }
+    parser.setTrace(trace);
+
+    PerfCounters* perfCounters = NULL;
+    if (options.perf) {
+        perfCounters = new PerfCounters();
+        perfCounters->begin();
+    }
+
+    std::string completefilename = path + "input.xml";
+    std::pair<ParseEnum::EResult, std::map<std::string, Airport *> > pairResult = parser.parseFile(completefilename.c_str());
+
+    if (perfCounters != NULL) perfCounters->end("parse");
+
+    parserOutputStream.close();
+
+    summary.result = pairResult.first;
+    summary.parseTime = (getMonotonicNanoseconds() - parseStart) / 1000000.0;
+
+    if (pairResult.first != ParseEnum::kSuccess) {
+        for (AirportMap::iterator it_airport = pairResult.second.begin(); it_airport != pairResult.second.end(); it_airport++) {
+            delete it_airport->second;
+        }
+        delete trace;
+        delete perfCounters;
+        return;
+    }
+
+    const unsigned long long simulateStart = getMonotonicNanoseconds();
+
+    for (AirportMap::iterator it_airport = pairResult.second.begin(); it_airport != pairResult.second.end(); it_airport++)
+    {
+        Airport *airport = it_airport->second;
+        summary.airports++;
+        summary.airplanes += airport->getAirplanes().size();
+
+        std::string airportPath = path + airport->getIata() + "/";
+        const char* outputNames[] = {"output_output.txt", "output_error.txt", "output_tower.txt", "output_floorplan.txt", "output_airportinfo.txt"};
+        for (unsigned int i = 0; i < 5; i++) {
+            summary.outputs.push_back(airport->getIata() + "/" + outputNames[i]);
+        }
+
+        std::ofstream outputStream;
+        std::string outputStreamName = airportPath + "output_output.txt";
+        outputStream.open(outputStreamName.c_str());
+
+        std::ofstream errorStream;
+        std::string errorStreamName = airportPath + "output_error.txt";
+        errorStream.open(errorStreamName.c_str());
+
+        std::ofstream towerStream;
+        std::string towerStreamName = airportPath + "output_tower.txt";
+        towerStream.open(towerStreamName.c_str());
+
+        std::ofstream floorplanStream;
+        std::string floorplanStreamName = airportPath + "output_floorplan.txt";
+        floorplanStream.open(floorplanStreamName.c_str());
+
+        std::ofstream airportInfoStream;
+        std::string fairportInfoStreamName = airportPath + "output_airportinfo.txt";
+        airportInfoStream.open(fairportInfoStreamName.c_str());
+
+        airport->printInfo(airportInfoStream);
+
+        if (trace != NULL) trace->beginTrack("simulation " + airport->getIata());
+
+        std::ofstream profileStream;
+        SimulationProfile profile;
+        if (options.profile) {
+            std::string profileStreamName = airportPath + "output_profile.txt";
+            profileStream.open(profileStreamName.c_str());
+        }
+
+        if (options.airplaneFiles) {
+            for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++)
+            {
+                std::ofstream airplaneStream;
+                std::string airplaneMap = airportPath + "airplanes/" + it_airplane->second->getNumber() + ".txt";
+                airplaneStream.open(airplaneMap.c_str());
+                summary.outputs.push_back(airport->getIata() + "/airplanes/" + it_airplane->second->getNumber() + ".txt");
+
+                it_airplane->second->printInfo(airplaneStream);
+
+                airplaneStream.close();
+            }
+        } else {
+            std::ofstream airplaneStream;
+            std::string airplaneStreamName = airportPath + "output_airplanes.txt";
+            airplaneStream.open(airplaneStreamName.c_str(), std::ios::binary);
+            summary.outputs.push_back(airport->getIata() + "/output_airplanes.txt");
+
+            AirplaneInfoWriter airplaneWriter(airplaneStream);
+            for (AirplaneMap::const_iterator it_airplane = airport->getAirplanes().begin(); it_airplane != airport->getAirplanes().end(); it_airplane++) {
+                airplaneWriter.add(it_airplane->second);
+            }
+            airplaneWriter.close();
+            airplaneStream.close();
+        }
+
+        std::ofstream digestStream;
+        std::ofstream stateStream;
+        StateDigest* stateDigest = NULL;
+        if (options.digest || options.states) {
+            std::string digestStreamName = airportPath + "output_digest.txt";
+            digestStream.open(digestStreamName.c_str());
+            if (options.states) {
+                std::string stateStreamName = airportPath + "output_states.txt";
+                stateStream.open(stateStreamName.c_str());
+            }
+            stateDigest = new StateDigest(digestStream, options.states ? &stateStream : NULL);
+        }
+
+        OperationalStatistics* statistics = (options.statistics ? new OperationalStatistics() : NULL);
+
+        std::ofstream timeSeriesStream;
+        TimeSeriesWriter* timeSeries = NULL;
+        if (options.timeSeries) {
+            std::string timeSeriesStreamName = airportPath + "output_timeseries.bin";
+            timeSeriesStream.open(timeSeriesStreamName.c_str(), std::ios::binary);
+            summary.outputs.push_back(airport->getIata() + "/output_timeseries.bin");
+            timeSeries = new TimeSeriesWriter(timeSeriesStream);
+        }
+
+        std::ifstream scheduleStream;
+        FlightSchedule* schedule = NULL;
+        if (FileExists(path + "schedule.xml")) {
+            std::string scheduleStreamName = path + "schedule.xml";
+            scheduleStream.open(scheduleStreamName.c_str());
+            schedule = new FlightSchedule(scheduleStream, errorStream, airport->getIata());
+            schedule->setPerformanceTable(&performanceTable);
+            schedule->setAircraftDatabase(&aircraftDatabase);
+        }
+
+        // allocations of the AsyncRenderer threads are not tracked
+        AllocationTracker* allocationTracker = (options.allocations ? new AllocationTracker() : NULL);
+
+        SimulatorSetup setup;
+        if (options.profile) {
+            setup.profile = &profile;
+            setup.profileStream = &profileStream;
+        }
+        setup.trace = trace;
+        setup.perfCounters = perfCounters;
+        setup.allocationTracker = allocationTracker;
+        setup.stateDigest = stateDigest;
+        setup.statistics = statistics;
+        setup.timeSeries = timeSeries;
+        setup.schedule = schedule;
+        setup.retire = options.retire;
+
+        if (options.asyncOutput) {
+            if (perfCounters != NULL) perfCounters->begin();
+            Simulator simulator(airport, errorStream);
+            if (perfCounters != NULL) perfCounters->end("copy");
+
+            OutputRenderer outputRenderer(simulator.getAirport(), outputStream);
+            TowerRenderer towerRenderer(simulator.getAirport(), towerStream);
+            FloorplanRenderer floorplanRenderer(simulator.getAirport(), floorplanStream);
+            AsyncRenderer asyncOutputRenderer(&outputRenderer);
+            AsyncRenderer asyncTowerRenderer(&towerRenderer);
+
+            simulator.addRenderer(&asyncOutputRenderer);
+            simulator.addRenderer(&asyncTowerRenderer);
+            simulator.addRenderer(&floorplanRenderer);
+            configure(simulator, setup);
+            simulator.Simulate();
+        } else {
+            if (perfCounters != NULL) perfCounters->begin();
+            Simulator simulator(airport, outputStream, errorStream, towerStream, floorplanStream);
+            if (perfCounters != NULL) perfCounters->end("copy");
+            configure(simulator, setup);
+            simulator.Simulate();
+        }
+
+        if (schedule != NULL) {
+            summary.airplanes += schedule->getTaken();
+            if (schedule->getResult() != ParseEnum::kSuccess && summary.result == ParseEnum::kSuccess) summary.result = schedule->getResult();
+            delete schedule;
+            scheduleStream.close();
+        }
+
+        if (allocationTracker != NULL) {
+            std::ofstream allocationStream;
+            std::string allocationStreamName = airportPath + "output_allocations.txt";
+            allocationStream.open(allocationStreamName.c_str());
+            allocationTracker->report(allocationStream);
+            allocationStream.close();
+            delete allocationTracker;
+        }
+
+        if (statistics != NULL) {
+            std::ofstream statisticsStream;
+            std::string statisticsStreamName = airportPath + "output_statistics.txt";
+            statisticsStream.open(statisticsStreamName.c_str());
+            summary.outputs.push_back(airport->getIata() + "/output_statistics.txt");
+            statistics->report(statisticsStream);
+            statisticsStream.close();
+            delete statistics;
+        }
+
+        if (timeSeries != NULL) {
+            delete timeSeries;
+            timeSeriesStream.close();
+        }
+
+        if (stateDigest != NULL) {
+            delete stateDigest;
+            digestStream.close();
+            if (options.states) stateStream.close();
+        }
+
+        outputStream.close();
+        errorStream.close();
+        towerStream.close();
+        floorplanStream.close();
+        airportInfoStream.close();
+        if (options.profile) profileStream.close();
+
+        delete airport;
+    }
+
+    summary.simulateTime = (getMonotonicNanoseconds() - simulateStart) / 1000000.0;
+
+    delete trace;
+    traceStream.close();
+
+    if (perfCounters != NULL) {
+        perfCounters->report(console);
+        delete perfCounters;
+    }
+}
@@ -0,0 +1,99 @@
+#ifndef INC_SCENARIORUNNER_H
+#define INC_SCENARIORUNNER_H
+
+#include "../lib/DesignByContract.h"
+#include "../parser/Parser.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+class ResultCache;
+
+/**
+ * The optional outputs of a run, every option writes its own file next to the usual outputs. \n
+ * The airplane records of an airport are written to one indexed output_airplanes.txt, airplaneFiles writes the separate
+ * airplanes/NUMBER.txt files instead. statistics writes the OperationalStatistics of every airport to
+ * output_statistics.txt, timeSeries the per tick counters to output_timeseries.bin. \n
+ * A schedule.xml next to input.xml is streamed into the simulation of every airport, see FlightSchedule. retire
+ * deletes the airplanes that left or crashed during the run, the airplane records only hold the parsed airplanes. \n
+ * With cache set, runs without any of the measuring outputs are looked up in and stored to the ResultCache in cacheDirectory
+ */
+struct RunOptions {
+    bool asyncOutput;
+    bool profile;
+    bool trace;
+    bool perf;
+    bool allocations;
+    bool digest;
+    bool states;
+    bool airplaneFiles;
+    bool statistics;
+    bool timeSeries;
+    bool retire;
+    bool cache;
+    std::string cacheDirectory;
+
+    RunOptions();
+};
+
+/**
+ * The outcome of one scenario, kInvalidResult means the scenario has no input.xml \n
+ * Times are wall clock milliseconds, a run restored from the cache only has a parse time
+ */
+struct ScenarioSummary {
+    std::string path;
+    ParseEnum::EResult result;
+    unsigned long airports;
+    unsigned long airplanes;
+    double parseTime;
+    double simulateTime;
+    bool cached;
+
+    // the written output files, relative to the scenario directory
+    std::vector<std::string> outputs;
+
+    ScenarioSummary();
+};
+
+/**
+ * Parses a scenario directory and simulates every airport in it, the outputs are written to the scenario directory
+ * and one subdirectory per airport. \n
+ * A runner keeps no state between runs, one runner can be used from several threads at once.
+ */
+class ScenarioRunner {
+private:
+    RunOptions options;
+
+    ResultCache* cache;
+
+    const ScenarioRunner* init;
+
+    bool properlyInitialized() const;
+
+    void simulate(const std::string& path, std::ostream& console, ScenarioSummary& summary) const;
+
+    ScenarioRunner(const ScenarioRunner&);
+
+    ScenarioRunner& operator=(const ScenarioRunner&);
+
+public:
+    /**
+     * POST: \n
+     * ENSURE(properlyInitialized(), "ScenarioRunner was not properly initialized.");
+     */
+    ScenarioRunner(const RunOptions& _options);
+
+    ~ScenarioRunner();
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "ScenarioRunner was not properly initialized."); \n
+     * REQUIRE(!path.empty() && path[path.size() - 1] == '/', "Scenario path must end with a slash.");
+     * @param path The scenario directory
+     * @param console Receives the reports that are not written to a file, the hardware counters
+     */
+    ScenarioSummary run(const std::string& path, std::ostream& console) const;
+};
+
+#endif
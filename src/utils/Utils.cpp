@@ -1,5 +1,14 @@
 #include "Utils.h"
 
+#include <iomanip>
+#include <cmath>
+#include <time.h>
+#include <cstring>
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
 bool DirectoryExists(const std::string dirname) {
     struct stat st;
     return stat(dirname.c_str(), &st) == 0;
@@ -24,36 +33,154 @@ bool FileIsEmpty(const std::string filename) {
     return st.st_size == 0;
 }
 
-bool FileCompare(const std::string leftFileName, const std::string rightFileName) {
-    std::ifstream leftFile, rightFile;
-    char leftRead, rightRead;
-    bool result;
+namespace {
+    /**
+     * A read-only mapping of a whole file, an empty file has no mapping
+     */
+    class MappedFile {
+    private:
+        const char* data;
+        std::size_t size;
+        bool valid;
 
-    // Open the two files.
-    leftFile.open(leftFileName.c_str());
-    if (!leftFile.is_open()) {
-        return false;
+        MappedFile(const MappedFile&);
+
+        MappedFile& operator=(const MappedFile&);
+
+    public:
+        explicit MappedFile(const std::string& fileName) : data(NULL), size(0), valid(false) {
+            const int descriptor = open(fileName.c_str(), O_RDONLY);
+            if (descriptor < 0) return;
+
+            struct stat st;
+            if (fstat(descriptor, &st) == 0 && S_ISREG(st.st_mode)) {
+                size = static_cast<std::size_t>(st.st_size);
+                if (size == 0) {
+                    valid = true;
+                } else {
+                    void* mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+                    if (mapping != MAP_FAILED) {
+                        data = static_cast<const char*>(mapping);
+                        valid = true;
+                    }
+                }
+            }
+            close(descriptor);
+        }
+
+        ~MappedFile() {
+            if (data != NULL) munmap(const_cast<char*>(data), size);
+        }
+
+        bool isValid() const {
+            return valid;
+        }
+
+        const char* getData() const {
+            return data;
+        }
+
+        std::size_t getSize() const {
+            return size;
+        }
     };
-    rightFile.open(rightFileName.c_str());
-    if (!rightFile.is_open()) {
-        leftFile.close();
+
+    const std::size_t kCompareBlock = 65536;
+    const unsigned int kContextLines = 2;
+
+    /**
+     * @return the offset of the first differing byte, the length of the shorter side if one is a prefix of the other
+     */
+    std::size_t firstDifference(const char* left, const std::size_t leftSize, const char* right, const std::size_t rightSize) {
+        const std::size_t common = std::min(leftSize, rightSize);
+        std::size_t offset = 0;
+
+        // whole blocks with memcmp, the differing block is searched byte by byte
+        while (offset < common) {
+            const std::size_t block = std::min(kCompareBlock, common - offset);
+            if (std::memcmp(left + offset, right + offset, block) != 0) break;
+            offset += block;
+        }
+        while (offset < common && left[offset] == right[offset]) offset++;
+
+        return offset;
+    }
+
+    void describeLines(std::ostringstream& stream, const char* prefix, const char* data, const std::size_t size, const std::size_t lineStart, const unsigned int firstLine) {
+        std::size_t offset = lineStart;
+        for (unsigned int line = 0; line <= 2 * kContextLines && offset < size; line++) {
+            const char* end = static_cast<const char*>(std::memchr(data + offset, '\n', size - offset));
+            const std::size_t length = (end != NULL ? end - (data + offset) : size - offset);
+            stream << prefix << std::setw(6) << firstLine + line << " | " << std::string(data + offset, length) << std::endl;
+            offset += length + 1;
+        }
+    }
+
+    void describeDifference(const char* expected, const std::size_t expectedSize, const char* actual, const std::size_t actualSize, const std::size_t offset, std::string& difference) {
+        // the line of the difference and the start of the context before it
+        unsigned int line = 1;
+        std::size_t lineStart = 0;
+        std::vector<std::size_t> previousStarts;
+        for (std::size_t i = 0; i < offset; i++) {
+            if (expected[i] == '\n') {
+                previousStarts.push_back(lineStart);
+                if (previousStarts.size() > kContextLines) previousStarts.erase(previousStarts.begin());
+                lineStart = i + 1;
+                line++;
+            }
+        }
+        const std::size_t contextStart = (previousStarts.empty() ? lineStart : previousStarts.front());
+        const unsigned int contextLine = line - previousStarts.size();
+
+        std::ostringstream stream;
+        stream << "first difference at line " << line << std::endl;
+        describeLines(stream, "expected ", expected, expectedSize, contextStart, contextLine);
+        describeLines(stream, "actual   ", actual, actualSize, contextStart, contextLine);
+        difference = stream.str();
+    }
+}
+
+bool FileCompare(const std::string leftFileName, const std::string rightFileName) {
+    MappedFile leftFile(leftFileName);
+    MappedFile rightFile(rightFileName);
+    if (!leftFile.isValid() || !rightFile.isValid()) return false;
+    if (leftFile.getSize() != rightFile.getSize()) return false;
+
+    return firstDifference(leftFile.getData(), leftFile.getSize(), rightFile.getData(), rightFile.getSize()) == leftFile.getSize();
+}
+
+bool CompareWithFile(const std::string& fileName, const std::string& contents, std::string* difference) {
+    MappedFile file(fileName);
+    if (!file.isValid()) {
+        if (difference != NULL) *difference = fileName + " can not be opened";
         return false;
-    };
+    }
 
-    result = true; // files exist and are open; assume equality unless a counterexamples shows up.
-    while (result && leftFile.good() && rightFile.good()) {
-        leftFile.get(leftRead);
-        rightFile.get(rightRead);
-        result = (leftRead == rightRead);
-    };
-    if (result) {
-        // last read was still equal; are we at the end of both files ?
-        result = (!leftFile.good()) && (!rightFile.good());
-    };
+    const std::size_t offset = firstDifference(file.getData(), file.getSize(), contents.data(), contents.size());
+    if (offset == file.getSize() && offset == contents.size()) return true;
 
-    leftFile.close();
-    rightFile.close();
-    return result;
+    if (difference != NULL) describeDifference(file.getData(), file.getSize(), contents.data(), contents.size(), offset, *difference);
+    return false;
+}
+
+std::vector<std::string> ListDirectories(const std::string& path) {
+    std::vector<std::string> directories;
+
+    const std::string prefix = (path.empty() || path[path.size() - 1] == '/' ? path : path + "/");
+    DIR* directory = opendir(prefix.c_str());
+    if (directory == NULL) return directories;
+
+    for (struct dirent* entry = readdir(directory); entry != NULL; entry = readdir(directory)) {
+        const std::string name = entry->d_name;
+        if (name == "." || name == "..") continue;
+
+        struct stat st;
+        if (stat((prefix + name).c_str(), &st) == 0 && S_ISDIR(st.st_mode)) directories.push_back(name);
+    }
+    closedir(directory);
+
+    std::sort(directories.begin(), directories.end());
+    return directories;
 }
 
 bool isString(const std::string& str) {
@@ -100,6 +227,40 @@ std::string getRowAndColumnStr(const TiXmlText* text)
     return outputStream.str();
 }
 
+std::string getRealisticTimeStamp(const unsigned int timer) {
+    std::stringstream result;
+
+    unsigned int days = static_cast<unsigned int>(std::floor((timer + 720) / 1440.0));
+    unsigned int hours = static_cast<unsigned int>(std::floor((timer + 720 - (days * 1440)) / 60.0));
+    unsigned int minutes = static_cast<unsigned int>(std::floor((timer + 720) - (days * 1440) - (hours * 60)));
+
+    result << '[';
+
+    if (days % 7 == 0) result << "Monday ";
+    else if (days % 7 == 1) result << "Tuesday ";
+    else if (days % 7 == 2) result << "Wednesday ";
+    else if (days % 7 == 3) result << "Thursday ";
+    else if (days % 7 == 4) result << "Friday ";
+    else if (days % 7 == 5) result << "Saturday ";
+    else if (days % 7 == 6) result << "Sunday ";
+
+    result << std::setw(2) << std::setfill('0') << hours << ":" << std::setw(2) << std::setfill('0') << minutes << ']';
+
+    return result.str();
+}
+
+unsigned long long getMonotonicNanoseconds() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<unsigned long long>(now.tv_sec) * 1000000000ULL + static_cast<unsigned long long>(now.tv_nsec);
+}
+
+unsigned long long getThreadCpuNanoseconds() {
+    struct timespec now;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return static_cast<unsigned long long>(now.tv_sec) * 1000000000ULL + static_cast<unsigned long long>(now.tv_nsec);
+}
+
 std::string convertPartialNumbersToNATOAlphabet(const std::string& string) {
     std::string result;
 
@@ -37,8 +37,24 @@ bool FileExists(const std::string dirname);
 
 bool FileIsEmpty(const std::string filename);
 
+/**
+ * Compares two files block by block, both files are mapped in memory \n
+ * Two empty files are equal, a file that can not be opened is never equal
+ */
 bool FileCompare(const std::string leftFileName, const std::string rightFileName);
 
+/**
+ * Compares a buffer with a golden file, the file is mapped in memory
+ * @param difference Receives the first differing line of both sides with the lines around it, may be NULL
+ * @return true if the file exists and has exactly the contents of the buffer
+ */
+bool CompareWithFile(const std::string& fileName, const std::string& contents, std::string* difference = NULL);
+
+/**
+ * @return the names of the directories directly inside path, sorted, without "." and ".."
+ */
+std::vector<std::string> ListDirectories(const std::string& path);
+
 /**
  * Returns true if string only contains alphabetical characters (lower & uppercase), digits, or spaces
  * PRE:
@@ -59,6 +75,21 @@ std::string getRowAndColumnStr(const TiXmlNode* node);
 
 std::string getRowAndColumnStr(const TiXmlText* text);
 
+/**
+ * Returns the simulated time in the format [{DAY} {HH}:{MM}], timer 0 is Monday 12:00
+ */
+std::string getRealisticTimeStamp(const unsigned int timer);
+
+/**
+ * Returns a monotonic wall clock reading in nanoseconds, only differences between readings are meaningful
+ */
+unsigned long long getMonotonicNanoseconds();
+
+/**
+ * Returns the CPU time of the calling thread in nanoseconds, time the thread is descheduled is not counted
+ */
+unsigned long long getThreadCpuNanoseconds();
+
 std::string convertPartialNumbersToNATOAlphabet(const std::string& string);
 
 std::string convertToNATOAlphabet(const std::string& string);
@@ -0,0 +1,115 @@
+#include "WorkStealingPool.h"
+
+#include <unistd.h>
+
+bool WorkStealingPool::properlyInitialized() const {
+    return this == init;
+}
+
+unsigned int WorkStealingPool::getThreadCount(const unsigned int threads) {
+    if (threads != 0) return threads;
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count < 1 ? 1 : static_cast<unsigned int>(count));
+}
+
+WorkStealingPool::WorkStealingPool(const unsigned int threads) : workers(), submitted(0), stolen(0), ran(false), init(this) {
+    const unsigned int count = getThreadCount(threads);
+
+    for (unsigned int index = 0; index < count; index++) {
+        Worker* worker = new Worker();
+        worker->pool = this;
+        worker->index = index;
+        pthread_mutex_init(&worker->mutex, NULL);
+        workers.push_back(worker);
+    }
+
+    ENSURE(properlyInitialized(), "WorkStealingPool was not properly initialized.");
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    for (std::vector<Worker*>::iterator it_worker = workers.begin(); it_worker != workers.end(); it_worker++) {
+        pthread_mutex_destroy(&(*it_worker)->mutex);
+        delete *it_worker;
+    }
+}
+
+void WorkStealingPool::submit(PoolJob* job) {
+    REQUIRE(properlyInitialized(), "WorkStealingPool was not properly initialized.");
+    REQUIRE(job != NULL, "PoolJob can not be NULL.");
+    REQUIRE(!hasRun(), "WorkStealingPool has already run.");
+
+    // the first jobs end up at the back, where their thread takes them first
+    workers[submitted % workers.size()]->jobs.push_front(job);
+    submitted++;
+}
+
+PoolJob* WorkStealingPool::take(Worker* worker) {
+    PoolJob* job = NULL;
+
+    pthread_mutex_lock(&worker->mutex);
+    if (!worker->jobs.empty()) {
+        job = worker->jobs.back();
+        worker->jobs.pop_back();
+    }
+    pthread_mutex_unlock(&worker->mutex);
+    if (job != NULL) return job;
+
+    for (unsigned int offset = 1; offset < workers.size() && job == NULL; offset++) {
+        Worker* victim = workers[(worker->index + offset) % workers.size()];
+
+        pthread_mutex_lock(&victim->mutex);
+        if (!victim->jobs.empty()) {
+            job = victim->jobs.front();
+            victim->jobs.pop_front();
+        }
+        pthread_mutex_unlock(&victim->mutex);
+    }
+
+    if (job != NULL) __sync_fetch_and_add(&stolen, 1);
+    return job;
+}
+
+void* WorkStealingPool::work(void* argument) {
+    Worker* worker = static_cast<Worker*>(argument);
+
+    // no job adds jobs, an empty pool stays empty
+    for (PoolJob* job = worker->pool->take(worker); job != NULL; job = worker->pool->take(worker)) {
+        job->run(worker->index);
+    }
+
+    return NULL;
+}
+
+void WorkStealingPool::run() {
+    REQUIRE(properlyInitialized(), "WorkStealingPool was not properly initialized.");
+    REQUIRE(!hasRun(), "WorkStealingPool has already run.");
+
+    std::vector<bool> started(workers.size(), false);
+    for (unsigned int index = 1; index < workers.size(); index++) {
+        started[index] = pthread_create(&workers[index]->thread, NULL, &WorkStealingPool::work, workers[index]) == 0;
+    }
+
+    // a worker whose thread could not be started is emptied by stealing
+    work(workers[0]);
+
+    for (unsigned int index = 1; index < workers.size(); index++) {
+        if (started[index]) pthread_join(workers[index]->thread, NULL);
+    }
+    ran = true;
+
+    ENSURE(hasRun(), "WorkStealingPool did not run.");
+}
+
+bool WorkStealingPool::hasRun() const {
+    return ran;
+}
+
+unsigned int WorkStealingPool::getThreadCount() const {
+    REQUIRE(properlyInitialized(), "WorkStealingPool was not properly initialized.");
+    return workers.size();
+}
+
+unsigned long WorkStealingPool::getStolen() const {
+    REQUIRE(properlyInitialized(), "WorkStealingPool was not properly initialized.");
+    return stolen;
+}
@@ -0,0 +1,106 @@
+#ifndef INC_WORKSTEALINGPOOL_H
+#define INC_WORKSTEALINGPOOL_H
+
+#include "../lib/DesignByContract.h"
+
+#include <deque>
+#include <vector>
+#include <pthread.h>
+
+/**
+ * A unit of work for the WorkStealingPool
+ */
+class PoolJob {
+public:
+    virtual ~PoolJob() {}
+
+    /**
+     * Called once on one of the pool threads
+     */
+    virtual void run(const unsigned int thread) = 0;
+};
+
+/**
+ * Runs jobs on a fixed number of threads. Every thread has its own queue, submitted jobs are dealt round robin. \n
+ * A thread takes jobs from the back of its own queue and steals from the front of the other queues once its own is
+ * empty, so a few long jobs do not leave the other threads idle. \n
+ * Jobs are submitted before run, the pool does not take ownership of them.
+ */
+class WorkStealingPool {
+private:
+    struct Worker {
+        WorkStealingPool* pool;
+        unsigned int index;
+        pthread_t thread;
+        pthread_mutex_t mutex;
+        std::deque<PoolJob*> jobs;
+    };
+
+    std::vector<Worker*> workers;
+    unsigned long submitted;
+    unsigned long stolen;
+    bool ran;
+
+    const WorkStealingPool* init;
+
+    bool properlyInitialized() const;
+
+    static void* work(void* argument);
+
+    PoolJob* take(Worker* worker);
+
+    WorkStealingPool(const WorkStealingPool&);
+
+    WorkStealingPool& operator=(const WorkStealingPool&);
+
+public:
+    /**
+     * POST: \n
+     * ENSURE(properlyInitialized(), "WorkStealingPool was not properly initialized.");
+     * @param threads The number of threads, 0 uses one thread per online CPU
+     */
+    WorkStealingPool(const unsigned int threads = 0);
+
+    /**
+     * @param threads The number of threads asked for, 0 uses one thread per online CPU
+     * @return the number of threads a pool asked for that many would run on, without building one
+     */
+    static unsigned int getThreadCount(const unsigned int threads);
+
+    ~WorkStealingPool();
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "WorkStealingPool was not properly initialized."); \n
+     * REQUIRE(job != NULL, "PoolJob can not be NULL."); \n
+     * REQUIRE(!hasRun(), "WorkStealingPool has already run.");
+     */
+    void submit(PoolJob* job);
+
+    /**
+     * Runs every submitted job and returns when all of them are done, the calling thread is the first pool thread \n
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "WorkStealingPool was not properly initialized."); \n
+     * REQUIRE(!hasRun(), "WorkStealingPool has already run."); \n
+     * POST: \n
+     * ENSURE(hasRun(), "WorkStealingPool did not run.");
+     */
+    void run();
+
+    bool hasRun() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "WorkStealingPool was not properly initialized.");
+     */
+    unsigned int getThreadCount() const;
+
+    /**
+     * PRE: \n
+     * REQUIRE(properlyInitialized(), "WorkStealingPool was not properly initialized.");
+     * @return the number of jobs that ran on another thread than the one they were dealt to
+     */
+    unsigned long getStolen() const;
+};
+
+#endif